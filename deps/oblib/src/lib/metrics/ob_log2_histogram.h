@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef _OB_LOG2_HISTOGRAM_H
+#define _OB_LOG2_HISTOGRAM_H 1
+#include <stdint.h>
+#include "lib/atomic/ob_atomic.h"
+#include "lib/utility/ob_print_utils.h"
+namespace oceanbase
+{
+namespace common
+{
+// Lock free histogram with power-of-two buckets, cheap enough to be updated
+// on hot paths by multiple threads.
+// bucket 0 holds values <= 0, bucket i (i > 0) holds values in [2^(i-1), 2^i),
+// the last bucket also holds every larger value.
+class ObLog2Histogram
+{
+public:
+  static const int64_t BUCKET_NUM = 32;
+public:
+  ObLog2Histogram() { reset(); }
+  ~ObLog2Histogram() {}
+
+  void reset()
+  {
+    for (int64_t i = 0; i < BUCKET_NUM; i++) {
+      ATOMIC_STORE(&buckets_[i], 0);
+    }
+    ATOMIC_STORE(&total_count_, 0);
+    ATOMIC_STORE(&total_value_, 0);
+  }
+  void add(const int64_t value)
+  {
+    ATOMIC_INC(&buckets_[get_bucket_idx(value)]);
+    ATOMIC_INC(&total_count_);
+    ATOMIC_AAF(&total_value_, value);
+  }
+  int64_t get_bucket_count(const int64_t idx) const
+  {
+    return (idx < 0 || idx >= BUCKET_NUM) ? 0 : ATOMIC_LOAD(&buckets_[idx]);
+  }
+  int64_t get_total_count() const { return ATOMIC_LOAD(&total_count_); }
+  int64_t get_total_value() const { return ATOMIC_LOAD(&total_value_); }
+  int64_t get_avg_value() const
+  {
+    const int64_t count = get_total_count();
+    return 0 == count ? 0 : get_total_value() / count;
+  }
+  // upper bound of the bucket which holds the 'percent'-th value, e.g. 99 for P99
+  int64_t get_percentile(const int64_t percent) const
+  {
+    const int64_t total = get_total_count();
+    const int64_t target = (total * percent + 99) / 100;
+    int64_t acc = 0;
+    int64_t idx = 0;
+    for (; idx < BUCKET_NUM - 1; idx++) {
+      acc += get_bucket_count(idx);
+      if (acc >= target) {
+        break;
+      }
+    }
+    return 0 == total ? 0 : get_bucket_upper_bound(idx);
+  }
+  // exclusive upper bound of bucket 'idx', INT64_MAX for the last bucket
+  static int64_t get_bucket_upper_bound(const int64_t idx)
+  {
+    return idx >= BUCKET_NUM - 1 ? INT64_MAX : (idx <= 0 ? 1 : (1LL << idx));
+  }
+  static int64_t get_bucket_idx(const int64_t value)
+  {
+    int64_t idx = 0;
+    if (value > 0) {
+      idx = 64 - __builtin_clzll(static_cast<uint64_t>(value));
+      idx = idx >= BUCKET_NUM ? BUCKET_NUM - 1 : idx;
+    }
+    return idx;
+  }
+  int64_t to_string(char *buf, const int64_t buf_len) const
+  {
+    int64_t pos = 0;
+    J_OBJ_START();
+    J_KV("count", get_total_count(), "avg", get_avg_value(),
+         "p50", get_percentile(50), "p99", get_percentile(99));
+    J_OBJ_END();
+    return pos;
+  }
+private:
+  int64_t buckets_[BUCKET_NUM];
+  int64_t total_count_;
+  int64_t total_value_;
+};
+
+} // end namespace common
+} // end namespace oceanbase
+
+#endif /* _OB_LOG2_HISTOGRAM_H */
@@ -114,6 +114,12 @@ STAT_EVENT_ADD_DEF(HA_GTS_HANDLE_GET_REQUEST_COUNT, "ha gts handle get request c
 STAT_EVENT_ADD_DEF(HA_GTS_SEND_GET_RESPONSE_COUNT, "ha gts send get response count", ObStatClassIds::TRANS, "ha gts send get response count", 30070, true, true)
 STAT_EVENT_ADD_DEF(HA_GTS_HANDLE_PING_REQUEST_COUNT, "ha gts handle ping request count", ObStatClassIds::TRANS, "ha gts handle ping request count", 30071, true, true)
 STAT_EVENT_ADD_DEF(HA_GTS_HANDLE_PING_RESPONSE_COUNT, "ha gts handle ping response count", ObStatClassIds::TRANS, "ha gts handle ping response count", 30072, true, true)
+STAT_EVENT_ADD_DEF(TRANS_COMMIT_STAGE_SAMPLE_COUNT, "trans commit stage sample count", ObStatClassIds::TRANS, "trans commit stage sample count", 30073, true, true)
+STAT_EVENT_ADD_DEF(TRANS_COMMIT_STAGE_REDO_FLUSH_TIME, "trans commit stage redo flush time", ObStatClassIds::TRANS, "trans commit stage redo flush time", 30074, true, true)
+STAT_EVENT_ADD_DEF(TRANS_COMMIT_STAGE_LOG_SUBMIT_TIME, "trans commit stage log submit time", ObStatClassIds::TRANS, "trans commit stage log submit time", 30075, true, true)
+STAT_EVENT_ADD_DEF(TRANS_COMMIT_STAGE_LOG_SYNC_TIME, "trans commit stage log sync time", ObStatClassIds::TRANS, "trans commit stage log sync time", 30076, true, true)
+STAT_EVENT_ADD_DEF(TRANS_COMMIT_STAGE_CALLBACK_TIME, "trans commit stage callback time", ObStatClassIds::TRANS, "trans commit stage callback time", 30077, true, true)
+STAT_EVENT_ADD_DEF(TRANS_COMMIT_STAGE_RESPONSE_TIME, "trans commit stage response time", ObStatClassIds::TRANS, "trans commit stage response time", 30078, true, true)
 
 // SQL
 //STAT_EVENT_ADD_DEF(PLAN_CACHE_HIT, "PLAN_CACHE_HIT", SQL, "PLAN_CACHE_HIT")
@@ -430,6 +436,10 @@ STAT_EVENT_ADD_DEF(CLOG_FILE_TOTAL_SIZE, "clog file total size", ObStatClassIds:
 STAT_EVENT_ADD_DEF(ILOG_FILE_TOTAL_SIZE, "ilog file total size", ObStatClassIds::CLOG, "ilog file total size", 80062, true, true)
 STAT_EVENT_ADD_DEF(CLOG_BATCH_SUBMITTED_COUNT, "clog batch submitted count", ObStatClassIds::CLOG, "clog batch submitted count", 80063, true, true)
 STAT_EVENT_ADD_DEF(CLOG_BATCH_COMMITTED_COUNT, "clog batch committed count", ObStatClassIds::CLOG, "clog batch committed count", 80064, true, true)
+STAT_EVENT_ADD_DEF(CLOG_TRANS_LOG_COMPRESS_COUNT, "clog trans log compress count", ObStatClassIds::CLOG, "clog trans log compress count", 80065, true, true)
+STAT_EVENT_ADD_DEF(CLOG_TRANS_LOG_COMPRESS_ORIGIN_SIZE, "clog trans log compress origin size", ObStatClassIds::CLOG, "clog trans log compress origin size", 80066, true, true)
+STAT_EVENT_ADD_DEF(CLOG_TRANS_LOG_COMPRESSED_SIZE, "clog trans log compressed size", ObStatClassIds::CLOG, "clog trans log compressed size", 80067, true, true)
+STAT_EVENT_ADD_DEF(CLOG_TRANS_LOG_COMPRESS_TIME, "clog trans log compress time", ObStatClassIds::CLOG, "clog trans log compress time", 80068, true, true)
 
 // CLOG.EXTLOG 81001 ~ 90000
 STAT_EVENT_ADD_DEF(CLOG_EXTLOG_FETCH_LOG_SIZE, "external log service fetch log size", ObStatClassIds::CLOG, "external log service fetch log size", 81001, true, true)
@@ -12,6 +12,7 @@
 
 #define USING_LOG_PREFIX RPC_OBMYSQL
 #include "rpc/obmysql/ob_sql_nio.h"
+#include "rpc/obmysql/ob_sql_nio_write_task.h"
 #include "rpc/obmysql/ob_sql_sock_session.h"
 #include "rpc/obmysql/ob_i_sql_sock_handler.h"
 #include "rpc/obmysql/ob_sql_sock_session.h"
@@ -26,6 +27,7 @@
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <sys/eventfd.h>
+#include <sys/uio.h>
 #include <arpa/inet.h>
 #include <linux/futex.h>
 
@@ -131,9 +133,9 @@ class ReadBuffer
 {
 public:
   enum { IO_BUFFER_SIZE = 1<<16 };
-  ReadBuffer(int fd): fd_(fd), has_EAGAIN_(false), request_more_data_(false),
+  ReadBuffer(int fd, ObSqlNioStat& stat): fd_(fd), has_EAGAIN_(false), request_more_data_(false),
                 alloc_buf_(NULL), buf_end_(NULL), cur_buf_(NULL), data_end_(NULL),
-                consume_sz_(0)
+                consume_sz_(0), stat_(stat)
   {}
   ~ReadBuffer() 
   {
@@ -157,6 +159,11 @@ public:
     }
     return ret;
   }
+  // data already read from fd, the fd is never read here
+  void peek_buffered_data(const char*& buf, int64_t& sz) const {
+    buf = cur_buf_;
+    sz = remain();
+  }
   int consume_data(int64_t sz) {
     int ret = OB_SUCCESS;
     if (sz > 0 && sz <= remain()) {
@@ -221,6 +228,7 @@ private:
     int ret = OB_SUCCESS;
     while(remain() < sz && OB_SUCCESS == ret) {
       int64_t rbytes = 0;
+      stat_.inc_read();
       if ((rbytes = read(fd_, data_end_, buf_end_ - data_end_)) > 0) {
         data_end_ += rbytes;
       } else if (0 == rbytes) {
@@ -253,69 +261,14 @@ private:
   char* cur_buf_;
   char* data_end_;
   uint64_t consume_sz_;
+  ObSqlNioStat& stat_;
 };
 
 class ObSqlNioImpl;
-class PendingWriteTask
-{
-public:
-  PendingWriteTask(): buf_(NULL), sz_(0) {}
-  ~PendingWriteTask() {}
-  void reset() {
-    buf_ = NULL;
-    sz_ = 0;
-  }
-  void init(const char* buf, int64_t sz) {
-    buf_ = buf;
-    sz_ = sz;
-  }
-  int try_write(int fd, bool& become_clean) {
-    int ret = OB_SUCCESS;
-    int64_t wbytes = 0;
-    if (NULL == buf_) {
-      // no pending task
-    } else if (OB_FAIL(do_write(fd, buf_, sz_, wbytes))) {
-      LOG_WARN("do_write fail", K(ret));
-    } else if (wbytes >= sz_) {
-      become_clean = true;
-      reset();
-    } else {
-      buf_ += wbytes;
-      sz_ -= wbytes;
-    }
-    return ret;
-  }
-private:
-  int do_write(int fd, const char* buf, int64_t sz, int64_t& consume_bytes) {
-    int ret = OB_SUCCESS;
-    int64_t pos = 0;
-    while(pos < sz && OB_SUCCESS == ret) {
-      int64_t wbytes = 0;
-      if ((wbytes = write(fd, buf + pos, sz - pos)) >= 0) {
-        pos += wbytes;
-      } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
-        LOG_INFO("write return EAGAIN");
-      } else if (EINTR == errno) {
-        // pass
-      } else {
-        ret = OB_IO_ERROR;
-        LOG_WARN("write data error", K(errno));
-      }
-    }
-    if (OB_SUCCESS == ret) {
-      consume_bytes = pos;
-    }
-    return ret;
-  }
-private:
-  const char* buf_;
-  int64_t sz_;
-};
-
 class ObSqlSock: public ObLink
 {
 public:
-  ObSqlSock(ObSqlNioImpl& nio, int fd): nio_impl_(nio), fd_(fd), err_(0), read_buffer_(fd), 
+  ObSqlSock(ObSqlNioImpl& nio, ObSqlNioStat& stat, int fd): nio_impl_(nio), stat_(stat), fd_(fd), err_(0), read_buffer_(fd, stat), 
             need_epoll_trigger_write_(false), may_handling_(true), handler_close_flag_(false),
             need_shutdown_(false), last_decode_time_(0), last_write_time_(0), sql_session_info_(NULL) {
     memset(sess_, 0, sizeof(sess_));
@@ -335,21 +288,29 @@ public:
       fd_ = -1;
     }
   }
-  void set_last_decode_succ_time(int64_t time) { last_decode_time_ = time;  }  
+  void set_last_decode_succ_time(int64_t time) {
+    last_decode_time_ = time;
+    stat_.inc_request();
+  }
   int64_t get_consume_sz() { return read_buffer_.get_consume_sz(); }
 
   int peek_data(int64_t limit, const char*& buf, int64_t& sz) {
     return  read_buffer_.peek_data(limit ,buf, sz);
   }
+  void peek_buffered_data(const char*& buf, int64_t& sz) const {
+    read_buffer_.peek_buffered_data(buf, sz);
+  }
   int consume_data(int64_t sz) { return read_buffer_.consume_data(sz); }
-  void init_write_task(const char* buf, int64_t sz) {
-    pending_write_task_.init(buf, sz);
+  int append_write_task(const char* buf, int64_t sz) {
+    return pending_write_task_.append(buf, sz);
   }
+  bool has_pending_write() const { return !pending_write_task_.is_empty(); }
+  ObSqlNioStat& get_stat() { return stat_; }
 
   bool is_need_epoll_trigger_write() const { return need_epoll_trigger_write_; }
   int do_pending_write(bool& become_clean) {
     int ret = OB_SUCCESS;
-    if (OB_FAIL(pending_write_task_.try_write(fd_, become_clean))) {
+    if (OB_FAIL(pending_write_task_.try_write(fd_, become_clean, stat_))) {
       need_epoll_trigger_write_ = false;
       LOG_WARN("pending write task write fail", K(ret));
     } else if (become_clean) {
@@ -364,23 +325,62 @@ public:
   }
   int write_data(const char* buf, int64_t sz) {
     int ret = OB_SUCCESS;
-    int64_t pos = 0;
-    while(pos < sz && OB_SUCCESS == ret) {
-      int64_t wbytes = 0;
-      if ((wbytes = write(fd_, buf + pos, sz - pos)) >= 0) {
-        pos += wbytes;
-        LOG_DEBUG("write fd", K(wbytes));
-      } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
+    if (OB_LIKELY(!has_pending_write())) {
+      int64_t pos = 0;
+      while(pos < sz && OB_SUCCESS == ret) {
+        int64_t wbytes = 0;
+        stat_.inc_write();
+        if ((wbytes = write(fd_, buf + pos, sz - pos)) >= 0) {
+          pos += wbytes;
+          LOG_DEBUG("write fd", K(wbytes));
+        } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
+          write_cond_.wait(1000 * 1000);
+          LOG_INFO("write cond wakeup");
+        } else if (EINTR == errno) {
+          // pass
+        } else {
+          ret = OB_IO_ERROR;
+          LOG_WARN("write data error", K(errno));
+        }
+      }
+    } else {
+      // the responses of the previous requests must go out first, write them
+      // together with this one
+      if (pending_write_task_.is_full() && OB_FAIL(sync_pending_write())) {
+        LOG_WARN("write pending data fail", K(ret));
+      } else if (OB_FAIL(pending_write_task_.append(buf, sz))) {
+        LOG_WARN("append write task fail", K(ret));
+      } else if (OB_FAIL(sync_pending_write())) {
+        LOG_WARN("write pending data fail", K(ret));
+      }
+    }
+    last_write_time_ = ObTimeUtility::current_time();
+    return ret;
+  }
+  // write buf after the pending data without waiting for EPOLLOUT, the rest is
+  // kept in the pending write task if the fd returns EAGAIN
+  int try_write_data(const char* buf, int64_t sz, bool& become_clean) {
+    int ret = OB_SUCCESS;
+    if (OB_FAIL(pending_write_task_.append(buf, sz))) {
+      LOG_WARN("append write task fail", K(ret));
+    } else if (OB_FAIL(pending_write_task_.try_write(fd_, become_clean, stat_))) {
+      LOG_WARN("pending write task write fail", K(ret));
+    } else if (become_clean) {
+      last_write_time_ = ObTimeUtility::current_time();
+    }
+    return ret;
+  }
+  int sync_pending_write() {
+    int ret = OB_SUCCESS;
+    bool become_clean = false;
+    while(OB_SUCCESS == ret && !become_clean) {
+      if (OB_FAIL(pending_write_task_.try_write(fd_, become_clean, stat_))) {
+        LOG_WARN("pending write task write fail", K(ret));
+      } else if (!become_clean) {
         write_cond_.wait(1000 * 1000);
         LOG_INFO("write cond wakeup");
-      } else if (EINTR == errno) {
-        // pass
-      } else {
-        ret = OB_IO_ERROR;
-        LOG_WARN("write data error", K(errno));
       }
     }
-    last_write_time_ = ObTimeUtility::current_time();
     return ret;
   }
   const rpc::TraceId* get_trace_id() const {
@@ -421,6 +421,7 @@ public:
   ObLink write_task_link_;
 private:
   ObSqlNioImpl& nio_impl_;
+  ObSqlNioStat& stat_;
   int fd_;
   int err_;
   ReadBuffer read_buffer_;
@@ -536,10 +537,13 @@ public:
   }
   void begin_epoll() { ATOMIC_STORE(&in_epoll_, 1); }
   void end_epoll() { ATOMIC_STORE(&in_epoll_, 0); }
-  void signal() {
+  bool signal() {
+    bool signaled = false;
     if (1 == ATOMIC_LOAD(&in_epoll_)) {
       evfd_write(evfd_);
+      signaled = true;
     }
+    return signaled;
   }
   void consume() { evfd_read(evfd_); }
 private:
@@ -557,7 +561,8 @@ private:
 class ObSqlNioImpl
 {
 public:
-  ObSqlNioImpl(ObISqlSockHandler& handler): handler_(handler), epfd_(-1), lfd_(-1) {}
+  ObSqlNioImpl(ObISqlSockHandler& handler): handler_(handler), epfd_(-1), lfd_(-1),
+                                            last_stat_syscall_cnt_(0), last_stat_request_cnt_(0) {}
   ~ObSqlNioImpl() {}
   int init(int port) {
     int ret = OB_SUCCESS;
@@ -590,6 +595,7 @@ public:
     handle_close_req_queue();
     handle_pending_destroy_list();
     print_session_info();
+    print_nio_stat();
   }
   void push_close_req(ObSqlSock* s) {
     if (s->set_error(EIO)) {
@@ -601,7 +607,9 @@ public:
   }
   void push_write_req(ObSqlSock* s) {
     write_req_queue_.push(&s->write_task_link_);
-    evfd_.signal();
+    if (evfd_.signal()) {
+      stat_.inc_evfd_signal();
+    }
   }
   void revert_sock(ObSqlSock* s) {
     if (OB_UNLIKELY(s->has_error())) {
@@ -626,6 +634,7 @@ private:
   void handle_epoll_event() {
     const int maxevents = 512;
     struct epoll_event events[maxevents];
+    stat_.inc_epoll_wait();
     int cnt = epoll_wait(epfd_, events, maxevents, 1000);
     for(int i = 0; i < cnt; i++) {
       ObSqlSock* s = (ObSqlSock*)events[i].data.ptr;
@@ -782,7 +791,7 @@ private:
   ObSqlSock* alloc_sql_sock(int fd) {
     ObSqlSock* s = NULL;
     if (NULL != (s = (ObSqlSock*)direct_alloc(sizeof(*s)))) {
-      new(s)ObSqlSock(*this, fd);
+      new(s)ObSqlSock(*this, stat_, fd);
       record_session_info(s);
     }
     return s;
@@ -817,6 +826,22 @@ private:
       }
     }
   }
+  // syscalls per request of this nio thread in the last interval, pipelined requests
+  // share the read with the requests before them
+  void print_nio_stat() {
+    if (TC_REACH_TIME_INTERVAL(10*1000*1000L)) {
+      const int64_t syscall_cnt = stat_.get_syscall_cnt();
+      const int64_t request_cnt = ATOMIC_LOAD(&stat_.request_cnt_);
+      const int64_t delta_syscall_cnt = syscall_cnt - last_stat_syscall_cnt_;
+      const int64_t delta_request_cnt = request_cnt - last_stat_request_cnt_;
+      const double syscall_per_request = delta_request_cnt > 0
+          ? static_cast<double>(delta_syscall_cnt) / static_cast<double>(delta_request_cnt) : 0;
+      last_stat_syscall_cnt_ = syscall_cnt;
+      last_stat_request_cnt_ = request_cnt;
+      LOG_INFO("[sql nio stat]", K(delta_syscall_cnt), K(delta_request_cnt),
+               K(syscall_per_request), K_(stat));
+    }
+  }
   static void* direct_alloc(int64_t sz) { return common::ob_malloc(sz, common::ObModIds::OB_COMMON_NETWORK); }
   static void direct_free(void* p) { common::ob_free(p); }
 
@@ -829,6 +854,9 @@ private:
   ObSpScLinkQueue write_req_queue_;
   ObDList pending_destroy_list_;
   ObDList all_list_;
+  ObSqlNioStat stat_;
+  int64_t last_stat_syscall_cnt_;
+  int64_t last_stat_request_cnt_;
 };
 
 int ObSqlNio::start(int port, ObISqlSockHandler* handler, int n_thread)
@@ -945,10 +973,33 @@ int ObSqlNio::write_data(void* sess, const char* buf, int64_t sz)
 
 void ObSqlNio::async_write_data(void* sess, const char* buf, int64_t sz)
 {
+  int ret = OB_SUCCESS;
   ObSqlSock* sock = sess2sock(sess);
-  sock->init_write_task(buf, sz);
+  if (NULL != buf && OB_FAIL(sock->append_write_task(buf, sz))) {
+    LOG_ERROR("append write task fail", K(ret), K(*sock));
+    sock->set_shutdown();
+  }
   sock->get_nio_impl().push_write_req(sock);
 }
 
+void ObSqlNio::peek_buffered_data(void* sess, const char*& buf, int64_t& sz)
+{
+  sess2sock(sess)->peek_buffered_data(buf, sz);
+}
+
+bool ObSqlNio::try_write_data(void* sess, const char* buf, int64_t sz)
+{
+  int ret = OB_SUCCESS;
+  bool become_clean = false;
+  ObSqlSock* sock = sess2sock(sess);
+  if (OB_FAIL(sock->try_write_data(buf, sz, become_clean))) {
+    LOG_WARN("try write data fail", K(ret), K(*sock));
+    sock->set_shutdown();
+  } else if (become_clean) {
+    sock->get_stat().inc_direct_write();
+  }
+  return become_clean;
+}
+
 }; // end namespace obmysql
 }; // end namespace oceanbase
@@ -34,7 +34,12 @@ public:
   int peek_data(void* sess, int64_t limit, const char*& buf, int64_t& sz);
   int consume_data(void* sess, int64_t sz);
   int write_data(void* sess, const char* buf, int64_t sz);
+  // buf may be NULL to only flush the pending data
   void async_write_data(void* sess, const char* buf, int64_t sz);
+  void peek_buffered_data(void* sess, const char*& buf, int64_t& sz);
+  // write buf in the calling thread without waiting for EPOLLOUT, return false if
+  // it is not written completely, the rest must be flushed by async_write_data(sess, NULL, 0)
+  bool try_write_data(void* sess, const char* buf, int64_t sz);
   void stop();
   void wait();
   void destroy();
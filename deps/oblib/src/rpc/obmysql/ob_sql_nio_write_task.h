@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_OBMYSQL_OB_SQL_NIO_WRITE_TASK_H_
+#define OCEANBASE_OBMYSQL_OB_SQL_NIO_WRITE_TASK_H_
+#include <errno.h>
+#include <sys/uio.h>
+#include "lib/atomic/ob_atomic.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace obmysql
+{
+// Syscalls issued for the socks of one nio thread, the worker threads handling
+// these socks also count here.
+struct ObSqlNioStat
+{
+  ObSqlNioStat(): read_cnt_(0), write_cnt_(0), epoll_wait_cnt_(0), evfd_signal_cnt_(0),
+                  request_cnt_(0), direct_write_cnt_(0) {}
+  ~ObSqlNioStat() {}
+  void inc_read() { ATOMIC_INC(&read_cnt_); }
+  void inc_write() { ATOMIC_INC(&write_cnt_); }
+  void inc_epoll_wait() { ATOMIC_INC(&epoll_wait_cnt_); }
+  void inc_evfd_signal() { ATOMIC_INC(&evfd_signal_cnt_); }
+  void inc_request() { ATOMIC_INC(&request_cnt_); }
+  void inc_direct_write() { ATOMIC_INC(&direct_write_cnt_); }
+  int64_t get_syscall_cnt() const
+  {
+    return ATOMIC_LOAD(&read_cnt_) + ATOMIC_LOAD(&write_cnt_)
+        + ATOMIC_LOAD(&epoll_wait_cnt_) + ATOMIC_LOAD(&evfd_signal_cnt_);
+  }
+  TO_STRING_KV(K_(read_cnt), K_(write_cnt), K_(epoll_wait_cnt), K_(evfd_signal_cnt),
+               K_(request_cnt), K_(direct_write_cnt));
+  int64_t read_cnt_;
+  int64_t write_cnt_;
+  int64_t epoll_wait_cnt_;
+  int64_t evfd_signal_cnt_;
+  int64_t request_cnt_;
+  // responses written by the worker thread before it handles the pipelined request
+  int64_t direct_write_cnt_;
+};
+
+// Response buffers waiting to be written, they are written by one writev in order.
+class PendingWriteTask
+{
+public:
+  enum { MAX_IOV_CNT = 16 };
+  PendingWriteTask(): iov_cnt_(0), iov_idx_(0), sz_(0) {}
+  ~PendingWriteTask() {}
+  void reset() {
+    iov_cnt_ = 0;
+    iov_idx_ = 0;
+    sz_ = 0;
+  }
+  bool is_empty() const { return iov_idx_ >= iov_cnt_; }
+  bool is_full() const { return iov_cnt_ >= MAX_IOV_CNT; }
+  int64_t get_size() const { return sz_; }
+  int append(const char* buf, int64_t sz) {
+    int ret = common::OB_SUCCESS;
+    if (is_full()) {
+      ret = common::OB_SIZE_OVERFLOW;
+      RPC_OBMYSQL_LOG(WARN, "too many pending write buffers", K(ret), K_(iov_cnt), K_(sz));
+    } else {
+      iov_[iov_cnt_].iov_base = (void*)buf;
+      iov_[iov_cnt_].iov_len = sz;
+      iov_cnt_++;
+      sz_ += sz;
+    }
+    return ret;
+  }
+  // write until all the buffers are written or the fd returns EAGAIN
+  int try_write(int fd, bool& become_clean, ObSqlNioStat& stat) {
+    int ret = common::OB_SUCCESS;
+    if (is_empty()) {
+      // no pending task
+    } else {
+      while(!is_empty() && common::OB_SUCCESS == ret) {
+        int64_t wbytes = 0;
+        stat.inc_write();
+        if ((wbytes = writev(fd, iov_ + iov_idx_, iov_cnt_ - iov_idx_)) >= 0) {
+          consume(wbytes);
+        } else if (EAGAIN == errno || EWOULDBLOCK == errno) {
+          RPC_OBMYSQL_LOG(INFO, "write return EAGAIN");
+          break;
+        } else if (EINTR == errno) {
+          // pass
+        } else {
+          ret = common::OB_IO_ERROR;
+          RPC_OBMYSQL_LOG(WARN, "write data error", K(errno));
+        }
+      }
+      if (common::OB_SUCCESS == ret && is_empty()) {
+        become_clean = true;
+        reset();
+      }
+    }
+    return ret;
+  }
+private:
+  void consume(int64_t sz) {
+    while(sz > 0 && !is_empty()) {
+      struct iovec& iov = iov_[iov_idx_];
+      if (sz >= (int64_t)iov.iov_len) {
+        sz -= iov.iov_len;
+        sz_ -= iov.iov_len;
+        iov_idx_++;
+      } else {
+        iov.iov_base = (char*)iov.iov_base + sz;
+        iov.iov_len -= sz;
+        sz_ -= sz;
+        sz = 0;
+      }
+    }
+  }
+private:
+  struct iovec iov_[MAX_IOV_CNT];
+  int64_t iov_cnt_;
+  int64_t iov_idx_;
+  int64_t sz_;
+};
+
+}; // end namespace obmysql
+}; // end namespace oceanbase
+
+#endif /* OCEANBASE_OBMYSQL_OB_SQL_NIO_WRITE_TASK_H_ */
@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX RPC_OBMYSQL
 #include "rpc/obmysql/ob_sql_sock_session.h"
 #include "rpc/obmysql/ob_sql_nio.h"
+#include "rpc/obmysql/ob_mysql_util.h"
 
 namespace oceanbase
 {
@@ -78,13 +79,42 @@ void ObSqlSockSession::revert_sock()
     int64_t sz = pending_write_sz_;
     pending_write_buf_ = NULL;
     pending_write_sz_ = 0;
-    nio_.async_write_data((void*)this, data, sz);
+    if (!has_buffered_request_()) {
+      nio_.async_write_data((void*)this, data, sz);
+    } else if (nio_.try_write_data((void*)this, data, sz)) {
+      // the client has pipelined the next request, the response has been written before
+      // handling it, so it never waits for the next request, and the nio thread is not
+      // woken up to write the response
+      pool_.reuse();
+      nio_.revert_sock((void*)this);
+    } else {
+      // the sock is not writable now, the nio thread writes the rest on EPOLLOUT
+      nio_.async_write_data((void*)this, NULL, 0);
+    }
   } else {
     pool_.reuse();
     nio_.revert_sock((void*)this);
   }
 }
 
+bool ObSqlSockSession::has_buffered_request_()
+{
+  bool bret = false;
+  const char* buf = NULL;
+  int64_t sz = 0;
+  if (conn_.is_in_authed_phase()) {
+    const int64_t header_sz = OB_MYSQL_CS_TYPE == conn_.get_cs_protocol_type()
+        ? OB_MYSQL_HEADER_LENGTH : OB_MYSQL_COMPRESSED_HEADER_SIZE;
+    nio_.peek_buffered_data((void*)this, buf, sz);
+    if (sz >= header_sz) {
+      uint32_t pkt_len = 0;
+      ObMySQLUtil::get_uint3(buf, pkt_len);
+      bret = (sz >= header_sz + pkt_len);
+    }
+  }
+  return bret;
+}
+
 void ObSqlSockSession::on_flushed()
 {
   /* TODO should not go here*/
@@ -59,6 +59,9 @@ public:
   int on_disconnect();
   void clear_sql_session_info();
   void set_sql_session_info(void* sess);
+private:
+  bool has_buffered_request_();
+public:
   ObSqlNio& nio_;
   ObISMConnectionCallback& sm_conn_cb_;
   rpc::ObRequest sql_req_;
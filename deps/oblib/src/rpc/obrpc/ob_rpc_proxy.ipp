@@ -621,6 +621,7 @@ int ObRpcProxy::rpc_post(const typename pcodeStruct::Request &args,
 
   bool need_compressed = ObCompressorPool::get_instance().need_common_compress(compressor_type_);
   char *serialize_buf = NULL;
+  int64_t serialize_len = 0;
   common::ObCompressor *compressor = NULL;
   bool use_context = false;
   bool has_trace_info = false;
@@ -665,6 +666,7 @@ int ObRpcProxy::rpc_post(const typename pcodeStruct::Request &args,
       // source data length plus max overflow size is the maximum
       // possible size of compressed data.
       if (OB_SUCC(ret)) {
+        serialize_len = tmp_pos;
         payload += max_overflow_size;
       }
     }
@@ -688,11 +690,14 @@ int ObRpcProxy::rpc_post(const typename pcodeStruct::Request &args,
     } else if (NULL == req.pkt()) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
       RPC_OBRPC_LOG(WARN, "request packet is NULL", K(ret));
-    } else if (use_context) {
-      req.pkt()->set_has_context();
-      req.pkt()->set_disable_debugsync();
-    } else if (has_trace_info) {
-      req.pkt()->set_has_trace_info();
+    } else {
+      if (use_context) {
+        req.pkt()->set_has_context();
+        req.pkt()->set_disable_debugsync();
+      }
+      if (has_trace_info) {
+        req.pkt()->set_has_trace_info();
+      }
     }
     timeguard.click();
   }
@@ -722,7 +727,13 @@ int ObRpcProxy::rpc_post(const typename pcodeStruct::Request &args,
       }
     }
 
-    if (!need_compressed) {
+    if (!need_compressed && NULL != serialize_buf) {
+      // args and extra payload are serialized already, large messages such as DTL
+      // buffers are not worth encoding twice when the compression does not help
+      MEMCPY(req.buf(), serialize_buf, serialize_len);
+      pos = serialize_len;
+      req.pkt_->set_content(req.buf(), pos);
+    } else if (!need_compressed) {
       if (OB_FAIL(common::serialization::encode(req.buf(), payload, pos, args))) {
         RPC_OBRPC_LOG(WARN, "serialize argument fail", K(ret));
       } else if (OB_FAIL(fill_extra_payload(req, payload, pos))) {
@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "lib/utility/utility.h"
+#include "lib/ob_define.h"
+#include "lib/utility/ob_print_utils.h"
+#include "lib/metrics/ob_log2_histogram.h"
+#include <gtest/gtest.h>
+using namespace oceanbase::common;
+
+TEST(ObLog2Histogram, bucket_idx)
+{
+  ASSERT_EQ(0, ObLog2Histogram::get_bucket_idx(-1));
+  ASSERT_EQ(0, ObLog2Histogram::get_bucket_idx(0));
+  ASSERT_EQ(1, ObLog2Histogram::get_bucket_idx(1));
+  ASSERT_EQ(2, ObLog2Histogram::get_bucket_idx(2));
+  ASSERT_EQ(2, ObLog2Histogram::get_bucket_idx(3));
+  ASSERT_EQ(3, ObLog2Histogram::get_bucket_idx(4));
+  ASSERT_EQ(11, ObLog2Histogram::get_bucket_idx(1024));
+  ASSERT_EQ(ObLog2Histogram::BUCKET_NUM - 1, ObLog2Histogram::get_bucket_idx(INT64_MAX));
+  for (int64_t i = 1; i < ObLog2Histogram::BUCKET_NUM - 1; i++) {
+    const int64_t upper = ObLog2Histogram::get_bucket_upper_bound(i);
+    ASSERT_EQ(i, ObLog2Histogram::get_bucket_idx(upper - 1));
+    ASSERT_EQ(i + 1, ObLog2Histogram::get_bucket_idx(upper));
+  }
+}
+
+TEST(ObLog2Histogram, add_and_percentile)
+{
+  ObLog2Histogram hist;
+  ASSERT_EQ(0, hist.get_total_count());
+  ASSERT_EQ(0, hist.get_percentile(99));
+  for (int64_t i = 0; i < 99; i++) {
+    hist.add(10);
+  }
+  hist.add(5000);
+  ASSERT_EQ(100, hist.get_total_count());
+  ASSERT_EQ(99 * 10 + 5000, hist.get_total_value());
+  ASSERT_EQ(99, hist.get_bucket_count(ObLog2Histogram::get_bucket_idx(10)));
+  ASSERT_EQ(16, hist.get_percentile(50));
+  ASSERT_EQ(16, hist.get_percentile(99));
+  ASSERT_EQ(8192, hist.get_percentile(100));
+  hist.reset();
+  ASSERT_EQ(0, hist.get_total_count());
+  ASSERT_EQ(0, hist.get_bucket_count(ObLog2Histogram::get_bucket_idx(10)));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX RPC_TEST
+
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "rpc/obmysql/ob_sql_nio_write_task.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::obmysql;
+
+class TestSqlNioWriteTask
+    : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds_));
+    ASSERT_EQ(0, fcntl(fds_[0], F_SETFL, fcntl(fds_[0], F_GETFL) | O_NONBLOCK));
+    ASSERT_EQ(0, fcntl(fds_[1], F_SETFL, fcntl(fds_[1], F_GETFL) | O_NONBLOCK));
+  }
+  virtual void TearDown()
+  {
+    close(fds_[0]);
+    if (fds_[1] >= 0) {
+      close(fds_[1]);
+    }
+  }
+protected:
+  // read all the data which can be read now
+  void read_all(char *buf, const int64_t len, int64_t &pos)
+  {
+    int64_t rbytes = 0;
+    while (pos < len && (rbytes = read(fds_[1], buf + pos, len - pos)) > 0) {
+      pos += rbytes;
+    }
+  }
+protected:
+  int fds_[2];
+};
+
+TEST_F(TestSqlNioWriteTask, write_in_order)
+{
+  PendingWriteTask task;
+  ObSqlNioStat stat;
+  bool become_clean = false;
+  const char *resps[] = {"first", "second", "third"};
+  ASSERT_TRUE(task.is_empty());
+  ASSERT_EQ(OB_SUCCESS, task.try_write(fds_[0], become_clean, stat));
+  ASSERT_FALSE(become_clean);
+  ASSERT_EQ(0, stat.write_cnt_);
+
+  for (int64_t i = 0; i < 3; i++) {
+    ASSERT_EQ(OB_SUCCESS, task.append(resps[i], strlen(resps[i])));
+  }
+  ASSERT_EQ(16, task.get_size());
+  ASSERT_EQ(OB_SUCCESS, task.try_write(fds_[0], become_clean, stat));
+  ASSERT_TRUE(become_clean);
+  ASSERT_TRUE(task.is_empty());
+  ASSERT_EQ(0, task.get_size());
+  // all the buffers are written by one writev
+  ASSERT_EQ(1, stat.write_cnt_);
+
+  char buf[64];
+  int64_t pos = 0;
+  read_all(buf, sizeof(buf), pos);
+  ASSERT_EQ(16, pos);
+  ASSERT_EQ(0, MEMCMP("firstsecondthird", buf, pos));
+}
+
+TEST_F(TestSqlNioWriteTask, write_after_eagain)
+{
+  const int64_t resp_size = 256 * 1024;
+  const int64_t resp_cnt = 8;
+  const int64_t total_size = resp_size * resp_cnt;
+  int sndbuf = 4096;
+  ASSERT_EQ(0, setsockopt(fds_[0], SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf)));
+  char *data = new char[total_size];
+  char *recv_buf = new char[total_size];
+  for (int64_t i = 0; i < total_size; i++) {
+    data[i] = static_cast<char>(i % 251);
+  }
+
+  PendingWriteTask task;
+  ObSqlNioStat stat;
+  bool become_clean = false;
+  for (int64_t i = 0; i < resp_cnt; i++) {
+    ASSERT_EQ(OB_SUCCESS, task.append(data + i * resp_size, resp_size));
+  }
+  // the fd returns EAGAIN, the rest is kept
+  ASSERT_EQ(OB_SUCCESS, task.try_write(fds_[0], become_clean, stat));
+  ASSERT_FALSE(become_clean);
+  ASSERT_FALSE(task.is_empty());
+  ASSERT_LT(task.get_size(), total_size);
+
+  // the peer reads, then the rest is written from where it stopped
+  int64_t pos = 0;
+  while (!become_clean) {
+    read_all(recv_buf, total_size, pos);
+    ASSERT_EQ(OB_SUCCESS, task.try_write(fds_[0], become_clean, stat));
+  }
+  read_all(recv_buf, total_size, pos);
+  ASSERT_EQ(total_size, pos);
+  ASSERT_EQ(0, MEMCMP(data, recv_buf, total_size));
+  ASSERT_TRUE(task.is_empty());
+  delete [] data;
+  delete [] recv_buf;
+}
+
+TEST_F(TestSqlNioWriteTask, full_and_error)
+{
+  PendingWriteTask task;
+  ObSqlNioStat stat;
+  bool become_clean = false;
+  const char *resp = "x";
+  for (int64_t i = 0; i < PendingWriteTask::MAX_IOV_CNT; i++) {
+    ASSERT_EQ(OB_SUCCESS, task.append(resp, 1));
+  }
+  ASSERT_TRUE(task.is_full());
+  ASSERT_EQ(OB_SIZE_OVERFLOW, task.append(resp, 1));
+
+  // the peer is closed
+  close(fds_[1]);
+  fds_[1] = -1;
+  ASSERT_EQ(OB_IO_ERROR, task.try_write(fds_[0], become_clean, stat));
+  ASSERT_FALSE(become_clean);
+}
+
+int main(int argc, char *argv[])
+{
+  signal(SIGPIPE, SIG_IGN);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -413,6 +413,8 @@ int ObCDCPartTransResolver::handle_redo_(
   transaction::ObTxRedoLogTempRef tmp_ref;
   transaction::ObTxRedoLog redo_log(tmp_ref);
   PartTransTask *task = NULL;
+  const char *mutator_buf = NULL;
+  char *redo_copy = NULL;
 
   if (OB_FAIL(tx_log_block.deserialize_log_body(redo_log))) {
     LOG_ERROR("deserialize_redo_log_body failed", KR(ret), K_(tls_id), K(tx_id), K(lsn));
@@ -424,11 +426,26 @@ int ObCDCPartTransResolver::handle_redo_(
         K(handling_miss_log));
   } else if (OB_FAIL(push_fetched_log_entry_(lsn, *task))) {
     LOG_ERROR("push_fetched_log_entry failed", KR(ret), K_(tls_id), K(tx_id), K(lsn), KPC(task));
+  } else if (! tx_log_block.is_decompressed()) {
+    mutator_buf = redo_log.get_replay_mutator_buf();
+  // The decompressed buf is released with tx_log_block, while the redo data is referenced by
+  // the store task of PartTransTask, so copy it into the task.
+  } else if (OB_ISNULL(redo_copy = static_cast<char *>(task->get_allocator().alloc(
+      redo_log.get_mutator_size())))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_ERROR("alloc memory for decompressed redo fail", KR(ret), K_(tls_id), K(tx_id), K(lsn),
+        K(redo_log));
+  } else {
+    MEMCPY(redo_copy, redo_log.get_replay_mutator_buf(), redo_log.get_mutator_size());
+    mutator_buf = redo_copy;
+  }
+
+  if (OB_FAIL(ret)) {
   } else if (OB_FAIL(task->push_redo_log(
       tx_id,
       lsn,
       submit_ts,
-      redo_log.get_replay_mutator_buf(),
+      mutator_buf,
       redo_log.get_mutator_size()))) {
     if (OB_ENTRY_EXIST == ret) {
       LOG_DEBUG("redo_log duplication", KR(ret), K_(tls_id), K(tx_id), K(lsn), K(submit_ts),
@@ -489,6 +489,15 @@ public:
   // 2. When configured on, the timestamp field is synchronized to integer
   T_DEF_BOOL(enable_convert_timestamp_to_unix_timestamp, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
 
+  // Whether to output the value of fixed length types in binary instead of string
+  // 1. off by default, all values are converted to string.
+  // 2. When configured on, the value of int/uint/float/double/date/datetime/timestamp/time/year
+  //    columns is output as the binary value in host byte order, and the consumers decode it by
+  //    the column type, string columns always point to the original string.
+  //    enable_convert_timestamp_to_unix_timestamp takes precedence for timestamp columns.
+  //    Not supported with enable_hbase_mode unless enable_backup_mode is on.
+  T_DEF_BOOL(enable_output_binary_value, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
+
   // Whether to output invisible columns externally
   // 1. DRC link is off by default; if valid, output hidden primary key
   // 2. Backup is on by default
@@ -506,6 +515,11 @@ public:
   // enable_oracle_mode_match_case_sensitive=1 allow match sensitive
   T_DEF_BOOL(enable_oracle_mode_match_case_sensitive, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
 
+  // Stmts of a redo log entry of a large transaction are formatted by batches of this count in
+  // parallel, the redo log entry with fewer stmts is formatted by one formatter thread
+  // 0 (default) means all stmts of a redo log entry are formatted by one formatter thread
+  T_DEF_INT_INFT(formatter_batch_stmt_count, OB_CLUSTER_PARAMETER, 0, 0, "formatter batch stmt count");
+
    // Switch: Whether to format the module to print the relevant logs
   // No printing by default
   T_DEF_BOOL(enable_formatter_print_log, OB_CLUSTER_PARAMETER, 0, "0:disabled, 1:enabled");
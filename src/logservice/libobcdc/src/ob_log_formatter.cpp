@@ -95,8 +95,8 @@ ObLogFormatter::ObLogFormatter() : inited_(false),
                                    hbase_util_(NULL),
                                    skip_hbase_mode_put_column_count_not_consistency_(false),
                                    enable_output_hidden_primary_key_(false),
-                                   log_entry_task_count_(0)
-
+                                   log_entry_task_count_(0),
+                                   batch_stmt_count_(0)
 {
 }
 
@@ -118,7 +118,8 @@ int ObLogFormatter::init(const int64_t thread_num,
       const bool enable_hbase_mode,
       ObLogHbaseUtil &hbase_util,
       const bool skip_hbase_mode_put_column_count_not_consistency,
-      const bool enable_output_hidden_primary_key)
+      const bool enable_output_hidden_primary_key,
+      const int64_t batch_stmt_count)
 {
   int ret = OB_SUCCESS;
 
@@ -133,9 +134,10 @@ int ObLogFormatter::init(const int64_t thread_num,
       || OB_ISNULL(meta_manager)
       || OB_ISNULL(schema_getter)
       || OB_ISNULL(storager)
-      || OB_ISNULL(err_handler)) {
+      || OB_ISNULL(err_handler)
+      || OB_UNLIKELY(batch_stmt_count < 0)) {
     LOG_ERROR("invalid arguments", K(thread_num), K(queue_size), K(working_mode), K(obj2str_helper),
-        K(meta_manager), K(schema_getter), K(storager), K(err_handler));
+        K(meta_manager), K(schema_getter), K(storager), K(err_handler), K(batch_stmt_count));
     ret = OB_INVALID_ARGUMENT;
   } else if (OB_FAIL(FormatterThread::init(thread_num, queue_size))) {
     LOG_ERROR("init formatter queue thread fail", KR(ret), K(thread_num), K(queue_size));
@@ -156,9 +158,10 @@ int ObLogFormatter::init(const int64_t thread_num,
     skip_hbase_mode_put_column_count_not_consistency_ = skip_hbase_mode_put_column_count_not_consistency;
     enable_output_hidden_primary_key_ = enable_output_hidden_primary_key;
     log_entry_task_count_ = 0;
+    batch_stmt_count_ = batch_stmt_count;
     inited_ = true;
     LOG_INFO("Formatter init succ", K(working_mode_), "working_mode", print_working_mode(working_mode_),
-        K(thread_num), K(queue_size));
+        K(thread_num), K(queue_size), K(batch_stmt_count));
   }
 
   return ret;
@@ -187,6 +190,7 @@ void ObLogFormatter::destroy()
   skip_hbase_mode_put_column_count_not_consistency_ = false;
   enable_output_hidden_primary_key_ = false;
   log_entry_task_count_ = 0;
+  batch_stmt_count_ = 0;
 }
 
 int ObLogFormatter::start()
@@ -224,14 +228,24 @@ int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
     LOG_ERROR("invalid arguments", K(stmt_task));
     ret = OB_INVALID_ARGUMENT;
   } else {
-    // Ensure that all stmt of ObLogEntryTask are pushed to the same queue
-    const uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
+    // Ensure that all stmt of ObLogEntryTask are pushed to the same queue, except for the
+    // ObLogEntryTask of a large transaction which has more stmts than batch_stmt_count_, whose
+    // stmts are pushed to the queues batch by batch to be formatted in parallel.
+    //
+    // The output order does not depend on the formatting order: the last formatted stmt links the
+    // rows of ObLogEntryTask in stmt order, see finish_format_.
+    const int64_t batch_stmt_count = get_batch_stmt_count_(*stmt_task);
+    uint64_t hash_value = ATOMIC_FAA(&round_value_, 1);
     int64_t stmt_count = 0;
 
     while (OB_SUCC(ret) && NULL != stmt_task) {
       IStmtTask *next = stmt_task->get_next();
       void *push_task = static_cast<void *>(stmt_task);
 
+      if (batch_stmt_count > 0 && stmt_count > 0 && 0 == stmt_count % batch_stmt_count) {
+        hash_value = ATOMIC_FAA(&round_value_, 1);
+      }
+
       RETRY_FUNC(stop_flag, *(static_cast<ObMQThread *>(this)), push, push_task, hash_value, DATA_OP_TIMEOUT);
 
       if (OB_SUCC(ret)) {
@@ -252,6 +266,21 @@ int ObLogFormatter::push(IStmtTask *stmt_task, volatile bool &stop_flag)
   return ret;
 }
 
+int64_t ObLogFormatter::get_batch_stmt_count_(IStmtTask &stmt_task)
+{
+  int64_t batch_stmt_count = ATOMIC_LOAD(&batch_stmt_count_);
+  DmlStmtTask *dml_stmt_task = dynamic_cast<DmlStmtTask *>(&stmt_task);
+
+  if (batch_stmt_count <= 0 || get_thread_num() <= 1 || OB_ISNULL(dml_stmt_task)) {
+    batch_stmt_count = 0;
+  } else if (dml_stmt_task->get_redo_log_entry_task().get_stmt_num() <= batch_stmt_count) {
+    // small ObLogEntryTask, all stmts are formatted by one thread
+    batch_stmt_count = 0;
+  }
+
+  return batch_stmt_count;
+}
+
 int ObLogFormatter::push_single_task(IStmtTask *stmt_task, volatile bool &stop_flag)
 {
   int ret = OB_SUCCESS;
@@ -295,6 +324,13 @@ int ObLogFormatter::get_task_count(int64_t &br_count,
   return ret;
 }
 
+void ObLogFormatter::configure(const ObLogConfig &config)
+{
+  const int64_t formatter_batch_stmt_count = config.formatter_batch_stmt_count;
+  ATOMIC_STORE(&batch_stmt_count_, formatter_batch_stmt_count);
+  LOG_INFO("[CONFIG]", K(formatter_batch_stmt_count));
+}
+
 int ObLogFormatter::handle(void *data, const int64_t thread_index, volatile bool &stop_flag)
 {
   int ret = OB_SUCCESS;
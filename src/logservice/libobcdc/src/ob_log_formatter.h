@@ -38,6 +38,8 @@ class ObString;
 
 namespace libobcdc
 {
+class ObLogConfig;
+
 /////////////////////////////////////////////////////////////////////////////////////////
 // IObLogFormatter
 
@@ -61,6 +63,7 @@ public:
   virtual int push(IStmtTask *task, volatile bool &stop_flag) = 0;
   virtual int push_single_task(IStmtTask *task, volatile bool &stop_flag) = 0;
   virtual int get_task_count(int64_t &br_count, int64_t &log_entry_task_count) = 0;
+  virtual void configure(const ObLogConfig &config) = 0;
 };
 
 
@@ -92,6 +95,7 @@ public:
   int push_single_task(IStmtTask *task, volatile bool &stop_flag);
   int get_task_count(int64_t &br_count,
       int64_t &log_entry_task_count);
+  void configure(const ObLogConfig &config);
   int handle(void *data, const int64_t thread_index, volatile bool &stop_flag);
 
 public:
@@ -108,7 +112,8 @@ public:
       const bool enable_hbase_mode,
       ObLogHbaseUtil &hbase_util,
       const bool skip_hbase_mode_put_column_count_not_consistency,
-      const bool enable_output_hidden_primary_key);
+      const bool enable_output_hidden_primary_key,
+      const int64_t batch_stmt_count);
   void destroy();
 
 private:
@@ -139,6 +144,8 @@ private:
       const TableSchemaType &table_schema);
   int init_row_value_array_(const int64_t row_value_num);
   void destroy_row_value_array_();
+  // 0 means that all stmts starting from stmt_task are pushed to the same queue
+  int64_t get_batch_stmt_count_(IStmtTask &stmt_task);
   int set_meta_info_(
       const uint64_t tenant_id,
       const int64_t global_schema_version,
@@ -259,6 +266,10 @@ private:
   bool                       skip_hbase_mode_put_column_count_not_consistency_;
   bool                       enable_output_hidden_primary_key_;
   int64_t                    log_entry_task_count_;
+  // The stmts of a ObLogEntryTask are formatted by one thread, unless the ObLogEntryTask has more
+  // stmts than batch_stmt_count_, then they are split into batches of batch_stmt_count_ stmts and
+  // the batches are formatted by different threads. 0 means never split.
+  int64_t                    batch_stmt_count_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogFormatter);
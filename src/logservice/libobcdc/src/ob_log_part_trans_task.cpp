@@ -1657,7 +1657,8 @@ ObLogEntryTask::ObLogEntryTask() :
     stmt_list_(),
     formatted_stmt_num_(0),
     row_ref_cnt_(0),
-    arena_allocator_("LogEntryTask", OB_MALLOC_MIDDLE_BLOCK_SIZE)
+    arena_allocator_("LogEntryTask", OB_MALLOC_MIDDLE_BLOCK_SIZE),
+    allocator_(arena_allocator_)
 {
 }
 
@@ -1678,7 +1679,7 @@ void ObLogEntryTask::reset()
   formatted_stmt_num_ = 0;
   row_ref_cnt_ = 0;
 
-  arena_allocator_.clear();
+  allocator_.clear();
 }
 
 bool ObLogEntryTask::is_valid() const
@@ -1800,7 +1801,7 @@ void *ObLogEntryTask::alloc(const int64_t size)
   void *alloc_ret = NULL;
 
   if (size > 0) {
-    alloc_ret = arena_allocator_.alloc(size);
+    alloc_ret = allocator_.alloc(size);
   }
 
   return alloc_ret;
@@ -1809,7 +1810,7 @@ void *ObLogEntryTask::alloc(const int64_t size)
 // NOTE: For ObArenaAllocator: virtual void free(void *ptr) do nothing
 void ObLogEntryTask::free(void *ptr)
 {
-  arena_allocator_.free(ptr);
+  allocator_.free(ptr);
   ptr = NULL;
 }
 
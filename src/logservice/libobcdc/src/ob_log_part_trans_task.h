@@ -18,6 +18,7 @@
 #include "lib/queue/ob_link.h"                      // ObLink
 #include "lib/atomic/ob_atomic.h"                   // ATOMIC_LOAD
 #include "lib/lock/ob_small_spin_lock.h"            // ObByteLock
+#include "lib/allocator/page_arena.h"               // ObArenaAllocator, ObSafeArenaAllocator
 #include "common/object/ob_object.h"                // ObObj
 #include "common/ob_queue_thread.h"                 // ObCond
 #include "ob_cdc_tablet_to_table_info.h"            // ObCDCTabletChangeInfo
@@ -641,7 +642,7 @@ public:
 
   int get_valid_row_num(int64_t &valid_row_num);
 
-  common::ObIAllocator &get_allocator() { return arena_allocator_; }
+  common::ObIAllocator &get_allocator() { return allocator_; }
   void *alloc(const int64_t size);
   void free(void *ptr);
 
@@ -698,9 +699,11 @@ private:
   int64_t            formatted_stmt_num_;   // Number of statements that formatted
   int64_t            row_ref_cnt_;          // reference count
 
-  // Non-thread safe allocator
   // used for Parser/Formatter
-  common::ObArenaAllocator arena_allocator_;          // allocator
+  // The stmts of a large ObLogEntryTask are formatted by several formatter threads at the same
+  // time, so the arena is only used through the thread safe allocator_
+  common::ObArenaAllocator arena_allocator_;
+  common::ObSafeArenaAllocator allocator_;            // allocator
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObLogEntryTask);
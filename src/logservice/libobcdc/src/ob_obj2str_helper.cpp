@@ -39,6 +39,7 @@ ObObj2strHelper::ObObj2strHelper() : inited_(false),
                                      enable_hbase_mode_(false),
                                      enable_convert_timestamp_to_unix_timestamp_(false),
                                      enable_backup_mode_(false),
+                                     enable_output_binary_value_(false),
                                      tenant_mgr_(NULL)
 {
 }
@@ -53,12 +54,19 @@ int ObObj2strHelper::init(IObLogTimeZoneInfoGetter &timezone_info_getter,
     const bool enable_hbase_mode,
     const bool enable_convert_timestamp_to_unix_timestamp,
     const bool enable_backup_mode,
+    const bool enable_output_binary_value,
     IObLogTenantMgr &tenant_mgr)
 {
   int ret = OB_SUCCESS;
 
   if (inited_) {
     ret = OB_INIT_TWICE;
+  } else if (OB_UNLIKELY(enable_output_binary_value && enable_hbase_mode && ! enable_backup_mode)) {
+    // The T column of hbase table is converted to positive by its string, which is not supported
+    // for the binary value
+    ret = OB_NOT_SUPPORTED;
+    OBLOG_LOG(ERROR, "enable_output_binary_value is not supported in hbase mode", KR(ret),
+        K(enable_output_binary_value), K(enable_hbase_mode), K(enable_backup_mode));
   } else if (OB_FAIL(init_ob_charset_utils())) {
     OBLOG_LOG(ERROR, "failed to init ob charset util!", KR(ret));
   } else {
@@ -67,6 +75,7 @@ int ObObj2strHelper::init(IObLogTimeZoneInfoGetter &timezone_info_getter,
     enable_hbase_mode_ = enable_hbase_mode;
     enable_convert_timestamp_to_unix_timestamp_ = enable_convert_timestamp_to_unix_timestamp;
     enable_backup_mode_ = enable_backup_mode;
+    enable_output_binary_value_ = enable_output_binary_value;
     tenant_mgr_ = &tenant_mgr;
     inited_ = true;
   }
@@ -103,6 +112,7 @@ void ObObj2strHelper::destroy()
   enable_hbase_mode_ = false;
   enable_convert_timestamp_to_unix_timestamp_ = false;
   enable_backup_mode_ = false;
+  enable_output_binary_value_ = false;
   tenant_mgr_ = NULL;
 }
 
@@ -123,6 +133,7 @@ int ObObj2strHelper::obj2str(const uint64_t tenant_id,
   ObObjType obj_type = obj.get_type();
   common::ObObjTypeClass obj_tc = common::ob_obj_type_class(obj_type);
   lib::Worker::CompatMode compat_mode = THIS_WORKER.get_compatibility_mode();
+  const int64_t binary_value_len = enable_output_binary_value_ ? get_binary_value_len_(obj_type) : 0;
 
   // Configure allowed conversions: mysql timestamp column -> UTC integer time
   if (ObTimestampType == obj_type && enable_convert_timestamp_to_unix_timestamp_) {
@@ -132,6 +143,11 @@ int ObObj2strHelper::obj2str(const uint64_t tenant_id,
     }
   } else if (common::ObNullTC == obj_tc) {
     str.assign_ptr(NULL, 0);
+  } else if (binary_value_len > 0) {
+    if (OB_FAIL(convert_obj_to_binary_value_(obj, binary_value_len, str, allocator, string_deep_copy))) {
+      OBLOG_LOG(ERROR, "convert_obj_to_binary_value_ fail", KR(ret), K(table_id), K(column_id), K(obj),
+          K(binary_value_len));
+    }
   } else if (common::ObExtendTC == obj_tc) {
     static const int64_t MAX_EXT_PRINT_LEN = 1 << 10;
     char BUFFER[MAX_EXT_PRINT_LEN];
@@ -430,6 +446,64 @@ int ObObj2strHelper::convert_mysql_timestamp_to_utc_(const common::ObObj &obj,
   return ret;
 }
 
+int64_t ObObj2strHelper::get_binary_value_len_(const common::ObObjType obj_type) const
+{
+  int64_t value_len = 0;
+
+  switch (common::ob_obj_type_class(obj_type)) {
+    case common::ObIntTC:
+    case common::ObUIntTC:
+    case common::ObDoubleTC:
+    case common::ObDateTimeTC:
+    case common::ObTimeTC:
+      value_len = sizeof(int64_t);
+      break;
+    case common::ObFloatTC:
+      value_len = sizeof(float);
+      break;
+    case common::ObDateTC:
+      value_len = sizeof(int32_t);
+      break;
+    case common::ObYearTC:
+      value_len = sizeof(uint8_t);
+      break;
+    default:
+      value_len = 0;
+      break;
+  }
+
+  return value_len;
+}
+
+int ObObj2strHelper::convert_obj_to_binary_value_(const common::ObObj &obj,
+    const int64_t value_len,
+    common::ObString &str,
+    common::ObIAllocator &allocator,
+    const bool deep_copy) const
+{
+  int ret = OB_SUCCESS;
+  const char *value_ptr = static_cast<const char *>(obj.get_data_ptr());
+
+  if (OB_ISNULL(value_ptr) || OB_UNLIKELY(value_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    OBLOG_LOG(ERROR, "invalid argument", KR(ret), K(obj), K(value_len));
+  } else if (! deep_copy) {
+    str.assign_ptr(value_ptr, static_cast<ObString::obstr_size_t>(value_len));
+  } else {
+    char *buf = static_cast<char *>(allocator.alloc(value_len));
+
+    if (OB_ISNULL(buf)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      OBLOG_LOG(ERROR, "allocate memory fail", KR(ret), K(value_len));
+    } else {
+      MEMCPY(buf, value_ptr, value_len);
+      str.assign_ptr(buf, static_cast<ObString::obstr_size_t>(value_len));
+    }
+  }
+
+  return ret;
+}
+
 bool ObObj2strHelper::need_padding_(const lib::Worker::CompatMode &compat_mode,
     const common::ObObj &obj) const
 {
@@ -48,7 +48,14 @@ public:
   //    the string points directly to the content of the original object
   //  2) string_deep_copy == true
   //    deep copy of the string
-  // 2. otherwise use allocator to allocate memory and print the object into memory
+  // 2. If enable_output_binary_value is set and the object is of fixed length type, see
+  //    get_binary_value_len_(), str is the binary value of the object in host byte order
+  //  1) string_deep_copy == false
+  //    the string points directly to the value of the original object
+  //  2) string_deep_copy == true
+  //    deep copy of the value
+  //  not supported with enable_hbase_mode out of backup mode, see init()
+  // 3. otherwise use allocator to allocate memory and print the object into memory
    int obj2str(const uint64_t tenant_id,
        const uint64_t table_id,
        const uint64_t column_id,
@@ -66,6 +73,7 @@ public:
       const bool enable_hbase_mode,
       const bool enable_convert_timestamp_to_unix_timestamp,
       const bool enable_backup_mode,
+      const bool enable_output_binary_value,
       IObLogTenantMgr &tenant_mgr);
   void destroy();
 
@@ -104,6 +112,17 @@ private:
       common::ObString &str,
       common::ObIAllocator &allocator) const;
 
+  // Length of the binary value of the fixed length types, 0 for the other types
+  //   int/uint/double/datetime/timestamp/time: 8 bytes, int64_t/uint64_t/double
+  //   float/date: 4 bytes, float/int32_t
+  //   year: 1 byte, uint8_t
+  int64_t get_binary_value_len_(const common::ObObjType obj_type) const;
+  int convert_obj_to_binary_value_(const common::ObObj &obj,
+      const int64_t value_len,
+      common::ObString &str,
+      common::ObIAllocator &allocator,
+      const bool deep_copy) const;
+
   // Oracle schema: char/nchar with automatic padding support
   // TODO MySQL schema: char/binary supports padding based on specific requirments
   bool need_padding_(const lib::Worker::CompatMode &compat_mode,
@@ -122,6 +141,7 @@ private:
   bool                          enable_hbase_mode_;
   bool                          enable_convert_timestamp_to_unix_timestamp_;
   bool                          enable_backup_mode_;
+  bool                          enable_output_binary_value_;
   IObLogTenantMgr               *tenant_mgr_;
 
 private:
@@ -479,6 +479,28 @@ int ObLogService::update_palf_disk_options(const palf::PalfDiskOptions &disk_opt
   return ret;
 }
 
+int ObLogService::update_log_target_commit_latency(const int64_t target_commit_latency_us)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(palf_env_->update_target_commit_latency(target_commit_latency_us))) {
+    CLOG_LOG(WARN, "update_target_commit_latency failed", K(ret), K(target_commit_latency_us));
+  }
+  return ret;
+}
+
+int ObLogService::update_log_hot_cache_size(const int64_t log_hot_cache_size)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(palf_env_->update_log_hot_cache_size(log_hot_cache_size))) {
+    CLOG_LOG(WARN, "update_log_hot_cache_size failed", K(ret), K(log_hot_cache_size));
+  }
+  return ret;
+}
+
 int ObLogService::update_log_disk_util_threshold(const int64_t log_disk_utilization_threshold,
                                                  const int64_t log_disk_utilization_limit_threshold)
 {
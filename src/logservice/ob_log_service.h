@@ -149,6 +149,8 @@ public:
   int update_replayable_point(const int64_t replayable_point);
   int get_palf_disk_usage(int64_t &used_size_byte, int64_t &total_size_byte);
   int update_palf_disk_options(const palf::PalfDiskOptions &disk_options);
+  int update_log_target_commit_latency(const int64_t target_commit_latency_us);
+  int update_log_hot_cache_size(const int64_t log_hot_cache_size);
   // why we need update 'log_disk_size_' and 'log_disk_util_threshold' separately.
   //
   // 'log_disk_size' is a member of unit config.
@@ -69,6 +69,8 @@ const int64_t LEADER_DEFAULT_GROUP_BUFFER_SIZE = 1 << 25;
 const int64_t MAX_ALLOWED_SKEW_FOR_REF_TS_NS = 3600L * 1000 * 1000 * 1000;          // 1h
 // follower's group buffer size is 8MB larger than leader's.
 const int64_t FOLLOWER_DEFAULT_GROUP_BUFFER_SIZE = LEADER_DEFAULT_GROUP_BUFFER_SIZE + 8 * 1024 * 1024L;
+// recently written log kept in memory for fetching log and iterating.
+const int64_t PALF_HOT_CACHE_SIZE = 8 * 1024 * 1024L;
 const int64_t PALF_RECONFIRM_FETCH_MAX_LSN_INTERVAL = 1 * 1000 * 1000;
 const int64_t PALF_FETCH_LOG_INTERVAL_NS = 2 * 1000 * 1000 * 1000L;                 // 2s
 const int64_t PALF_FETCH_LOG_RENEW_LEADER_INTERVAL_US = 5 * 1000 * 1000;            // 5s
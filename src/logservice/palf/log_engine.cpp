@@ -243,6 +243,19 @@ int LogEngine::load(const int64_t palf_id,
   return ret;
 }
 
+int LogEngine::init_hot_cache(const int64_t cache_size)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (0 >= cache_size) {
+    PALF_LOG(INFO, "hot cache is disabled", K_(palf_id), K(cache_size));
+  } else if (OB_FAIL(log_storage_.init_hot_cache(cache_size))) {
+    PALF_LOG(WARN, "init_hot_cache failed", K(ret), K_(palf_id), K(cache_size));
+  }
+  return ret;
+}
+
 int LogEngine::submit_flush_log_task(const FlushLogCbCtx &flush_log_cb_ctx,
                                      const LogWriteBuf &write_buf)
 {
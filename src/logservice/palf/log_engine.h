@@ -98,6 +98,8 @@ public:
            LogIOWorker *log_io_worker,
            LogGroupEntryHeader &entry_header,
            const int64_t palf_epoch);
+  // the hot cache is optional, palf reads log from disk without it.
+  int init_hot_cache(const int64_t cache_size);
 
   // ==================== Submit async task start ================
   //
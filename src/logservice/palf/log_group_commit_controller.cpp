@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "log_group_commit_controller.h"
+#include "lib/ob_errno.h"                     // OB_SUCCESS
+#include "lib/oblog/ob_log_module.h"          // PALF_LOG
+#include "log_define.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace palf
+{
+LogGroupCommitController::LogGroupCommitController()
+  : target_commit_latency_us_(0),
+    batch_window_us_(0),
+    last_arrival_ts_(OB_INVALID_TIMESTAMP),
+    last_print_ts_(OB_INVALID_TIMESTAMP),
+    io_cost_ema_(EMA_ALPHA),
+    arrival_interval_ema_(EMA_ALPHA),
+    batch_size_hist_(),
+    wait_time_hist_(),
+    io_cost_hist_(),
+    is_inited_(false)
+{
+}
+
+LogGroupCommitController::~LogGroupCommitController()
+{
+  destroy();
+}
+
+int LogGroupCommitController::init(const int64_t target_commit_latency_us)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    PALF_LOG(ERROR, "LogGroupCommitController has been inited", K(ret));
+  } else {
+    target_commit_latency_us_ = target_commit_latency_us;
+    batch_window_us_ = 0;
+    last_arrival_ts_ = OB_INVALID_TIMESTAMP;
+    is_inited_ = true;
+    PALF_LOG(INFO, "LogGroupCommitController init success", K(ret), KPC(this));
+  }
+  return ret;
+}
+
+void LogGroupCommitController::destroy()
+{
+  is_inited_ = false;
+  target_commit_latency_us_ = 0;
+  ATOMIC_STORE(&batch_window_us_, 0);
+  last_arrival_ts_ = OB_INVALID_TIMESTAMP;
+  batch_size_hist_.reset();
+  wait_time_hist_.reset();
+  io_cost_hist_.reset();
+}
+
+void LogGroupCommitController::on_task_arrival(const int64_t arrival_ts)
+{
+  if (IS_INIT) {
+    if (OB_INVALID_TIMESTAMP != last_arrival_ts_ && arrival_ts >= last_arrival_ts_) {
+      const int64_t interval = arrival_ts - last_arrival_ts_;
+      arrival_interval_ema_.update(interval > MAX_ARRIVAL_INTERVAL_US ? MAX_ARRIVAL_INTERVAL_US : interval);
+    }
+    last_arrival_ts_ = arrival_ts;
+  }
+}
+
+void LogGroupCommitController::on_batch_flushed(const int64_t batch_size,
+                                                const int64_t wait_us,
+                                                const int64_t io_cost_us)
+{
+  if (IS_INIT && 0 < batch_size) {
+    io_cost_ema_.update(io_cost_us > 0 ? io_cost_us : 0);
+    batch_size_hist_.add(batch_size);
+    wait_time_hist_.add(wait_us);
+    io_cost_hist_.add(io_cost_us);
+    update_batch_window_();
+    if (palf_reach_time_interval(10 * 1000 * 1000, last_print_ts_)) {
+      PALF_LOG(INFO, "group commit statistics", KPC(this));
+    }
+  }
+}
+
+void LogGroupCommitController::update_batch_window_()
+{
+  const int64_t io_cost = get_avg_io_cost_us();
+  const int64_t arrival_interval = get_avg_arrival_interval_us();
+  const int64_t target_commit_latency_us = get_target_commit_latency_us();
+  int64_t window = 0;
+  if (0 >= target_commit_latency_us
+      || MIN_IO_COST_TO_WAIT_US > io_cost
+      || 0 >= arrival_interval
+      || arrival_interval >= io_cost) {
+    window = 0;
+  } else {
+    window = io_cost / 2;
+    window = MIN(window, target_commit_latency_us - io_cost);
+    window = MIN(window, MAX_BATCH_WINDOW_US);
+    // no task is expected to arrive during the window
+    window = window < arrival_interval ? 0 : window;
+  }
+  ATOMIC_STORE(&batch_window_us_, window > 0 ? window : 0);
+}
+} // end namespace palf
+} // end namespace oceanbase
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_LOG_GROUP_COMMIT_CONTROLLER_
+#define OCEANBASE_LOGSERVICE_LOG_GROUP_COMMIT_CONTROLLER_
+
+#include <stdint.h>
+#include "lib/metrics/ob_ema_v2.h"                  // ObEMA
+#include "lib/metrics/ob_log2_histogram.h"          // ObLog2Histogram
+#include "lib/utility/ob_macro_utils.h"             // DISALLOW_COPY_AND_ASSIGN
+#include "lib/utility/ob_print_utils.h"             // TO_STRING_KV
+
+namespace oceanbase
+{
+namespace palf
+{
+// LogGroupCommitController decides how long LogIOWorker may wait for more
+// LogIOFlushLogTask before writing a batch.
+//
+// The window is derived from the observed write latency and task arrival
+// interval:
+// 1. the device is fast (write latency below MIN_IO_COST_TO_WAIT_US), or tasks
+//    arrive slower than one write, waiting only adds latency, flush at once;
+// 2. otherwise wait at most half of one write, bounded by
+//    'target_commit_latency_us_ - write latency' and MAX_BATCH_WINDOW_US.
+//
+// Only the LogIOWorker thread updates the controller, the statistics may be
+// read concurrently by virtual table.
+class LogGroupCommitController
+{
+public:
+  LogGroupCommitController();
+  ~LogGroupCommitController();
+  // target_commit_latency_us <= 0 means never wait.
+  int init(const int64_t target_commit_latency_us);
+  void destroy();
+  // called for each LogIOFlushLogTask which has been put into a batch.
+  void on_task_arrival(const int64_t arrival_ts);
+  // called after a batch has been written.
+  void on_batch_flushed(const int64_t batch_size,
+                        const int64_t wait_us,
+                        const int64_t io_cost_us);
+  // max time(us) to wait for more tasks before flushing, 0 means flush at once.
+  int64_t get_batch_window_us() const { return ATOMIC_LOAD(&batch_window_us_); }
+  // may be called by the thread which refreshes tenant config.
+  void set_target_commit_latency_us(const int64_t target_commit_latency_us)
+  {
+    ATOMIC_STORE(&target_commit_latency_us_, target_commit_latency_us);
+  }
+  int64_t get_target_commit_latency_us() const { return ATOMIC_LOAD(&target_commit_latency_us_); }
+  int64_t get_avg_io_cost_us() const { return static_cast<int64_t>(io_cost_ema_.get_value()); }
+  int64_t get_avg_arrival_interval_us() const
+  {
+    return static_cast<int64_t>(arrival_interval_ema_.get_value());
+  }
+  const common::ObLog2Histogram &get_batch_size_histogram() const { return batch_size_hist_; }
+  const common::ObLog2Histogram &get_wait_time_histogram() const { return wait_time_hist_; }
+  const common::ObLog2Histogram &get_io_cost_histogram() const { return io_cost_hist_; }
+  TO_STRING_KV(K_(target_commit_latency_us), K_(batch_window_us), "avg_io_cost_us",
+               get_avg_io_cost_us(), "avg_arrival_interval_us", get_avg_arrival_interval_us(),
+               K_(batch_size_hist), K_(wait_time_hist), K_(io_cost_hist));
+public:
+  static constexpr int64_t MAX_BATCH_WINDOW_US = 1000;
+  static constexpr int64_t MIN_IO_COST_TO_WAIT_US = 100;
+private:
+  void update_batch_window_();
+private:
+  // an idle period should not make the arrival interval meaningless for long.
+  static constexpr int64_t MAX_ARRIVAL_INTERVAL_US = 10 * 1000;
+  static constexpr double EMA_ALPHA = 0.1;
+  int64_t target_commit_latency_us_;
+  int64_t batch_window_us_;
+  int64_t last_arrival_ts_;
+  int64_t last_print_ts_;
+  common::ObEMA io_cost_ema_;
+  common::ObEMA arrival_interval_ema_;
+  common::ObLog2Histogram batch_size_hist_;
+  common::ObLog2Histogram wait_time_hist_;
+  common::ObLog2Histogram io_cost_hist_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(LogGroupCommitController);
+};
+} // end namespace palf
+} // end namespace oceanbase
+
+#endif
@@ -0,0 +1,260 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "log_hot_cache.h"
+#include "lib/oblog/ob_log_module.h"       // PALF_LOG
+#include "share/rc/ob_tenant_base.h"       // mtl_malloc
+#include "log_define.h"                    // palf_reach_time_interval
+#include "log_writer_utils.h"              // LogWriteBuf
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+namespace palf
+{
+LogHotCache::LogHotCache()
+  : lock_(),
+    palf_id_(INVALID_PALF_ID),
+    buf_(NULL),
+    cache_size_(0),
+    seq_(0),
+    begin_lsn_(),
+    end_lsn_(),
+    hit_cnt_(0),
+    miss_cnt_(0),
+    hit_size_(0),
+    last_print_ts_(OB_INVALID_TIMESTAMP),
+    is_inited_(false)
+{
+}
+
+LogHotCache::~LogHotCache()
+{
+  destroy();
+}
+
+int LogHotCache::init(const int64_t palf_id, const int64_t cache_size)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    PALF_LOG(ERROR, "LogHotCache has inited", K(ret), K(palf_id));
+  } else if (false == is_valid_palf_id(palf_id) || 0 >= cache_size) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(palf_id), K(cache_size));
+  } else {
+    ObMemAttr mem_attr(MTL_ID(), "LogHotCache");
+    if (NULL == (buf_ = static_cast<char *>(mtl_malloc(cache_size, mem_attr)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      PALF_LOG(WARN, "alloc memory failed", K(ret), K(palf_id), K(cache_size));
+    } else {
+      palf_id_ = palf_id;
+      cache_size_ = cache_size;
+      seq_ = 0;
+      begin_lsn_.reset();
+      end_lsn_.reset();
+      is_inited_ = true;
+      PALF_LOG(INFO, "LogHotCache init success", K(ret), KPC(this));
+    }
+  }
+  return ret;
+}
+
+void LogHotCache::destroy()
+{
+  if (IS_INIT) {
+    PALF_LOG(INFO, "LogHotCache destroy", KPC(this));
+  }
+  is_inited_ = false;
+  if (NULL != buf_) {
+    mtl_free(buf_);
+    buf_ = NULL;
+  }
+  palf_id_ = INVALID_PALF_ID;
+  cache_size_ = 0;
+  seq_ = 0;
+  begin_lsn_.reset();
+  end_lsn_.reset();
+  hit_cnt_ = 0;
+  miss_cnt_ = 0;
+  hit_size_ = 0;
+  last_print_ts_ = OB_INVALID_TIMESTAMP;
+}
+
+int LogHotCache::fill(const LSN &lsn, const LogWriteBuf &write_buf)
+{
+  int ret = OB_SUCCESS;
+  ObSpinLockGuard guard(lock_);
+  const int64_t total_size = write_buf.get_total_size();
+  LSN begin_lsn, end_lsn;
+  get_range_(begin_lsn, end_lsn);
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (false == lsn.is_valid() || false == write_buf.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(lsn), K(write_buf));
+  } else if (total_size > cache_size_) {
+    // too large to be cached, and the cached log is useless because it's not continuous with
+    // the next written log.
+    reset_range_(lsn + total_size);
+  } else {
+    if (lsn != end_lsn) {
+      // first written log or the log has been truncated without notifying cache.
+      reset_range_(lsn);
+      begin_lsn = end_lsn = lsn;
+    }
+    const LSN new_end_lsn = lsn + total_size;
+    if (static_cast<int64_t>(new_end_lsn - begin_lsn) > cache_size_) {
+      // advance 'begin_lsn_' before overwriting, readers will check it after copying.
+      advance_begin_lsn_(new_end_lsn - cache_size_);
+      MEM_BARRIER();
+    }
+    LSN curr_lsn = lsn;
+    const int64_t buf_count = write_buf.get_buf_count();
+    for (int64_t i = 0; OB_SUCC(ret) && i < buf_count; i++) {
+      const char *data = NULL;
+      int64_t data_len = 0;
+      if (OB_FAIL(write_buf.get_write_buf(i, data, data_len))) {
+        PALF_LOG(WARN, "get_write_buf failed", K(ret), K(i), K(write_buf));
+      } else {
+        copy_in_(curr_lsn, data, data_len);
+        curr_lsn = curr_lsn + data_len;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      MEM_BARRIER();
+      ATOMIC_STORE(&end_lsn_.val_, new_end_lsn.val_);
+    } else {
+      reset_range_(new_end_lsn);
+    }
+  }
+  if (IS_INIT && palf_reach_time_interval(PRINT_STAT_INTERVAL_US, last_print_ts_)) {
+    PALF_LOG(INFO, "LogHotCache statistics", KPC(this));
+  }
+  return ret;
+}
+
+void LogHotCache::truncate(const LSN &lsn)
+{
+  ObSpinLockGuard guard(lock_);
+  LSN begin_lsn, end_lsn;
+  get_range_(begin_lsn, end_lsn);
+  if (IS_NOT_INIT || false == lsn.is_valid() || lsn >= end_lsn) {
+  } else if (lsn <= begin_lsn) {
+    reset_range_(lsn);
+    PALF_LOG(INFO, "LogHotCache truncate all", K(lsn), K(begin_lsn), K(end_lsn), KPC(this));
+  } else {
+    // keep [begin_lsn_, lsn), the readers which are copying the truncated log
+    // will see 'seq_' has been changed.
+    ATOMIC_INC(&seq_);
+    ATOMIC_STORE(&end_lsn_.val_, lsn.val_);
+    ATOMIC_INC(&seq_);
+    PALF_LOG(INFO, "LogHotCache truncate", K(lsn), K(begin_lsn), K(end_lsn), KPC(this));
+  }
+}
+
+void LogHotCache::truncate_prefix(const LSN &lsn)
+{
+  ObSpinLockGuard guard(lock_);
+  LSN begin_lsn, end_lsn;
+  get_range_(begin_lsn, end_lsn);
+  if (IS_NOT_INIT || false == lsn.is_valid() || lsn <= begin_lsn) {
+  } else if (lsn >= end_lsn) {
+    reset_range_(lsn);
+  } else {
+    advance_begin_lsn_(lsn);
+  }
+}
+
+int LogHotCache::read(const LSN &lsn, const int64_t read_size, char *buf)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (false == lsn.is_valid() || 0 >= read_size || NULL == buf) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(ret), K(lsn), K(read_size), KP(buf));
+  } else {
+    LSN begin_lsn, end_lsn;
+    const int64_t seq = ATOMIC_LOAD(&seq_);
+    get_range_(begin_lsn, end_lsn);
+    if (0 != (seq & 1) || lsn < begin_lsn || lsn + read_size > end_lsn) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      copy_out_(lsn, read_size, buf);
+      MEM_BARRIER();
+      get_range_(begin_lsn, end_lsn);
+      // the data has been overwritten during copying.
+      if (seq != ATOMIC_LOAD(&seq_) || lsn < begin_lsn) {
+        ret = OB_ENTRY_NOT_EXIST;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ATOMIC_INC(&hit_cnt_);
+      ATOMIC_AAF(&hit_size_, read_size);
+    } else {
+      ATOMIC_INC(&miss_cnt_);
+    }
+  }
+  return ret;
+}
+
+int64_t LogHotCache::get_hit_ratio() const
+{
+  const int64_t hit_cnt = get_hit_count();
+  const int64_t total_cnt = hit_cnt + get_miss_count();
+  return 0 == total_cnt ? 0 : hit_cnt * 100 / total_cnt;
+}
+
+void LogHotCache::reset_range_(const LSN &lsn)
+{
+  ATOMIC_INC(&seq_);
+  ATOMIC_STORE(&begin_lsn_.val_, lsn.val_);
+  ATOMIC_STORE(&end_lsn_.val_, lsn.val_);
+  ATOMIC_INC(&seq_);
+}
+
+void LogHotCache::advance_begin_lsn_(const LSN &lsn)
+{
+  if (lsn.val_ > ATOMIC_LOAD(&begin_lsn_.val_)) {
+    ATOMIC_STORE(&begin_lsn_.val_, lsn.val_);
+  }
+}
+
+void LogHotCache::copy_in_(const LSN &lsn, const char *data, const int64_t data_len)
+{
+  const int64_t pos = static_cast<int64_t>(lsn.val_ % cache_size_);
+  const int64_t first_part_len = MIN(cache_size_ - pos, data_len);
+  MEMCPY(buf_ + pos, data, first_part_len);
+  if (data_len > first_part_len) {
+    MEMCPY(buf_, data + first_part_len, data_len - first_part_len);
+  }
+}
+
+void LogHotCache::copy_out_(const LSN &lsn, const int64_t data_len, char *buf) const
+{
+  const int64_t pos = static_cast<int64_t>(lsn.val_ % cache_size_);
+  const int64_t first_part_len = MIN(cache_size_ - pos, data_len);
+  MEMCPY(buf, buf_ + pos, first_part_len);
+  if (data_len > first_part_len) {
+    MEMCPY(buf + first_part_len, buf_, data_len - first_part_len);
+  }
+}
+
+void LogHotCache::get_range_(LSN &begin_lsn, LSN &end_lsn) const
+{
+  begin_lsn.val_ = ATOMIC_LOAD(&begin_lsn_.val_);
+  end_lsn.val_ = ATOMIC_LOAD(&end_lsn_.val_);
+}
+} // end namespace palf
+} // end namespace oceanbase
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_LOGSERVICE_LOG_HOT_CACHE_
+#define OCEANBASE_LOGSERVICE_LOG_HOT_CACHE_
+
+#include <stdint.h>
+#include "lib/lock/ob_spin_lock.h"          // ObSpinLock
+#include "lib/utility/ob_macro_utils.h"     // DISALLOW_COPY_AND_ASSIGN
+#include "lib/utility/ob_print_utils.h"     // TO_STRING_KV
+#include "lsn.h"                            // LSN
+
+namespace oceanbase
+{
+namespace palf
+{
+struct LogWriteBuf;
+// LogHotCache keeps the latest written log of a palf in a ring buffer keyed by
+// LSN, so that fetching log by followers and CDC can avoid reading log which
+// has been written just now from disk.
+//
+// The cached range [begin_lsn_, end_lsn_) is always continuous. It is filled
+// by LogIOWorker after the log has been written, at that time the data is
+// still in LogGroupBuffer and has not been reused. fill, truncate and
+// truncate_prefix are serialized by 'lock_', and 'begin_lsn_' only moves
+// forward unless the whole range is reset.
+//
+// Readers don't hold any lock, they copy the data firstly and then check
+// whether it has been overwritten:
+// 1. 'begin_lsn_' is advanced before the data is overwritten by fill;
+// 2. 'seq_' is changed when the cached range is reset or truncated.
+class LogHotCache
+{
+public:
+  LogHotCache();
+  ~LogHotCache();
+  int init(const int64_t palf_id, const int64_t cache_size);
+  void destroy();
+  bool is_inited() const { return is_inited_; }
+  // called by the writer after 'write_buf' has been written at 'lsn'.
+  int fill(const LSN &lsn, const LogWriteBuf &write_buf);
+  // drop cached log after 'lsn'(include 'lsn').
+  void truncate(const LSN &lsn);
+  // drop cached log before 'lsn'(not include 'lsn').
+  void truncate_prefix(const LSN &lsn);
+  // @retval
+  //   OB_SUCCESS, [lsn, lsn + read_size) has been copied into 'buf'.
+  //   OB_ENTRY_NOT_EXIST, cache miss, caller need read from disk.
+  int read(const LSN &lsn, const int64_t read_size, char *buf);
+  int64_t get_hit_count() const { return ATOMIC_LOAD(&hit_cnt_); }
+  int64_t get_miss_count() const { return ATOMIC_LOAD(&miss_cnt_); }
+  int64_t get_hit_size() const { return ATOMIC_LOAD(&hit_size_); }
+  // hit ratio in percent
+  int64_t get_hit_ratio() const;
+  TO_STRING_KV(K_(palf_id), K_(cache_size), K_(begin_lsn), K_(end_lsn), K_(seq),
+               K_(hit_cnt), K_(miss_cnt), K_(hit_size), "hit_ratio", get_hit_ratio());
+private:
+  void reset_range_(const LSN &lsn);
+  void advance_begin_lsn_(const LSN &lsn);
+  void copy_in_(const LSN &lsn, const char *data, const int64_t data_len);
+  void copy_out_(const LSN &lsn, const int64_t data_len, char *buf) const;
+  void get_range_(LSN &begin_lsn, LSN &end_lsn) const;
+private:
+  static constexpr int64_t PRINT_STAT_INTERVAL_US = 10 * 1000 * 1000;
+  common::ObSpinLock lock_;
+  int64_t palf_id_;
+  char *buf_;
+  int64_t cache_size_;
+  // odd means the cached range is being reset.
+  int64_t seq_;
+  LSN begin_lsn_;
+  LSN end_lsn_;
+  int64_t hit_cnt_;
+  int64_t miss_cnt_;
+  int64_t hit_size_;
+  int64_t last_print_ts_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(LogHotCache);
+};
+} // end namespace palf
+} // end namespace oceanbase
+
+#endif
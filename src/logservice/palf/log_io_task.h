@@ -37,7 +37,7 @@ enum class LogIOTaskType
 class LogIOTask
 {
 public:
-  LogIOTask() : palf_epoch_(OB_INVALID_TIMESTAMP) {}
+  LogIOTask() : palf_epoch_(OB_INVALID_TIMESTAMP), submit_ts_(OB_INVALID_TIMESTAMP) {}
   virtual ~LogIOTask() {}
 
 public:
@@ -47,11 +47,15 @@ public:
   virtual void free_this(PalfEnvImpl *palf_env_impl) = 0;
   int64_t get_palf_id() const { return palf_id_; }
   int64_t get_palf_epoch() const { return palf_epoch_; }
+  // the time when LogIOWorker accepted this task, used by LogGroupCommitController
+  void set_submit_ts(const int64_t submit_ts) { submit_ts_ = submit_ts; }
+  int64_t get_submit_ts() const { return submit_ts_; }
   VIRTUAL_TO_STRING_KV("LogIOTask", "dummy");
 
 protected:
   int64_t palf_epoch_;
   int64_t palf_id_;
+  int64_t submit_ts_;
 private:
   DISALLOW_COPY_AND_ASSIGN(LogIOTask);
 };
@@ -58,6 +58,8 @@ int LogIOWorker::init(const LogIOWorkerConfig &config,
                                              config.batch_depth_,
                                              allocator))) {
     PALF_LOG(ERROR, "BatchLogIOFlushLogTaskMgr init failed", K(ret), K(config));
+  } else if (OB_FAIL(group_commit_controller_.init(config.target_commit_latency_us_))) {
+    PALF_LOG(ERROR, "LogGroupCommitController init failed", K(ret), K(config));
   } else {
     share::ObThreadPool::set_run_wrapper(MTL_CTX());
     log_io_worker_num_ = config.io_worker_num_;
@@ -83,6 +85,7 @@ void LogIOWorker::destroy()
   log_io_worker_num_ = -1;
   queue_.destroy();
   batch_io_task_mgr_.destroy();
+  group_commit_controller_.destroy();
   PALF_LOG(INFO, "LogIOWorker destroy success");
 }
 
@@ -93,6 +96,7 @@ int LogIOWorker::submit_io_task(LogIOTask *io_task)
     ret = OB_NOT_INIT;
   } else if (OB_ISNULL(io_task)) {
     ret = OB_INVALID_ARGUMENT;
+  } else if (FALSE_IT(io_task->set_submit_ts(ObTimeUtility::current_time()))) {
   } else if (OB_FAIL(queue_.push(io_task))) {
     PALF_LOG(WARN, "fail to push io task into queue", K(ret), KPC(io_task));
   } else {
@@ -166,11 +170,16 @@ int LogIOWorker::reduce_io_task_(void *task)
   int ret = OB_SUCCESS;
   LogIOTask *io_task = NULL;
   bool last_io_task_has_been_reduced = true;
+  const int64_t batch_window_us = group_commit_controller_.get_batch_window_us();
+  const int64_t batch_start_ts = ObTimeUtility::current_time();
+  int64_t batch_size = 0;
+  int64_t wait_us = 0;
 
   // termination conditions for aggregation:
   // 1. the top LogIOTask of 'queue_' can not be aggreated
   // 2. there is no usable BatchLogIOFlushLogTask in 'batch_io_task_mgr_'.
-  // 3. there is no LogIOTask in 'queue_'
+  // 3. there is no LogIOTask in 'queue_', and the batch window advised by
+  //    'group_commit_controller_' has been used up.
   int tmp_ret = OB_SUCCESS;
   while (OB_SUCCESS == tmp_ret && true == last_io_task_has_been_reduced) {
     io_task = reinterpret_cast<LogIOTask *>(task);
@@ -189,16 +198,24 @@ int LogIOWorker::reduce_io_task_(void *task)
       if (OB_SUCCESS != (tmp_ret = batch_io_task_mgr_.insert(flush_log_task))) {
         last_io_task_has_been_reduced = false;
         PALF_LOG(WARN, "batch_io_task_mgr_ insert failed", K(tmp_ret));
+      } else if (FALSE_IT(batch_size++)) {
+      } else if (FALSE_IT(group_commit_controller_.on_task_arrival(flush_log_task->get_submit_ts()))) {
       } else if (OB_SUCCESS == (tmp_ret = queue_.pop(task))) {
-      // When 'queue_' is empty, stop aggreating.
+      // When 'queue_' is empty, wait for a while if the device is slow enough.
+      } else if (OB_SUCCESS == (tmp_ret = wait_next_io_task_(batch_start_ts, batch_window_us,
+                                                             wait_us, task))) {
+      // When no LogIOTask arrived in batch window, stop aggreating.
       } else {
       }
     }
   }
 
+  const int64_t io_start_ts = ObTimeUtility::current_time();
   if (OB_FAIL(batch_io_task_mgr_.handle(cb_thread_pool_tg_id_, palf_env_impl_))) {
     PALF_LOG(WARN, "batch_io_task_mgr_ handle failed", K(ret), K(batch_io_task_mgr_));
   }
+  group_commit_controller_.on_batch_flushed(batch_size, wait_us,
+                                            ObTimeUtility::current_time() - io_start_ts);
 
   if (false == last_io_task_has_been_reduced && OB_NOT_NULL(io_task)) {
     ret = handle_io_task_(io_task);
@@ -207,6 +224,23 @@ int LogIOWorker::reduce_io_task_(void *task)
   return ret;
 }
 
+int LogIOWorker::wait_next_io_task_(const int64_t batch_start_ts,
+                                    const int64_t batch_window_us,
+                                    int64_t &wait_us,
+                                    void *&task)
+{
+  int ret = OB_SUCCESS;
+  const int64_t wait_start_ts = ObTimeUtility::current_time();
+  const int64_t remain_us = batch_start_ts + batch_window_us - wait_start_ts;
+  if (0 >= remain_us || true == has_set_stop()) {
+    ret = OB_ENTRY_NOT_EXIST;
+  } else {
+    ret = queue_.pop(task, remain_us);
+    wait_us += ObTimeUtility::current_time() - wait_start_ts;
+  }
+  return ret;
+}
+
 LogIOWorker::BatchLogIOFlushLogTaskMgr::BatchLogIOFlushLogTaskMgr()
   : handle_count_(0), has_batched_size_(0), usable_count_(0), batch_width_(0)
 {}
@@ -22,6 +22,7 @@
 #include "lib/hash/ob_array_hash_map.h"             // ObArrayHashMap
 #include "share/ob_thread_pool.h"                   // ObThreadPool
 #include "log_io_task.h"                            // LogBatchIOFlushLogTask
+#include "log_group_commit_controller.h"            // LogGroupCommitController
 #include "log_define.h"                             // ALF_SLIDING_WINDOW_SIZE
 namespace oceanbase
 {
@@ -46,7 +47,8 @@ struct LogIOWorkerConfig
   }
   bool is_valid() const
   {
-    return 0 < io_worker_num_ && 0 < io_queue_capcity_ && 0 < batch_width_ && 0 < batch_depth_;
+    return 0 < io_worker_num_ && 0 < io_queue_capcity_ && 0 < batch_width_ && 0 < batch_depth_
+        && 0 <= target_commit_latency_us_;
   }
   void reset()
   {
@@ -54,12 +56,16 @@ struct LogIOWorkerConfig
     io_queue_capcity_ = 0;
     batch_width_ = 0;
     batch_depth_ = 0;
+    target_commit_latency_us_ = 0;
   }
   int64_t io_worker_num_;
   int64_t io_queue_capcity_;
   int64_t batch_width_;
   int64_t batch_depth_;
-  TO_STRING_KV(K_(io_worker_num), K_(io_queue_capcity), K_(batch_width), K_(batch_depth));
+  // used by LogGroupCommitController, 0 means never wait for more flush tasks.
+  int64_t target_commit_latency_us_;
+  TO_STRING_KV(K_(io_worker_num), K_(io_queue_capcity), K_(batch_width), K_(batch_depth),
+               K_(target_commit_latency_us));
 };
 
 class LogIOWorker : public share::ObThreadPool
@@ -75,12 +81,24 @@ public:
 
   void run1() override final;
   int submit_io_task(LogIOTask *io_task);
+  const LogGroupCommitController &get_group_commit_controller() const
+  {
+    return group_commit_controller_;
+  }
+  void update_target_commit_latency(const int64_t target_commit_latency_us)
+  {
+    group_commit_controller_.set_target_commit_latency_us(target_commit_latency_us);
+  }
   static constexpr int64_t MAX_THREAD_NUM = 1;
-  TO_STRING_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id));
+  TO_STRING_KV(K_(log_io_worker_num), K_(cb_thread_pool_tg_id), K_(group_commit_controller));
 private:
 
   bool need_reduce_(LogIOTask *task);
   int reduce_io_task_(void *task);
+  int wait_next_io_task_(const int64_t batch_start_ts,
+                         const int64_t batch_window_us,
+                         int64_t &wait_us,
+                         void *&task);
   int handle_io_task_(LogIOTask *io_task);
   int run_loop_();
 private:
@@ -118,6 +136,7 @@ private:
   PalfEnvImpl *palf_env_impl_;
   ObLightyQueue queue_;
   BatchLogIOFlushLogTaskMgr batch_io_task_mgr_;
+  LogGroupCommitController group_commit_controller_;
   bool is_inited_;
 };
 } // end namespace palf
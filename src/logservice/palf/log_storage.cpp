@@ -35,6 +35,7 @@ LogStorage::LogStorage() :
     tail_info_lock_(),
     delete_block_lock_(),
     switch_next_block_cb_(),
+    hot_cache_(),
     is_inited_(false)
 {}
 
@@ -102,6 +103,7 @@ void LogStorage::destroy()
   log_block_header_.reset();
   curr_block_writable_size_ = 0;
   need_append_block_header_ = false;
+  hot_cache_.destroy();
   PALF_LOG(INFO, "LogStorage destroy success");
 }
 
@@ -139,6 +141,10 @@ int LogStorage::writev(const LSN &lsn, const LogWriteBuf &write_buf, const int64
   } else {
     curr_block_writable_size_ -= write_size;
     update_log_tail_guarded_by_lock_(write_size);
+    // 'write_buf' still points to LogGroupBuffer, which will not be reused before return.
+    if (hot_cache_.is_inited()) {
+      (void)hot_cache_.fill(lsn, write_buf);
+    }
     PALF_LOG(TRACE, "LogStorage writev success", K(ret), K(log_block_header_), K(lsn),
              K(log_tail_), K(write_buf), KPC(this));
   }
@@ -285,6 +291,19 @@ int LogStorage::pread_without_block_header(const LSN &read_lsn,
   return ret;
 }
 
+int LogStorage::init_hot_cache(const int64_t cache_size)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (OB_FAIL(hot_cache_.init(palf_id_, cache_size))) {
+    PALF_LOG(WARN, "LogHotCache init failed", K(ret), K_(palf_id), K(cache_size));
+  } else {
+    PALF_LOG(INFO, "init_hot_cache success", K(ret), K_(palf_id), K(cache_size));
+  }
+  return ret;
+}
+
 int LogStorage::truncate(const LSN &lsn)
 {
   int ret = OB_SUCCESS;
@@ -325,6 +344,7 @@ int LogStorage::inner_truncate_(const LSN &lsn)
     need_append_block_header_ =
         (curr_block_writable_size_ == logical_block_size_) ? true : false;
     log_tail_ = lsn;
+    hot_cache_.truncate(lsn);
     PALF_LOG(INFO, "inner_truncate_ success", K(ret), K(lsn), KPC(this));
   }
   return ret;
@@ -384,6 +404,9 @@ int LogStorage::truncate_prefix_blocks(const LSN &lsn)
     need_append_block_header_ = true;
     block_mgr_.reset(block_id);
   }
+  if (OB_SUCC(ret)) {
+    hot_cache_.truncate_prefix(lsn);
+  }
   PALF_EVENT("LogStorage truncate_prefix_blocks finihsed", palf_id_, K(ret), KPC(this),
              K(lsn), K(block_id), K(min_block_id), K(max_block_id),
              K(truncate_end_block_id));
@@ -738,6 +761,10 @@ int LogStorage::inner_pread_(const LSN &read_lsn,
   if (read_lsn >= log_tail) {
     ret = OB_ERR_OUT_OF_UPPER_BOUND;
     PALF_LOG(WARN, "read something out of upper bound", K(ret), K(read_lsn), K(log_tail_));
+  } else if (false == need_read_log_block_header
+             && OB_SUCCESS == hot_cache_.read(read_lsn, real_in_read_size, read_buf.buf_)) {
+    out_read_size = real_in_read_size;
+    PALF_LOG(TRACE, "inner_pread hit hot cache", K(ret), K(read_lsn), K(real_in_read_size));
   } else if (OB_FAIL(log_reader_.pread(read_block_id,
                                        real_read_offset,
                                        real_in_read_size,
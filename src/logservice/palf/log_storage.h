@@ -17,6 +17,7 @@
 #include "share/ob_errno.h"        // errno
 #include "log_block_header.h"      // LogBlockHeader
 #include "log_block_mgr.h"         // LogBlockMgr
+#include "log_hot_cache.h"         // LogHotCache
 #include "log_reader.h"            // LogReader
 #include "log_storage_interface.h" // ILogStorage
 #include "log_writer_utils.h"      // LogWriteBuf
@@ -94,6 +95,9 @@ public:
   int get_block_min_ts_ns(const block_id_t &block_id, int64_t &min_ts) const;
   const LSN get_begin_lsn() const;
   const LSN get_end_lsn() const;
+  // keep latest written log in memory, only used for log storage.
+  int init_hot_cache(const int64_t cache_size);
+  const LogHotCache &get_hot_cache() const { return hot_cache_; }
 
   int update_manifest_used_for_meta_storage(const block_id_t expected_max_block_id);
 
@@ -101,7 +105,8 @@ public:
                K_(log_block_header),
                K_(block_mgr),
                K(logical_block_size_),
-               K(curr_block_writable_size_));
+               K(curr_block_writable_size_),
+               K(hot_cache_));
 
 private:
   int do_init_(const char *log_dir,
@@ -156,6 +161,7 @@ private:
   mutable ObSpinLock tail_info_lock_;
   mutable ObSpinLock delete_block_lock_;
   SwitchNextBlockCallback switch_next_block_cb_;
+  LogHotCache hot_cache_;
   bool is_inited_;
 };
 
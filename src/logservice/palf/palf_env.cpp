@@ -182,6 +182,16 @@ int PalfEnv::update_disk_options(const PalfDiskOptions &disk_options)
   return palf_env_impl_.update_disk_options(disk_options);
 }
 
+int PalfEnv::update_target_commit_latency(const int64_t target_commit_latency_us)
+{
+  return palf_env_impl_.update_target_commit_latency(target_commit_latency_us);
+}
+
+int PalfEnv::update_log_hot_cache_size(const int64_t log_hot_cache_size)
+{
+  return palf_env_impl_.update_log_hot_cache_size(log_hot_cache_size);
+}
+
 // @brief get current palf disk options
 bool PalfEnv::check_disk_space_enough()
 {
@@ -103,6 +103,13 @@ public:
   // @brief get current palf disk options
   // @param [out] options
   int get_disk_options(PalfDiskOptions &options);
+  // @brief update the target latency of group commit
+  // @param [in] target_commit_latency_us, 0 means never wait for more logs
+  int update_target_commit_latency(const int64_t target_commit_latency_us);
+  // @brief update the size of the hot cache, it takes effect for the palf
+  //        created or loaded later
+  // @param [in] log_hot_cache_size, 0 means disable the hot cache
+  int update_log_hot_cache_size(const int64_t log_hot_cache_size);
 
   // @brief check the disk space used to palf whether is enough
   bool check_disk_space_enough();
@@ -120,6 +120,7 @@ PalfEnvImpl::PalfEnvImpl() : palf_meta_lock_(),
                              self_(),
                              palf_handle_impl_map_(64),  // 指定min_size=64
                              last_palf_epoch_(0),
+                             log_hot_cache_size_(PALF_HOT_CACHE_SIZE),
                              diskspace_enough_(true),
                              is_inited_(false)
 {
@@ -145,6 +146,7 @@ int PalfEnvImpl::init(
   log_io_worker_config_.io_queue_capcity_ = 100 * 1024;
   log_io_worker_config_.batch_width_ = 8;
   log_io_worker_config_.batch_depth_ = PALF_SLIDING_WINDOW_SIZE;
+  log_io_worker_config_.target_commit_latency_us_ = 2 * 1000;
   if (is_inited_) {
     ret = OB_INIT_TWICE;
     PALF_LOG(ERROR, "PalfEnvImpl is inited twiced", K(ret));
@@ -824,6 +826,36 @@ int PalfEnvImpl::get_disk_options(PalfDiskOptions &disk_options)
   return ret;
 }
 
+int PalfEnvImpl::update_target_commit_latency(const int64_t target_commit_latency_us)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (0 > target_commit_latency_us) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(target_commit_latency_us));
+  } else {
+    log_io_worker_.update_target_commit_latency(target_commit_latency_us);
+    PALF_LOG(INFO, "update_target_commit_latency success", K(target_commit_latency_us));
+  }
+  return ret;
+}
+
+int PalfEnvImpl::update_log_hot_cache_size(const int64_t log_hot_cache_size)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (0 > log_hot_cache_size) {
+    ret = OB_INVALID_ARGUMENT;
+    PALF_LOG(WARN, "invalid argument", K(log_hot_cache_size));
+  } else if (log_hot_cache_size != ATOMIC_LOAD(&log_hot_cache_size_)) {
+    ATOMIC_STORE(&log_hot_cache_size_, log_hot_cache_size);
+    PALF_LOG(INFO, "update_log_hot_cache_size success", K(log_hot_cache_size));
+  }
+  return ret;
+}
+
 int PalfEnvImpl::for_each(const common::ObFunction<int (const PalfHandle &)> &func)
 {
   auto func_impl = [&func](const LSKey &ls_key, PalfHandleImpl *palf_handle_impl) -> bool {
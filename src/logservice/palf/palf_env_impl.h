@@ -214,8 +214,12 @@ public:
   int get_disk_usage(int64_t &used_size_byte, int64_t &total_usable_size_byte);
   int update_disk_options(const PalfDiskOptions &disk_options);
   int get_disk_options(PalfDiskOptions &disk_options);
+  int update_target_commit_latency(const int64_t target_commit_latency_us);
+  int update_log_hot_cache_size(const int64_t log_hot_cache_size);
+  int64_t get_log_hot_cache_size() const { return ATOMIC_LOAD(&log_hot_cache_size_); }
   int for_each(const common::ObFunction<int(const PalfHandle&)> &func);
   common::ObILogAllocator* get_log_allocator();
+  const LogIOWorker &get_log_io_worker() const { return log_io_worker_; }
   TO_STRING_KV(K_(self), K_(log_dir), K_(disk_options_wrapper));
   // =================== disk space management ==================
 public:
@@ -313,6 +317,8 @@ private:
   int64_t last_palf_epoch_;
 
   LogIOWorkerConfig log_io_worker_config_;
+  // the size of LogHotCache of the palf created or loaded later, 0 means disable it.
+  int64_t log_hot_cache_size_;
   bool diskspace_enough_;
   bool is_inited_;
   bool is_running_;
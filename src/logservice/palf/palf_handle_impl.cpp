@@ -125,6 +125,7 @@ int PalfHandleImpl::init(const int64_t palf_id,
           log_io_worker, palf_epoch))) {
     PALF_LOG(WARN, "LogEngine init failed", K(ret), K(palf_id), K(log_dir), K(alloc_mgr),
         K(log_rpc), K(log_io_worker));
+  } else if (FALSE_IT(init_hot_cache_(palf_id, palf_env_impl))) {
   } else if (OB_FAIL(do_init_mem_(palf_id, palf_base_info, log_meta, log_dir, self, fetch_log_engine,
           alloc_mgr, log_rpc, log_io_worker, palf_env_impl, election_timer))) {
     PALF_LOG(WARN, "PalfHandleImpl do_init_mem_ failed", K(ret), K(palf_id));
@@ -135,6 +136,15 @@ int PalfHandleImpl::init(const int64_t palf_id,
   return ret;
 }
 
+void PalfHandleImpl::init_hot_cache_(const int64_t palf_id, const PalfEnvImpl *palf_env_impl)
+{
+  int tmp_ret = OB_SUCCESS;
+  const int64_t cache_size = (NULL == palf_env_impl ? PALF_HOT_CACHE_SIZE : palf_env_impl->get_log_hot_cache_size());
+  if (OB_SUCCESS != (tmp_ret = log_engine_.init_hot_cache(cache_size))) {
+    PALF_LOG(WARN, "init_hot_cache failed, read log from disk", K(tmp_ret), K(palf_id), K(cache_size));
+  }
+}
+
 bool PalfHandleImpl::check_can_be_used() const
 {
   return false == ATOMIC_LOAD(&has_set_deleted_);
@@ -173,6 +183,7 @@ int PalfHandleImpl::load(const int64_t palf_id,
     PALF_LOG(WARN, "LogEngine load failed", K(ret), K(palf_id));
     // NB: when 'entry_header' is invalid, means that there is no data on disk, and set max_committed_end_lsn
     //     to 'base_lsn_', we will generate default PalfBaseInfo or get it from LogSnapshotMeta(rebuild).
+  } else if (FALSE_IT(init_hot_cache_(palf_id, palf_env_impl))) {
   } else if (FALSE_IT(max_committed_end_lsn =
         (true == entry_header.is_valid() ? entry_header.get_committed_end_lsn() : log_engine_.get_log_meta().get_log_snapshot_meta().base_lsn_))) {
   } else if (OB_FAIL(construct_palf_base_info_(max_committed_end_lsn, palf_base_info))) {
@@ -843,6 +843,7 @@ public:
   int get_palf_epoch(int64_t &palf_epoch) const;
   TO_STRING_KV(K_(palf_id), K_(self), K_(has_set_deleted));
 private:
+  void init_hot_cache_(const int64_t palf_id, const PalfEnvImpl *palf_env_impl);
   int do_init_mem_(const int64_t palf_id,
                    const PalfBaseInfo &palf_base_info,
                    const LogMeta &log_meta,
@@ -392,6 +392,8 @@ void ObReplayServiceReplayTask::reset()
     };
   }
   idx_ = -1;
+  ATOMIC_STORE(&pending_cnt_, 0);
+  ATOMIC_STORE(&replayed_cnt_, 0);
   ObReplayServiceTask::reset();
 }
 
@@ -424,6 +426,26 @@ int ObReplayServiceReplayTask::get_min_unreplayed_log_info(LSN &lsn,
   return ret;
 }
 
+void ObReplayServiceReplayTask::stat(LSReplayQueueStat &stat) const
+{
+  ObLockGuard<ObSpinLock> guard(lock_);
+  ObLogReplayTask *replay_task = NULL;
+  ObLink *top_item = queue_.top();
+  stat.queue_idx_ = idx_;
+  stat.pending_cnt_ = ATOMIC_LOAD(&pending_cnt_);
+  stat.replayed_cnt_ = ATOMIC_LOAD(&replayed_cnt_);
+  if (NULL != top_item && NULL != (replay_task = static_cast<ObLogReplayTask *>(top_item))) {
+    stat.min_unreplayed_lsn_ = replay_task->lsn_;
+    stat.min_unreplayed_log_ts_ns_ = replay_task->log_ts_;
+    const int64_t lag_ns = common::ObTimeUtility::current_time_ns() - replay_task->log_ts_;
+    stat.replay_lag_us_ = lag_ns > 0 ? lag_ns / 1000 : 0;
+  } else {
+    stat.min_unreplayed_lsn_.reset();
+    stat.min_unreplayed_log_ts_ns_ = OB_INVALID_TIMESTAMP;
+    stat.replay_lag_us_ = 0;
+  }
+}
+
 //---------------ObLogReplayBuffer---------------//
 void ObLogReplayBuffer::reset()
 {
@@ -1248,5 +1270,26 @@ int ObReplayStatus::stat(LSReplayStat &stat) const
   return ret;
 }
 
+int ObReplayStatus::stat_replay_queues(common::ObIArray<LSReplayQueueStat> &stats) const
+{
+  int ret = OB_SUCCESS;
+  RLockGuard rlock_guard(rwlock_);
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+  } else if (!is_enabled_) {
+    // queues are cleared and not inited when disabled, nothing to report
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+      LSReplayQueueStat queue_stat;
+      queue_stat.ls_id_ = ls_id_.id();
+      task_queues_[i].stat(queue_stat);
+      if (OB_FAIL(stats.push_back(queue_stat))) {
+        CLOG_LOG(WARN, "push back queue stat failed", K(ret), K(queue_stat), KPC(this));
+      }
+    }
+  }
+  return ret;
+}
+
 } // namespace logservice
 }
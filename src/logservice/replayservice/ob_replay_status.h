@@ -20,6 +20,7 @@
 #include "logservice/palf/palf_callback.h"
 #include "logservice/palf/palf_iterator.h"
 #include "logservice/palf/palf_handle.h"
+#include "lib/container/ob_iarray.h"
 #include "lib/lock/ob_spin_lock.h"
 #include "lib/lock/ob_spin_rwlock.h"
 #include "lib/queue/ob_link_queue.h"
@@ -75,6 +76,27 @@ struct LSReplayStat
                K(pending_cnt_));
 };
 
+//虚拟表统计, 每个回放队列一行
+struct LSReplayQueueStat
+{
+  int64_t ls_id_;
+  int64_t queue_idx_;
+  int64_t pending_cnt_;
+  int64_t replayed_cnt_;
+  palf::LSN min_unreplayed_lsn_;
+  int64_t min_unreplayed_log_ts_ns_;
+  // time since the log at the head of the queue was written, 0 if the queue is empty
+  int64_t replay_lag_us_;
+
+  TO_STRING_KV(K(ls_id_),
+               K(queue_idx_),
+               K(pending_cnt_),
+               K(replayed_cnt_),
+               K(min_unreplayed_lsn_),
+               K(min_unreplayed_log_ts_ns_),
+               K(replay_lag_us_));
+};
+
 //此类型为前向barrier日志专用, 与ObLogReplayTask分开分配
 //因此此结构的内存需要单独释放
 struct ObLogReplayBuffer
@@ -343,6 +365,8 @@ public:
   {
     type_ = ObReplayServiceTaskType::REPLAY_LOG_TASK;
     idx_ = -1;
+    pending_cnt_ = 0;
+    replayed_cnt_ = 0;
   }
   ~ObReplayServiceReplayTask() { destroy(); }
   // use base_log_ts init min_unreplayed_log_ts;
@@ -359,15 +383,27 @@ public:
   Link *pop()
   {
     ObLockGuard<ObSpinLock> guard(lock_);
-    return pop_();
+    Link *p = pop_();
+    if (NULL != p) {
+      ATOMIC_DEC(&pending_cnt_);
+      ATOMIC_INC(&replayed_cnt_);
+    }
+    return p;
   }
   void push(Link *p)
   {
+    ATOMIC_INC(&pending_cnt_);
     queue_.push(p);
   }
   int get_min_unreplayed_log_info(palf::LSN &lsn,
                                   int64_t &log_ts,
                                   bool &is_queue_empty);
+  void stat(LSReplayQueueStat &stat) const;
+
+  INHERIT_TO_STRING_KV("ObReplayServiceReplayTask", ObReplayServiceTask,
+                       K(idx_),
+                       K(pending_cnt_),
+                       K(replayed_cnt_));
 private:
   Link *pop_()
   {
@@ -376,6 +412,9 @@ private:
 private:
   common::ObSpScLinkQueue queue_;   //place ObLogReplayTask
   int64_t idx_; //热点行优化
+  //for __all_virtual_replay_queue_stat, reset when queue is cleared
+  int64_t pending_cnt_;
+  int64_t replayed_cnt_;
 };
 
 class ObReplayFsCb : public palf::PalfFSCb
@@ -508,6 +547,7 @@ public:
   void set_post_barrier_submitted(const palf::LSN &lsn);
   int set_post_barrier_finished(const palf::LSN &lsn);
   int stat(LSReplayStat &stat) const;
+  int stat_replay_queues(common::ObIArray<LSReplayQueueStat> &stats) const;
 
   inline void inc_ref()
   {
@@ -131,11 +131,17 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
   bool is_packed = result.get_physical_plan() ? result.get_physical_plan()->is_packed() : false;
   MYSQL_PROTOCOL_TYPE protocol_type = is_ps_protocol ? BINARY : TEXT;
   const common::ColumnsFieldIArray *fields = NULL;
+  bool use_batch = false;
   if (OB_SUCC(ret)) {
     fields = result.get_field_columns();
     if (OB_ISNULL(fields)) {
       ret = OB_INVALID_ARGUMENT;
       LOG_WARN("fields is null", K(ret), KP(fields));
+    } else if (OB_FAIL(check_batch_response_(result, protocol_type, is_packed, use_batch))) {
+      LOG_WARN("fail to check batch response", K(ret));
+    } else if (use_batch) {
+      ret = response_query_batch_rows_(result, protocol_type, has_more_result,
+                                       is_cac_found_rows, limit_count, can_retry, row_num);
     }
   }
   while (OB_SUCC(ret) && row_num < limit_count && !OB_FAIL(result.get_next_row(result_row)) ) {
@@ -202,7 +208,7 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
       }
     }
   }
-  if (is_cac_found_rows) {
+  if (is_cac_found_rows && !use_batch) {
     while (OB_SUCC(ret) && !OB_FAIL(result.get_next_row(result_row))) {
       // nothing
     }
@@ -223,6 +229,102 @@ int ObQueryDriver::response_query_result(ObResultSet &result,
   return ret;
 }
 
+int ObQueryDriver::check_batch_response_(ObResultSet &result,
+                                         const MYSQL_PROTOCOL_TYPE protocol_type,
+                                         const bool is_packed,
+                                         bool &use_batch)
+{
+  int ret = OB_SUCCESS;
+  const common::ObIArray<ObExpr *> *exprs = NULL;
+  ObEvalCtx *eval_ctx = NULL;
+  ObCharsetType charset_type = CHARSET_INVALID;
+  use_batch = false;
+  // the packed rows are encoded by the operator, prexecute stops at the row before the limit
+  if (is_packed || is_prexecute_ || !result.is_vectorized_result()) {
+    // do nothing
+  } else if (OB_ISNULL(result.get_field_columns())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("fields is null", K(ret));
+  } else if (OB_FAIL(session_.get_character_set_results(charset_type))) {
+    LOG_WARN("fail to get result charset", K(ret));
+  } else if (OB_FAIL(result.get_batch_output(exprs, eval_ctx))) {
+    LOG_WARN("fail to get batch output", K(ret));
+  } else if (OB_FAIL(ObSMDatumRow::check_supported(protocol_type, *exprs,
+                                                   *result.get_field_columns(),
+                                                   charset_type, use_batch))) {
+    LOG_WARN("fail to check datum row supported", K(ret));
+  }
+  return ret;
+}
+
+int ObQueryDriver::response_query_batch_rows_(ObResultSet &result,
+                                              const MYSQL_PROTOCOL_TYPE protocol_type,
+                                              const bool has_more_result,
+                                              const bool is_cac_found_rows,
+                                              const int64_t limit_count,
+                                              bool &can_retry,
+                                              int64_t &row_num)
+{
+  int ret = OB_SUCCESS;
+  const common::ObIArray<ObExpr *> *exprs = NULL;
+  ObEvalCtx *eval_ctx = NULL;
+  const ObBatchRows *brs = NULL;
+  bool iter_end = false;
+  if (OB_FAIL(result.get_batch_output(exprs, eval_ctx))) {
+    LOG_WARN("fail to get batch output", K(ret));
+  } else {
+    const ObDataTypeCastParams dtc_params = ObBasicSessionInfo::create_dtc_params(&session_);
+    ObSMDatumRow sm(protocol_type, *exprs, *eval_ctx, dtc_params,
+                    result.get_field_columns(),
+                    ctx_.schema_guard_,
+                    session_.get_effective_tenant_id());
+    while (OB_SUCC(ret) && row_num < limit_count && !iter_end) {
+      // never fetch the rows beyond the limit, so that the return rows is the same as row by row
+      if (OB_FAIL(result.get_next_batch(limit_count - row_num, brs))) {
+        LOG_WARN("fail to get next batch", K(ret), K(row_num));
+      } else if (OB_FAIL(sm.prepare_batch())) {
+        LOG_WARN("fail to prepare batch", K(ret));
+      } else {
+        for (int64_t i = 0; OB_SUCC(ret) && i < brs->size_; i++) {
+          if (brs->skip_->at(i)) {
+            continue;
+          }
+          // 如果是第一行，则先给客户端回复field等信息
+          if (0 == row_num) {
+            can_retry = false; // 已经获取到第一行数据，不再重试了
+            if (OB_FAIL(response_query_header(result, has_more_result, false, is_prexecute_))) {
+              LOG_WARN("fail to response query header", K(ret), K(row_num), K(can_retry));
+            }
+          }
+          if (OB_SUCC(ret)) {
+            sm.set_row_idx(i);
+            OMPKRow rp(sm);
+            if (OB_FAIL(sender_.response_packet(rp, &result.get_session()))) {
+              LOG_WARN("response packet fail", K(ret), K(i), K(row_num), K(can_retry));
+            } else {
+              ++row_num;
+            }
+          }
+        }
+        iter_end = brs->end_;
+      }
+    }
+    if (is_cac_found_rows) {
+      while (OB_SUCC(ret) && !iter_end) {
+        if (OB_FAIL(result.get_next_batch(INT64_MAX, brs))) {
+          LOG_WARN("fail to get next batch", K(ret));
+        } else {
+          iter_end = brs->end_;
+        }
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    ret = OB_ITER_END;
+  }
+  return ret;
+}
+
 int ObQueryDriver::convert_field_charset(ObIAllocator& allocator,
                                          const ObCollationType& from_collation,
                                          const ObCollationType& dest_collation,
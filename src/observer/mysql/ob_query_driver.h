@@ -16,6 +16,7 @@
 #include "share/ob_define.h"
 #include "lib/charset/ob_charset.h"
 #include "lib/string/ob_string.h"
+#include "rpc/obmysql/ob_mysql_util.h"
 
 namespace oceanbase
 {
@@ -84,6 +85,20 @@ public:
                                        common::ObIAllocator &allocator);
 
 private:
+  // check whether the rows can be encoded from the batch datums directly, see ObSMDatumRow
+  int check_batch_response_(sql::ObResultSet &result,
+                            const obmysql::MYSQL_PROTOCOL_TYPE protocol_type,
+                            const bool is_packed,
+                            bool &use_batch);
+  // response the rows of the vectorized plan batch by batch,
+  // return OB_ITER_END after all rows are responsed like get_next_row()
+  int response_query_batch_rows_(sql::ObResultSet &result,
+                                 const obmysql::MYSQL_PROTOCOL_TYPE protocol_type,
+                                 const bool has_more_result,
+                                 const bool is_cac_found_rows,
+                                 const int64_t limit_count,
+                                 bool &can_retry,
+                                 int64_t &row_num);
   int convert_field_charset(common::ObIAllocator& allocator,
       const common::ObCollationType& from_collation,
       const common::ObCollationType& dest_collation,
@@ -247,14 +247,14 @@ int ObMPQuery::process()
           }
         }
 
-        bool enable_batch_opt = session.is_enable_batched_multi_statement();;
+        bool enable_ins_batch_opt = session.is_enable_ins_multi_values_batch_opt();
         if (OB_FAIL(ret)) {
           //do nothing
         } else if (OB_FAIL(parser.split_multiple_stmt(sql_, queries, parse_stat))) {
           // 进入本分支，说明push_back出错，OOM，委托外层代码返回错误码
           // 且进入此分支之后，要断连接
           need_response_error = true;
-        } else if (enable_batch_opt &&
+        } else if (enable_ins_batch_opt &&
             OB_FAIL(parser.reconstruct_insert_sql(sql_, queries, ins_queries, do_ins_batch_opt))) {
           LOG_WARN("fail to reconstruct", K(ret), K(sql_));
         } else if (OB_UNLIKELY(queries.count() <= 0)) {
@@ -442,7 +442,9 @@ int ObMPQuery::try_batched_multi_stmt_optimization(sql::ObSQLSessionInfo &sessio
   int ret = OB_SUCCESS;
   bool has_more = false;
   bool force_sync_resp = true;
-  bool enable_batch_opt = session.is_enable_batched_multi_statement();
+  // a multi-row insert rewritten into single row inserts can be batched by its own switch
+  bool enable_batch_opt = is_ins_multi_val_opt ? session.is_enable_ins_multi_values_batch_opt()
+                                               : session.is_enable_batched_multi_statement();
   bool use_plan_cache = session.get_local_ob_enable_plan_cache();
   optimization_done = false;
   if (queries.count() <= 1 || parse_stat.parse_fail_ ||
@@ -15,10 +15,12 @@
 #include "observer/mysql/obsm_utils.h"
 #include "common/ob_accuracy.h"
 #include "share/schema/ob_schema_getter_guard.h"
+#include "sql/engine/expr/ob_expr.h"
 
 using namespace oceanbase::share::schema;
 using namespace oceanbase::common;
 using namespace oceanbase::obmysql;
+using namespace oceanbase::sql;
 
 ObSMRow::ObSMRow(MYSQL_PROTOCOL_TYPE type,
                  const ObNewRow &obrow,
@@ -71,3 +73,146 @@ int ObSMRow::encode_cell(
 
   return ret;
 }
+
+ObSMDatumRow::ObSMDatumRow(MYSQL_PROTOCOL_TYPE type,
+                           const ObIArray<ObExpr *> &exprs,
+                           ObEvalCtx &eval_ctx,
+                           const ObDataTypeCastParams &dtc_params,
+                           const ColumnsFieldIArray *fields,
+                           ObSchemaGetterGuard *schema_guard,
+                           uint64_t tenant_id)
+    : ObMySQLRow(type),
+      exprs_(exprs),
+      eval_ctx_(eval_ctx),
+      dtc_params_(dtc_params),
+      fields_(fields),
+      schema_guard_(schema_guard),
+      tenant_id_(tenant_id),
+      batch_datums_(),
+      is_batch_result_(),
+      row_idx_(0)
+{
+}
+
+int ObSMDatumRow::check_supported(MYSQL_PROTOCOL_TYPE type,
+                                  const ObIArray<ObExpr *> &exprs,
+                                  const ColumnsFieldIArray &fields,
+                                  const ObCharsetType result_charset,
+                                  bool &supported)
+{
+  int ret = OB_SUCCESS;
+  supported = (exprs.count() == fields.count());
+  const bool need_convert_charset = ObCharset::is_valid_charset(result_charset)
+      && CHARSET_BINARY != result_charset;
+  for (int64_t i = 0; OB_SUCC(ret) && supported && i < exprs.count(); i++) {
+    const ObExpr *expr = exprs.at(i);
+    if (OB_ISNULL(expr)) {
+      ret = OB_ERR_UNEXPECTED;
+      SQL_ENG_LOG(WARN, "expr is null", K(ret), K(i));
+    } else {
+      const ObObjType obj_type = expr->datum_meta_.type_;
+      const ObCollationType cs_type = expr->datum_meta_.cs_type_;
+      switch (ob_obj_type_class(obj_type)) {
+        // lob and json may be converted to other format before sending,
+        // extend type needs the schema to encode
+        case ObTextTC:
+        case ObLobTC:
+        case ObJsonTC:
+        case ObExtendTC: {
+          supported = false;
+          break;
+        }
+        default: {
+          break;
+        }
+      }
+      if (!supported) {
+      } else if (BINARY == type && obj_type != fields.at(i).type_.get_type()) {
+        // ps protocol casts the cell to the field type
+        supported = false;
+      } else if (need_convert_charset && ob_is_string_type(obj_type)
+                 && CS_TYPE_INVALID != cs_type && CS_TYPE_BINARY != cs_type
+                 && ObCharset::charset_type_by_coll(cs_type) != result_charset) {
+        // the string is converted to the charset of the results
+        supported = false;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObSMDatumRow::prepare_batch()
+{
+  int ret = OB_SUCCESS;
+  batch_datums_.reuse();
+  is_batch_result_.reuse();
+  row_idx_ = 0;
+  for (int64_t i = 0; OB_SUCC(ret) && i < exprs_.count(); i++) {
+    const ObExpr *expr = exprs_.at(i);
+    if (OB_ISNULL(expr)) {
+      ret = OB_ERR_UNEXPECTED;
+      SQL_ENG_LOG(WARN, "expr is null", K(ret), K(i));
+    } else if (OB_FAIL(batch_datums_.push_back(expr->locate_batch_datums(eval_ctx_)))) {
+      SQL_ENG_LOG(WARN, "push back datums failed", K(ret));
+    } else if (OB_FAIL(is_batch_result_.push_back(expr->is_batch_result()))) {
+      SQL_ENG_LOG(WARN, "push back failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObSMDatumRow::encode_cell(
+    int64_t idx, char *buf,
+    int64_t len, int64_t &pos, char *bitmap) const
+{
+  int ret = OB_SUCCESS;
+  if (idx >= batch_datums_.count() || idx < 0) {
+    ret = OB_INVALID_ARGUMENT;
+  } else {
+    const ObExpr *expr = exprs_.at(idx);
+    const ObDatum &datum = batch_datums_.at(idx)[is_batch_result_.at(idx) ? row_idx_ : 0];
+    const ObObjType obj_type = expr->datum_meta_.type_;
+    const ObField *field = NULL == fields_ ? NULL : &fields_->at(idx);
+    const bool zerofill = NULL == field ? false : (field->flags_ & ZEROFILL_FLAG);
+    const int32_t zflength = NULL == field ? 0 : field->length_;
+    if (datum.is_null()) {
+      ret = ObMySQLUtil::null_cell_str(buf, len, type_, pos, idx, bitmap);
+    } else {
+      switch (ob_obj_type_class(obj_type)) {
+        case ObIntTC: {
+          ret = ObMySQLUtil::int_cell_str(buf, len, datum.get_int(), obj_type, false,
+                                          type_, pos, zerofill, zflength);
+          break;
+        }
+        case ObUIntTC: {
+          ret = ObMySQLUtil::int_cell_str(buf, len, static_cast<int64_t>(datum.get_uint64()),
+                                          obj_type, true, type_, pos, zerofill, zflength);
+          break;
+        }
+        case ObNumberTC: {
+          const ObScale scale = NULL == field
+              ? ObAccuracy::DML_DEFAULT_ACCURACY[obj_type].get_scale()
+              : field->accuracy_.get_scale();
+          const number::ObNumber nmb(datum.get_number());
+          ret = ObMySQLUtil::number_cell_str(buf, len, nmb, pos, scale, zerofill, zflength);
+          break;
+        }
+        case ObStringTC: {
+          ret = ObMySQLUtil::varchar_cell_str(buf, len, datum.get_string(), false, pos);
+          break;
+        }
+        default: {
+          ObObj obj;
+          if (OB_FAIL(datum.to_obj(obj, expr->obj_meta_, expr->obj_datum_map_))) {
+            SQL_ENG_LOG(WARN, "convert datum to obj failed", K(ret), K(idx));
+          } else {
+            ret = ObSMUtils::cell_str(buf, len, obj, type_, pos, idx, bitmap, dtc_params_,
+                                      field, schema_guard_, tenant_id_);
+          }
+          break;
+        }
+      }
+    }
+  }
+  return ret;
+}
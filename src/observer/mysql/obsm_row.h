@@ -17,6 +17,9 @@
 #include "rpc/obmysql/ob_mysql_row.h"
 #include "common/row/ob_row.h"
 #include "common/ob_field.h"
+#include "common/object/ob_obj_type.h"
+#include "lib/container/ob_se_array.h"
+#include "share/datum/ob_datum.h"
 
 namespace oceanbase
 {
@@ -29,6 +32,12 @@ class ObSchemaGetterGuard;
 }
 }
 
+namespace sql
+{
+class ObExpr;
+struct ObEvalCtx;
+}
+
 namespace common
 {
 
@@ -66,6 +75,60 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObSMRow);
 }; // end of class OBMP
 
+// Encode one row of a vectorized batch from the datums of the output exprs directly,
+// without converting the cells to ObObj. Integers, numbers and strings are written
+// by type specialized paths, the other types fall back to ObSMUtils::cell_str().
+//
+// Usage:
+//   prepare_batch() after each batch is fetched, then set_row_idx() and serialize
+//   through OMPKRow for each active row of the batch.
+class ObSMDatumRow
+    : public obmysql::ObMySQLRow
+{
+public:
+  ObSMDatumRow(obmysql::MYSQL_PROTOCOL_TYPE type,
+               const common::ObIArray<sql::ObExpr *> &exprs,
+               sql::ObEvalCtx &eval_ctx,
+               const ObDataTypeCastParams &dtc_params,
+               const ColumnsFieldIArray *fields,
+               share::schema::ObSchemaGetterGuard *schema_guard = NULL,
+               uint64_t tenant = common::OB_INVALID_ID);
+  virtual ~ObSMDatumRow() {}
+
+  // Whether the output exprs can be sent from datums as they are, which is false if
+  // any cell needs to be converted (charset, lob locator, ps protocol cast) before sending.
+  static int check_supported(obmysql::MYSQL_PROTOCOL_TYPE type,
+                             const common::ObIArray<sql::ObExpr *> &exprs,
+                             const ColumnsFieldIArray &fields,
+                             const ObCharsetType result_charset,
+                             bool &supported);
+  // locate the datums of the current batch
+  int prepare_batch();
+  void set_row_idx(const int64_t row_idx) { row_idx_ = row_idx; }
+
+protected:
+  virtual int64_t get_cells_cnt() const { return exprs_.count(); }
+  virtual int encode_cell(
+      int64_t idx, char *buf,
+      int64_t len, int64_t &pos, char *bitmap) const;
+
+private:
+  static const int64_t COMMON_COLUMN_NUM = 16;
+  const common::ObIArray<sql::ObExpr *> &exprs_;
+  sql::ObEvalCtx &eval_ctx_;
+  const ObDataTypeCastParams dtc_params_;
+  const ColumnsFieldIArray *fields_;
+  share::schema::ObSchemaGetterGuard *schema_guard_;
+  uint64_t tenant_id_;
+  // datums of each column in the current batch, the datum of a row is batch_datums_[col][row_idx_]
+  // for batch result expr, and batch_datums_[col][0] otherwise
+  common::ObSEArray<const ObDatum *, COMMON_COLUMN_NUM> batch_datums_;
+  common::ObSEArray<bool, COMMON_COLUMN_NUM> is_batch_result_;
+  int64_t row_idx_;
+
+  DISALLOW_COPY_AND_ASSIGN(ObSMDatumRow);
+};
+
 } // end of namespace common
 } // end of namespace oceanbase
 
@@ -1506,6 +1506,7 @@ int ObServer::init_io()
         cpu_cnt = common::get_cpu_num();
       }
       io_config.disk_io_thread_count_ = GCONF.disk_io_thread_count;
+      io_config.enable_io_merge_ = GCONF._enable_io_request_merge;
       const int64_t max_io_depth = 256;
       ObTenantIOConfig server_tenant_io_config = ObTenantIOConfig::default_instance();
       if (OB_FAIL(ObIOManager::get_instance().set_io_config(io_config))) {
@@ -150,6 +150,7 @@ int ObServerReloadConfig::operator()()
     io_config.data_storage_io_timeout_ms_ = GCONF._data_storage_io_timeout / 1000L;
     io_config.data_storage_warning_tolerance_time_ = GCONF.data_storage_warning_tolerance_time;
     io_config.data_storage_error_tolerance_time_ = GCONF.data_storage_error_tolerance_time;
+    io_config.enable_io_merge_ = GCONF._enable_io_request_merge;
     if (OB_FAIL(ObIOManager::get_instance().set_io_config(io_config))) {
       real_ret = ret;
       LOG_WARN("reload io manager config fail, ", K(ret));
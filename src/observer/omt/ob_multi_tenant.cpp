@@ -961,6 +961,12 @@ int ObMultiTenant::update_palf_disk_config(ObTenantConfigGuard &tenant_config)
     ret = log_service->update_log_disk_util_threshold(
         tenant_config->log_disk_utilization_threshold,
         tenant_config->log_disk_utilization_limit_threshold);
+    if (OB_SUCC(ret)) {
+      ret = log_service->update_log_target_commit_latency(tenant_config->_log_target_commit_latency);
+    }
+    if (OB_SUCC(ret)) {
+      ret = log_service->update_log_hot_cache_size(tenant_config->_log_hot_cache_size);
+    }
   }
   return ret;
 }
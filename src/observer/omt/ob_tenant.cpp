@@ -375,6 +375,22 @@ void ObResourceGroup::check_worker_count(ObThWorker &w)
   }
 }
 
+bool ObResourceGroup::try_acquire_steal_token()
+{
+  bool bret = false;
+  if (!inited_ || req_queue_.size() <= 0) {
+    // the group is idle
+  } else if (nullptr != cgroup_ctrl_ && cgroup_ctrl_->is_valid()) {
+    // The group workers run in the cgroup of the group while the stealing worker runs in
+    // the cgroup of the tenant, a stolen request would escape the cpu shares of the group.
+  } else if (ATOMIC_AAF(&stealing_cnt_, 1) + ATOMIC_LOAD(&ass_token_cnt_) <= ATOMIC_LOAD(&max_token_cnt_)) {
+    bret = true;
+  } else {
+    release_steal_token();
+  }
+  return bret;
+}
+
 int ObResourceGroup::clear_worker()
 {
   int ret = OB_SUCCESS;
@@ -523,6 +539,7 @@ ObTenant::ObTenant(const int64_t id,
       sug_token_cnt_(0),
       token_cnt_(0),
       ass_token_cnt_(0),
+      blocked_worker_cnt_(0),
       lq_tokens_(0),
       used_lq_tokens_(0),
       last_calibrate_worker_ts_(0),
@@ -547,6 +564,8 @@ ObTenant::ObTenant(const int64_t id,
       actives_(0),
       tt_large_quries_(0),
       pop_normal_cnt_(0),
+      stolen_req_cnt_(0),
+      queue_time_hist_(),
       worker_pool_(),
       group_map_(group_map_buf_, sizeof(group_map_buf_)),
       lock_(),
@@ -960,6 +979,18 @@ int64_t ObTenant::worker_count_bound() const
   return bound;
 }
 
+int64_t ObTenant::target_token_cnt() const
+{
+  // Workers blocked in sched_wait() give their cpu out, lend their
+  // tokens to other workers so that the tenant needn't be configured
+  // with a large cpu_quota_concurrency to cover the blocking time.
+  // When the blocked workers come back, the extra workers are set
+  // inactive by check_worker_count(w).
+  const int64_t blocked = ATOMIC_LOAD(&blocked_worker_cnt_);
+  const int64_t token_cnt = ATOMIC_LOAD(&token_cnt_);
+  return token_cnt + std::max(0L, std::min(blocked, worker_count_bound() - token_cnt));
+}
+
 int ObTenant::get_new_request(
     ObThWorker &w,
     int64_t timeout,
@@ -1006,6 +1037,17 @@ int ObTenant::get_new_request(
       }
     } else if (wk_level > 0) {
       ret = multi_level_queue_->pop(task, wk_level, timeout);
+      if (nullptr == task && GCONF._enable_tenant_work_stealing) {
+        // An idle level worker helps the deeper levels, requests of level N only wait for
+        // requests of level N + 1, so it never blocks the requests of its own level.
+        for (int32_t level = MAX_REQUEST_LEVEL - 2; level > wk_level; level--) {
+          IGNORE_RETURN multi_level_queue_->try_pop(task, level);
+          if (nullptr != task) {
+            ret = OB_SUCCESS;
+            break;
+          }
+        }
+      }
     } else {
       const bool only_high_high_prio
           = w.Worker::get_tidx() == 1 && workers_.get_size() > 2;
@@ -1049,6 +1091,9 @@ int ObTenant::get_new_request(
           // If large query flag is set, we prefer large query.
           if (OB_SUCC(large_req_queue_.pop(task))) {
             w.set_large_query();
+          } else if (OB_SUCC(steal_group_request(w, task))) {
+            // help a busy resource group before waiting on the empty tenant queue, a worker
+            // holding the large query token gets here without popping the tenant queue
           } else {
             // Ignore return code from large queue and get request from
             // normal queue.
@@ -1084,6 +1129,88 @@ int ObTenant::get_new_request(
   return ret;
 }
 
+int ObTenant::steal_group_request(ObThWorker &w, ObLink *&task)
+{
+  int ret = OB_ENTRY_NOT_EXIST;
+  // the requests of the tenant queue go first, a stolen request never overtakes them
+  if (GCONF._enable_tenant_work_stealing && 0 == req_queue_.size()) {
+    ObResourceGroupNode* iter = NULL;
+    ObResourceGroup* group = nullptr;
+    while (OB_ENTRY_NOT_EXIST == ret && NULL != (iter = group_map_.quick_next(iter))) {
+      group = static_cast<ObResourceGroup*>(iter);
+      if (!group->try_acquire_steal_token()) {
+        // the group is idle, has its own cgroup or already runs as many requests as its max
+        // token count
+      } else if (OB_SUCC(group->req_queue_.pop(task, 0L)) && nullptr != task) {
+        group->atomic_inc_pop_cnt();
+        group->atomic_inc_stolen_cnt();
+        ATOMIC_INC(&stolen_req_cnt_);
+        // rpc sent while processing the request keeps the group of the request
+        w.set_group_id(group->get_group_id());
+        w.set_stolen_group(group);
+        if (static_cast<rpc::ObRequest*>(task)->large_retry_flag()) {
+          w.set_large_query();
+        }
+      } else {
+        group->release_steal_token();
+        task = nullptr;
+        ret = OB_ENTRY_NOT_EXIST;
+      }
+    }
+  }
+  return ret;
+}
+
+void ObTenant::finish_stolen_request(ObThWorker &w)
+{
+  ObResourceGroup *group = w.get_stolen_group();
+  if (nullptr != group) {
+    group->release_steal_token();
+    w.set_stolen_group(nullptr);
+    w.set_group_id(0);
+  }
+}
+
+void ObTenant::add_queue_time(ObThWorker &w, const int64_t queue_time)
+{
+  ObResourceGroup *group = nullptr != w.get_stolen_group() ? w.get_stolen_group() : w.get_group();
+  if (nullptr != group) {
+    group->get_queue_time_hist().add(queue_time);
+  } else {
+    queue_time_hist_.add(queue_time);
+  }
+}
+
+int64_t ObTenant::print_group_queue_time(char *buf, const int64_t buf_len) const
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  ObResourceGroupNode* iter = NULL;
+  const ObResourceGroup* group = nullptr;
+  // requests of the tenant queues are never stolen
+  if (OB_FAIL(databuff_printf(buf, buf_len, pos,
+              "group_id=0,sample_cnt=%ld,avg=%ld,p50=%ld,p90=%ld,p99=%ld,stolen=0;",
+              queue_time_hist_.get_total_count(), queue_time_hist_.get_avg_value(),
+              queue_time_hist_.get_percentile(50), queue_time_hist_.get_percentile(90),
+              queue_time_hist_.get_percentile(99)))) {
+    LOG_WARN("print tenant queue time failed", K(ret), K_(id));
+  }
+  while (OB_SUCC(ret) && NULL != (iter = const_cast<GroupMap&>(group_map_).quick_next(iter))) {
+    group = static_cast<const ObResourceGroup*>(iter);
+    const ObLog2Histogram &hist = group->get_queue_time_hist();
+    if (OB_FAIL(databuff_printf(buf, buf_len, pos,
+                "group_id=%d,sample_cnt=%ld,avg=%ld,p50=%ld,p90=%ld,p99=%ld,stolen=%lu;",
+                group->get_group_id(), hist.get_total_count(), hist.get_avg_value(),
+                hist.get_percentile(50), hist.get_percentile(90), hist.get_percentile(99),
+                group->get_stolen_req_cnt()))) {
+      // the buffer is full, the remaining groups are not printed
+      ret = OB_SUCCESS;
+      break;
+    }
+  }
+  return pos;
+}
+
 using oceanbase::obrpc::ObRpcPacket;
 inline bool is_high_prio(const ObRpcPacket &pkt)
 {
@@ -1411,7 +1538,7 @@ int ObTenant::check_worker_count()
     }
     actives_ = active_workers;
 
-    const auto diff = token_cnt_ - ass_token_cnt_;
+    const auto diff = target_token_cnt() - ass_token_cnt_;
     if (diff > 0) {
       int64_t succ_num = 0L;
       acquire_more_worker(diff, succ_num);
@@ -1456,9 +1583,10 @@ int ObTenant::check_worker_count(ObThWorker &w)
     IGNORE_RETURN workers_lock_.unlock();
     LOG_WARN("thread acquire nesting worker", K(w.get_tidx()), K(nesting_worker_has_init_));
   }
-  if (ass_token_cnt_ != token_cnt_ &&
+  const auto target_token_cnt = this->target_token_cnt();
+  if (ass_token_cnt_ != target_token_cnt &&
       OB_SUCC(workers_lock_.trylock())) {
-    const auto diff = token_cnt_ - ass_token_cnt_;
+    const auto diff = target_token_cnt - ass_token_cnt_;
     int tmp_ret = OB_SUCCESS;
     // ass_token_cnt_ maybe change before having acquired lock so we
     // check diff once more.
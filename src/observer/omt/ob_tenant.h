@@ -38,6 +38,7 @@
 #include "share/resource_manager/ob_cgroup_ctrl.h"
 #include "observer/omt/ob_tenant_meta.h"
 #include "lib/lock/ob_tc_rwlock.h"      // TCRWLock
+#include "lib/metrics/ob_log2_histogram.h"
 
 struct lua_State;
 int select_dump_tenant_info(lua_State*);
@@ -254,6 +255,8 @@ public:
     inited_(false),
     recv_req_cnt_(0),
     pop_req_cnt_(0),
+    stolen_req_cnt_(0),
+    stealing_cnt_(0),
     token_cnt_(0),
     ass_token_cnt_(0),
     min_token_cnt_(0),
@@ -271,6 +274,10 @@ public:
   uint64_t get_recv_req_cnt() const { return recv_req_cnt_; }
   void atomic_inc_pop_cnt() { ATOMIC_INC(&pop_req_cnt_); }
   uint64_t get_pop_req_cnt() const { return pop_req_cnt_; }
+  void atomic_inc_stolen_cnt() { ATOMIC_INC(&stolen_req_cnt_); }
+  uint64_t get_stolen_req_cnt() const { return stolen_req_cnt_; }
+  common::ObLog2Histogram &get_queue_time_hist() { return queue_time_hist_; }
+  const common::ObLog2Histogram &get_queue_time_hist() const { return queue_time_hist_; }
   int64_t get_token_cnt() const { return token_cnt_; }
   void set_token_cnt(const int64_t token_cnt) { token_cnt_ = token_cnt; };
   int64_t get_ass_token_cnt() const { return ass_token_cnt_; }
@@ -290,6 +297,11 @@ public:
   void check_worker_count();
   void check_worker_count(ObThWorker &w);
   int clear_worker();
+  // Workers of the tenant queues may take requests of a busy group, the requests being
+  // processed by the group workers and the stealing workers never exceed max_token_cnt_.
+  // No request is stolen while the groups have their own cgroups.
+  bool try_acquire_steal_token();
+  void release_steal_token() { ATOMIC_DEC(&stealing_cnt_); }
 
   lib::ObMutex workers_lock_;
 
@@ -303,6 +315,9 @@ private:
   volatile uint64_t recv_req_cnt_;           // Statistics requested to enqueue
   volatile uint64_t pop_req_cnt_;            // Statistics of Dequeue Requests
   volatile uint64_t last_pop_req_cnt_;       // Statistics of the request to leave the team the last time the token was dynamically adjusted
+  volatile uint64_t stolen_req_cnt_;         // Statistics of the requests processed by workers of other queues
+  int64_t stealing_cnt_;                     // The number of requests being processed by workers of other queues
+  common::ObLog2Histogram queue_time_hist_;  // Queue time of the requests dequeued, in us
 
   int64_t token_cnt_;                        // The current number of target threads
   int64_t ass_token_cnt_;                    // The number of threads actually allocated
@@ -342,7 +357,8 @@ public:
        "token_cnt = %ld,"
        "min_token_cnt = %ld,"
        "max_token_cnt = %ld,"
-       "ass_token_cnt = %ld ",
+       "ass_token_cnt = %ld,"
+       "stolen_req_cnt = %lu ",
        group->group_id_,
        group->req_queue_.size(),
        group->recv_req_cnt_,
@@ -350,7 +366,8 @@ public:
        group->token_cnt_,
        group->min_token_cnt_,
        group->max_token_cnt_,
-       group->ass_token_cnt_);
+       group->ass_token_cnt_,
+       group->stolen_req_cnt_);
     }
     return pos;
   }
@@ -392,6 +409,8 @@ public:
   enum { RQ_HIGH = QQ_MAX_PRIO, RQ_NORMAL, RQ_LOW, RQ_MAX_PRIO };
 
   enum { MAX_RESOURCE_GROUP = 8 };
+  // one of QUEUE_TIME_SAMPLE_INTERVAL requests dequeued by a worker records its queue time
+  enum { QUEUE_TIME_SAMPLE_INTERVAL = 16 };
 
   ObTenant(const int64_t id,
            const int64_t times_of_workers,
@@ -457,6 +476,19 @@ public:
       int64_t timeout,
       rpc::ObRequest *&req);
 
+  // record the queue time of the request got by worker w
+  void add_queue_time(ObThWorker &w, const int64_t queue_time);
+  // the stolen request of worker w has been processed
+  void finish_stolen_request(ObThWorker &w);
+  // normal workers blocked on rpc, gts or io, the tenant assigns one more token for
+  // each of them so the blocked workers don't take the cpu quota of the runnable ones
+  void inc_blocked_worker() { ATOMIC_INC(&blocked_worker_cnt_); }
+  void dec_blocked_worker() { ATOMIC_DEC(&blocked_worker_cnt_); }
+  int64_t blocked_worker_cnt() const { return ATOMIC_LOAD(&blocked_worker_cnt_); }
+  // per group sampled queue time summary for __all_virtual_dump_tenant_info, group 0 is the
+  // tenant queues
+  int64_t print_group_queue_time(char *buf, const int64_t buf_len) const;
+
   // receive request from network
   int recv_request(rpc::ObRequest &req);
   int recv_large_request(rpc::ObRequest &req);
@@ -473,6 +505,7 @@ public:
                K_(unit_min_cpu), K_(unit_max_cpu), K_(slice),
                K_(slice_remain), K_(token_cnt), K_(sug_token_cnt),
                K_(ass_token_cnt),
+               K_(blocked_worker_cnt),
                K_(lq_tokens),
                K_(used_lq_tokens),
                K_(stopped), K_(idle_us),
@@ -554,11 +587,15 @@ private:
   void release_lq_token();
 
   int64_t worker_count_bound() const;
+  // token_cnt_ plus the tokens lent to the blocked workers, bounded by worker_count_bound()
+  int64_t target_token_cnt() const;
 
   inline void pause_it(ObThWorker &w);
   inline void resume_it(ObThWorker &w);
 
   int pop_req(common::ObLink *&req, int64_t timeout);
+  // take a queued request of a busy resource group when the tenant queues are empty
+  int steal_group_request(ObThWorker &w, common::ObLink *&task);
 
   // read tenant variable PARALLEL_SERVERS_TARGET
   void check_parallel_servers_target();
@@ -597,6 +634,7 @@ protected:
   int64_t sug_token_cnt_;
   int64_t token_cnt_;
   int64_t ass_token_cnt_;
+  int64_t blocked_worker_cnt_;
   int64_t lq_tokens_;
   int64_t used_lq_tokens_;
   int64_t last_calibrate_worker_ts_;
@@ -633,6 +671,9 @@ protected:
   volatile uint64_t actives_;
   volatile uint64_t tt_large_quries_;
   volatile uint64_t pop_normal_cnt_;
+  volatile uint64_t stolen_req_cnt_;
+  // queue time of the requests of the tenant queues, in us
+  common::ObLog2Histogram queue_time_hist_;
 
   // free worker pool
   ObWorkerPool worker_pool_;
@@ -47,12 +47,13 @@ extern TLOCAL(bool, TLOCAL_NEED_WAIT_IN_LOCK_WAIT_MGR);
 ObThWorker::ObThWorker()
     : procor_(ObServer::get_instance().get_net_frame().get_xlator(), ObServer::get_instance().get_self()),
       is_inited_(false), tenant_(nullptr),
-      group_(nullptr), run_cond_(),
+      group_(nullptr), stolen_group_(nullptr), run_cond_(),
       pause_flag_(false), large_query_(false),
       query_start_time_(0), last_check_time_(0),
       can_retry_(true), need_retry_(false),
       active_(false), waiting_active_(false),
-      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false)
+      active_inactive_ts_(0L), lq_token_(false), has_add_to_cgroup_(false),
+      sched_wait_depth_(0), blocked_(false), dequeue_cnt_(0)
 {
 }
 
@@ -435,6 +436,9 @@ void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t
                 if (OB_LIKELY(nullptr != req)) {
                   req_recv_timestamp = req->get_receive_timestamp(); // Update backtrace printing parameters
                   EVENT_ADD(REQUEST_QUEUE_TIME, wait_end_time - req->get_enqueue_timestamp());
+                  if (0 == ++dequeue_cnt_ % ObTenant::QUEUE_TIME_SAMPLE_INTERVAL) {
+                    tenant_->add_queue_time(*this, wait_end_time - req->get_enqueue_timestamp());
+                  }
                   req->set_push_pop_diff(wait_end_time);
                   query_start_time_ = wait_end_time;
                   query_enqueue_time_ = req->get_enqueue_timestamp();
@@ -442,6 +446,9 @@ void ObThWorker::worker(int64_t &tenant_id, int64_t &req_recv_timestamp, int32_t
                   set_rpc_stat_srv(&(tenant_->rpc_stat_info_->rpc_stat_srv_));
                   req_start_time = ObTimeUtility::current_time();
                   process_request(*req);
+                  if (OB_UNLIKELY(nullptr != stolen_group_)) {
+                    tenant_->finish_stolen_request(*this);
+                  }
                   req_end_time = ObTimeUtility::current_time();
                   tenant_->add_worker_time(req_end_time - req_start_time);
                   query_enqueue_time_ = INT64_MAX;
@@ -508,6 +515,33 @@ int ObThWorker::check_large_query_quota()
   return ret;
 }
 
+// by self thread
+bool ObThWorker::sched_wait()
+{
+  if (0 == sched_wait_depth_++
+      && OB_NOT_NULL(tenant_)
+      && 0 == get_worker_level()
+      && nullptr == get_group()
+      && has_req_flag()
+      && GCONF._enable_blocked_worker_compensation) {
+    // group workers and nesting workers have their own tokens, they
+    // are not compensated.
+    blocked_ = true;
+    tenant_->inc_blocked_worker();
+  }
+  return true;
+}
+
+// by self thread
+bool ObThWorker::sched_run(int64_t waittime)
+{
+  if (sched_wait_depth_ > 0 && 0 == --sched_wait_depth_ && blocked_) {
+    blocked_ = false;
+    tenant_->dec_blocked_worker();
+  }
+  return Worker::sched_run(waittime);
+}
+
 void ObThWorker::th_created()
 {
   procor_.th_created();
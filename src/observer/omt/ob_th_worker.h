@@ -71,6 +71,12 @@ public:
   virtual int check_status() override;
   virtual int check_large_query_quota();
 
+  // The worker lends its token to the tenant while it's blocked on
+  // rpc, gts or io, see ObTenant::target_token_cnt().
+  virtual bool sched_wait() override;
+  virtual bool sched_run(int64_t waittime=0) override;
+  bool is_blocked() const { return blocked_; }
+
   // retry relating
   virtual bool can_retry() const;
   virtual void set_need_retry();
@@ -94,6 +100,9 @@ public:
   int64_t get_query_enqueue_time() const;
   ObTenant *get_tenant() { return tenant_; }
   ObResourceGroup *get_group() { return group_; }
+  // the resource group whose request is being processed by this worker of another queue
+  ObResourceGroup *get_stolen_group() { return stolen_group_; }
+  void set_stolen_group(ObResourceGroup *group) { stolen_group_ = group; }
 
 private:
   // SQL layer should not call disable_retry directly
@@ -115,6 +124,7 @@ private:
 
   ObTenant *tenant_;
   ObResourceGroup *group_;
+  ObResourceGroup *stolen_group_;
   common::ObThreadCond run_cond_;
 
   bool pause_flag_;
@@ -142,6 +152,11 @@ private:
   int64_t active_inactive_ts_;
   bool lq_token_;
   bool has_add_to_cgroup_;
+  // sched_wait() may be nested, only the outermost one blocks the worker
+  int64_t sched_wait_depth_;
+  bool blocked_;
+  // requests got by this worker, the queue time of some of them is sampled
+  int64_t dequeue_cnt_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObThWorker);
@@ -151,8 +166,10 @@ inline void ObThWorker::reset()
 {
   OB_ASSERT(!pause_flag_ && !active_);
   OB_ASSERT(!lq_token_);
+  OB_ASSERT(!blocked_);
   tenant_ = nullptr;
   group_ = nullptr;
+  stolen_group_ = nullptr;
   pause_flag_ = false;
   large_query_ = false;
   query_start_time_ = 0;
@@ -161,6 +178,8 @@ inline void ObThWorker::reset()
   need_retry_ = false;
   active_ = false;
   has_add_to_cgroup_ = false;
+  sched_wait_depth_ = 0;
+  blocked_ = false;
   unset_tidx();
 }
 
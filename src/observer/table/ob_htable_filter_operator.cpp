@@ -974,12 +974,15 @@ int ObHTableRowIterator::seek(const ObHTableCell &key)
 int ObHTableRowIterator::seek_or_skip_to_next_row(const ObHTableCell &cell)
 {
   int ret = OB_SUCCESS;
-  ObHTableCell* next_cell = NULL;
-  if (OB_FAIL(ObHTableUtils::create_last_cell_on_row(allocator_, cell, next_cell))) {
-    LOG_WARN("failed to create last cell", K(ret));
+  // the cells of a row are adjacent in both scan orders, so the remaining cells of the row are
+  // skipped by comparing the row key only, instead of comparing the whole cell with the last
+  // cell on the row.
+  ObString rowkey;
+  if (OB_FAIL(ob_write_string(allocator_, cell.get_rowkey(), rowkey))) {
+    LOG_WARN("failed to copy rowkey", K(ret));
   } else {
-    ret = seek(*next_cell);
-    next_cell->~ObHTableCell();
+    while (OB_SUCC(next_cell()) && curr_cell_.get_rowkey() == rowkey) {
+    }
     allocator_.reuse();
   }
   return ret;
@@ -236,6 +236,9 @@ public:
   void set_ttl(int32_t ttl_value) { row_iterator_.set_ttl(ttl_value); }
   // parse the filter string
   int parse_filter_string(common::ObArenaAllocator* allocator);
+  // the prefix which all the row keys passing the filter start with
+  bool get_row_key_prefix(ObString &prefix, bool &is_empty) const
+  { return NULL != hfilter_ && hfilter_->get_row_key_prefix(prefix, is_empty); }
 private:
   const ObTableQuery &query_;
   ObHTableRowIterator row_iterator_;
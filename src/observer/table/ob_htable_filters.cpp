@@ -208,6 +208,19 @@ bool RowFilter::filter_row()
   return filter_out_row_;
 }
 
+bool RowFilter::get_row_key_prefix(ObString &prefix, bool &is_empty) const
+{
+  // only the row keys equal to the value, or starting with it, pass the binary comparators.
+  // PrefixFilter is parsed into a RowFilter with the binaryprefix comparator, so it is covered too.
+  bool bret = false;
+  is_empty = false;
+  if (CompareOperator::EQUAL == cmp_op_ && NULL != comparator_ && comparator_->is_binary()) {
+    prefix = comparator_->get_comparator_value();
+    bret = true;
+  }
+  return bret;
+}
+
 ////////////////////////////////////////////////////////////////
 QualifierFilter::~QualifierFilter()
 {}
@@ -432,6 +445,33 @@ bool FilterListAND::filter_row_key(const ObHTableCell &first_row_cell)
   return bret;
 }
 
+bool FilterListAND::get_row_key_prefix(ObString &prefix, bool &is_empty) const
+{
+  // a row passes all the filters, so it starts with the longest prefix of them, and no row
+  // passes when one prefix does not start with another
+  bool bret = false;
+  ObString sub_prefix;
+  bool sub_is_empty = false;
+  is_empty = false;
+  const int64_t N = filters_.count();
+  for (int64_t i = 0; !is_empty && i < N; ++i) {
+    if (!filters_.at(i)->get_row_key_prefix(sub_prefix, sub_is_empty)) {
+      // no prefix of this filter
+    } else if (sub_is_empty) {
+      is_empty = true;
+      bret = true;
+    } else if (!bret) {
+      prefix = sub_prefix;
+      bret = true;
+    } else if (sub_prefix.prefix_match(prefix)) {
+      prefix = sub_prefix;
+    } else if (!prefix.prefix_match(sub_prefix)) {
+      is_empty = true;
+    }
+  } // end for
+  return bret;
+}
+
 bool FilterListAND::filter_row()
 {
   bool bret = false;
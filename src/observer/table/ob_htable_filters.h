@@ -67,6 +67,9 @@ public:
 
   /// Primarily used to check for conflicts with scans(such as scans that do not read a full row at a time).
   virtual bool has_filter_row() = 0;
+  /// The prefix which all the row keys passing the filter start with, used to narrow the scan range.
+  /// is_empty is set when no row key passes the filter at all, such as conflicting prefixes.
+  virtual bool get_row_key_prefix(ObString &prefix, bool &is_empty) const = 0;
 
   void set_reversed(bool reversed) { is_reversed_ = reversed; }
   bool is_reversed() const { return is_reversed_; }
@@ -98,6 +101,8 @@ public:
   { UNUSED(cells); return common::OB_SUCCESS; }
   virtual bool filter_row() override { return false; }
   virtual bool has_filter_row() override { return false; }
+  virtual bool get_row_key_prefix(ObString &prefix, bool &is_empty) const override
+  { UNUSED(prefix); UNUSED(is_empty); return false; }
 
   static const char* compare_operator_to_string(CompareOperator cmp_op);
 private:
@@ -112,6 +117,9 @@ public:
   {}
   virtual ~Comparable() {}
   virtual int compare_to(const ObString &b) = 0;
+  // whether compare_to compares the bytes of b, or a prefix of them, with comparator_value_
+  virtual bool is_binary() const { return false; }
+  const ObString &get_comparator_value() const { return comparator_value_; }
   VIRTUAL_TO_STRING_KV("comprable", "Comprable");
 protected:
   ObString comparator_value_;
@@ -127,6 +135,7 @@ public:
   {}
   virtual ~BinaryComparator() {}
   virtual int compare_to(const ObString &b) override;
+  virtual bool is_binary() const override { return true; }
   TO_STRING_KV("comparable", "BinaryComparator");
 private:
   // disallow copy
@@ -141,6 +150,7 @@ public:
   {}
   virtual ~BinaryPrefixComparator() {}
   virtual int compare_to(const ObString &b) override;
+  virtual bool is_binary() const override { return true; }
   TO_STRING_KV("comparable", "BinaryPrefixComparator");
 private:
   // disallow copy
@@ -210,6 +220,7 @@ public:
   virtual bool filter_row_key(const ObHTableCell &first_row_cell) override;
   virtual int filter_cell(const ObHTableCell &cell, ReturnCode &ret_code) override;
   virtual bool filter_row() override;
+  virtual bool get_row_key_prefix(ObString &prefix, bool &is_empty) const override;
   TO_STRING_KV("filter", "RowFilter",
                "cmp_op", compare_operator_to_string(cmp_op_),
                "comparator", comparator_);
@@ -295,6 +306,7 @@ public:
   virtual bool filter_row_key(const ObHTableCell &first_row_cell) override;
   virtual int filter_cell(const ObHTableCell &cell, ReturnCode &ret_code) override;
   virtual bool filter_row() override;
+  virtual bool get_row_key_prefix(ObString &prefix, bool &is_empty) const override;
 private:
   static ReturnCode merge_return_code(ReturnCode rc, ReturnCode local_rc);
   ObSEArray<Filter*, 8> seek_hint_filters_;
@@ -653,7 +653,8 @@ ObTableApiMultiInsertRowIterator::ObTableApiMultiInsertRowIterator()
   : batch_operation_(NULL),
     row_idx_(0),
     batch_cnt_(0),
-    is_iter_pause_(false)
+    is_iter_pause_(false),
+    iter_all_rows_(false)
 {
 }
 
@@ -667,6 +668,7 @@ void ObTableApiMultiInsertRowIterator::reset()
   row_idx_ = 0;
   batch_cnt_ = 0;
   is_iter_pause_ = false;
+  iter_all_rows_ = false;
   ObTableApiInsertRowIterator::reset();
 }
 
@@ -702,7 +704,7 @@ int ObTableApiMultiInsertRowIterator::get_next_row(common::ObNewRow *&row)
     LOG_WARN("Fail to construct row, ", K(ret), K(row_idx_));
   } else {
     row_idx_++;
-    is_iter_pause_ = true;
+    is_iter_pause_ = !iter_all_rows_;
     LOG_DEBUG("Api insert row iter, ", K(*row), K_(row_idx));
   }
   return ret;
@@ -113,11 +113,14 @@ public:
   int open(const ObTableBatchOperation &table_operation);
   virtual int get_next_row(common::ObNewRow *&row);
   OB_INLINE void continue_iter() { is_iter_pause_ = false; }
+  // iterate all the rows of the batch in one pass instead of pausing after each row
+  OB_INLINE void set_iter_all_rows(const bool iter_all_rows) { iter_all_rows_ = iter_all_rows; }
 private:
   const ObTableBatchOperation *batch_operation_;
   int64_t row_idx_;
   int64_t batch_cnt_;
   bool is_iter_pause_;
+  bool iter_all_rows_;
 };
 
 
@@ -22,6 +22,7 @@
 #include "lib/string/ob_strings.h"
 #include "lib/rc/ob_rc.h"
 #include "storage/tx/ob_trans_service.h"
+#include "lib/compress/ob_compressor_pool.h"
 
 using namespace oceanbase::observer;
 using namespace oceanbase::common;
@@ -82,6 +83,78 @@ int ObTableQuerySyncSession::init()
   return ret;
 }
 
+void ObTableQuerySyncSession::init_compressor_type(const ObTableQuery &query)
+{
+  compressor_type_ = INVALID_COMPRESSOR;
+  if (query.get_htable_filter().is_valid()) {
+    // hbase model, compress the result packets
+    if (OB_SUCCESS != ObCompressorPool::get_instance().get_compressor_type(
+                        GCONF.tableapi_transport_compress_func, compressor_type_)
+        || NONE_COMPRESSOR == compressor_type_) {
+      compressor_type_ = INVALID_COMPRESSOR;
+    }
+  }
+}
+
+int ObTableQuerySyncSession::prefetch_result(const int64_t timeout_ts)
+{
+  int ret = OB_SUCCESS;
+  ObTableQueryResult *query_result = nullptr;
+  prefetch_result_.reset();
+  prefetch_is_end_ = false;
+  has_prefetch_result_ = false;
+  if (OB_ISNULL(result_iterator_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("query result iterator null", K(ret));
+  } else if (ObTimeUtility::current_time() > timeout_ts) {
+    ret = OB_TRANS_TIMEOUT;
+    LOG_WARN("exceed operatiton timeout", K(ret));
+  } else if (FALSE_IT(result_iterator_->set_one_result(&prefetch_result_))) {
+  } else if (OB_FAIL(result_iterator_->get_next_result(query_result))) {
+    if (OB_ITER_END == ret) {
+      prefetch_is_end_ = true;
+      ret = OB_SUCCESS;
+    } else {
+      LOG_WARN("fail to prefetch scan result", K(ret));
+    }
+  } else {
+    prefetch_is_end_ = !result_iterator_->has_more_result();
+  }
+  if (OB_SUCC(ret) || prefetch_result_.get_row_count() > 0) {
+    // the rows scanned before the error can not be scanned again, they are responded by the
+    // next query_next, and the following rows are scanned by the query_next after it
+    has_prefetch_result_ = true;
+  } else {
+    // the next query_next scans the result with its own timeout
+    prefetch_result_.reset();
+  }
+  return ret;
+}
+
+int ObTableQuerySyncSession::fetch_prefetch_result(ObIAllocator &allocator, ObTableQuerySyncResult &result)
+{
+  int ret = OB_SUCCESS;
+  has_prefetch_result_ = false;
+  // the property names refer to the session, which may be destroyed before the response
+  const ObIArray<ObString> &select_columns = query_.get_select_columns();
+  ObString name;
+  for (int64_t i = 0; OB_SUCC(ret) && i < prefetch_result_.get_property_count(); ++i) {
+    if (OB_FAIL(ob_write_string(allocator, select_columns.at(i), name))) {
+      LOG_WARN("failed to copy column name", K(ret));
+    } else if (OB_FAIL(result.add_property_name(name))) {
+      LOG_WARN("failed to add column name", K(ret));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(result.add_all_row(prefetch_result_))) {
+    LOG_WARN("failed to add prefetch rows", K(ret));
+  } else {
+    result.is_end_ = prefetch_is_end_;
+  }
+  prefetch_result_.reset();
+  return ret;
+}
+
 ObTableQuerySyncSession::~ObTableQuerySyncSession()
 {
   if (OB_NOT_NULL(iterator_mementity_)) {
@@ -155,28 +228,69 @@ uint64_t ObQuerySyncMgr::generate_query_sessid()
   return ATOMIC_AAF(&session_id_, 1);
 }
 
-int ObQuerySyncMgr::get_query_session(uint64_t sessid, ObTableQuerySyncSession *&query_session)
+int ObQuerySyncMgr::get_query_session(uint64_t sessid,
+                                      const int64_t timeout_ts,
+                                      ObTableQuerySyncSession *&query_session)
 {
   int ret = OB_SUCCESS;
-  get_locker(sessid).lock();
-  if (OB_FAIL(query_session_map_.get_refactored(sessid, query_session))) {
-    if (OB_HASH_NOT_EXIST != ret) {
+  bool need_wait = true;
+  ObTableQuerySyncSession *waited_session = nullptr;
+  uint32_t prefetch_seq = 0;
+  while (OB_SUCC(ret) && need_wait) {
+    need_wait = false;
+    get_locker(sessid).lock();
+    if (nullptr != waited_session) {
+      waited_session->prefetch_waiter_cnt_--;
+      waited_session = nullptr;
+    }
+    if (OB_FAIL(query_session_map_.get_refactored(sessid, query_session))) {
+      if (OB_HASH_NOT_EXIST != ret) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("failed to get session from query session map", K(ret));
+      }
+    } else if (OB_ISNULL(query_session)) {
       ret = OB_ERR_UNEXPECTED;
-      LOG_WARN("failed to get session from query session map", K(ret));
+      LOG_WARN("Unexpected null query session", K(ret), K(sessid));
+    } else if (query_session->is_in_use()) {
+      if (!query_session->is_prefetching()) { // one session cannot be held concurrently
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("query session already in use", K(sessid));
+      } else if (ObTimeUtility::current_time() < timeout_ts) {
+        // the previous request is still prefetching the next result. The seq is read with the
+        // locker held, so that the wake up of the prefetch finished after the check is not missed
+        need_wait = true;
+        prefetch_seq = query_session->prefetch_cond_.get_seq();
+        query_session->prefetch_waiter_cnt_++;
+        waited_session = query_session;
+      } else {
+        ret = OB_TIMEOUT;
+        LOG_WARN("wait for the prefetch of query session timeout", K(ret), K(sessid));
+      }
+    } else {
+      query_session->set_in_use(true);
+    }
+    get_locker(sessid).unlock();
+    if (need_wait) {
+      const int64_t remain_us = timeout_ts - ObTimeUtility::current_time();
+      if (remain_us > 0) {
+        (void)waited_session->prefetch_cond_.wait(prefetch_seq, remain_us);
+      }
     }
-  } else if (OB_ISNULL(query_session)) {
-    ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("Unexpected null query session", K(ret), K(sessid));
-  } else if (query_session->is_in_use()) { // one session cannot be held concurrently
-    ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("query session already in use", K(sessid));
-  } else {
-    query_session->set_in_use(true);
   }
-  get_locker(sessid).unlock();
   return ret;
 }
 
+void ObQuerySyncMgr::finish_prefetch(uint64_t sessid, ObTableQuerySyncSession &query_session)
+{
+  get_locker(sessid).lock();
+  query_session.set_prefetching(false);
+  query_session.set_in_use(false);
+  // only the query_next of this session is woken up, the session may be recycled once the
+  // locker is released
+  query_session.prefetch_cond_.signal();
+  get_locker(sessid).unlock();
+}
+
 int ObQuerySyncMgr::set_query_session(uint64_t sessid, ObTableQuerySyncSession *query_session)
 {
   int ret = OB_SUCCESS;
@@ -205,7 +319,7 @@ void ObQuerySyncMgr::clean_timeout_query_session()
         ret = OB_ERR_NULL_VALUE;
         (void)query_session_map_.erase_refactored(sess_id);
         LOG_WARN("unexpected null query sesion", K(ret));
-      } else if (query_session->is_in_use()) {
+      } else if (query_session->is_in_use() || query_session->has_prefetch_waiter()) {
       } else if (query_session->timeout_ts_ >= ObTimeUtility::current_time()) {
       } else {
         ObObjectID tenant_id = query_session->get_tenant_id();
@@ -299,7 +413,9 @@ ObTableQuerySyncP::ObTableQuerySyncP(const ObGlobalContext &gctx)
       result_row_count_(0),
       query_session_id_(0),
       allocator_(ObModIds::TABLE_PROC),
-      query_session_(nullptr)
+      query_session_(nullptr),
+      timeout_ts_(0),
+      need_prefetch_(false)
 {}
 
 int ObTableQuerySyncP::deserialize()
@@ -349,6 +465,7 @@ void ObTableQuerySyncP::reset_ctx()
   result_row_count_ = 0;
   query_session_ = nullptr;
   table_service_ctx_ = nullptr;
+  need_prefetch_ = false;
   ObTableApiProcessorBase::reset_ctx();
 }
 
@@ -414,7 +531,7 @@ int ObTableQuerySyncP::get_query_session(uint64_t sessid, ObTableQuerySyncSessio
       OB_DELETE(ObTableQuerySyncSession, ObModIds::TABLE_PROC, query_session);
     } else {}
   } else if (ObQueryOperationType::QUERY_NEXT == arg_.query_type_) {
-    if (OB_FAIL(ObQuerySyncMgr::get_instance().get_query_session(sessid, query_session))) {
+    if (OB_FAIL(ObQuerySyncMgr::get_instance().get_query_session(sessid, get_timeout_ts(), query_session))) {
       LOG_WARN("fail to get query session from query sync mgr", K(ret), K(sessid));
     } else if (OB_ISNULL(query_session)) {
       ret = OB_ERR_UNEXPECTED;
@@ -443,6 +560,10 @@ int ObTableQuerySyncP::query_scan_with_old_context(const int64_t timeout)
   if (OB_ISNULL(result_iterator)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("query result iterator null", K(ret));
+  } else if (query_session_->has_prefetch_result()) {
+    if (OB_FAIL(query_session_->fetch_prefetch_result(allocator_, result_))) {
+      LOG_WARN("fail to fetch prefetch result", K(ret));
+    }
   } else {
     ObTableQueryResult *query_result = nullptr;
     result_iterator->set_one_result(&result_);  // set result_ as container
@@ -481,6 +602,7 @@ int ObTableQuerySyncP::query_scan_with_new_context(
     }
   } else if (result_iterator->has_more_result()){
     result_.is_end_ = false;
+    query_session->init_compressor_type(arg_.query_);
     query_session->deep_copy_select_columns(arg_.query_);
     query_session->set_result_iterator(dynamic_cast<ObNormalTableQueryResultIterator *>(result_iterator));
     query_session->set_trans_desc(trans_desc_); // save processor's trans_desc_ to query session
@@ -595,10 +717,15 @@ int ObTableQuerySyncP::try_process()
         LOG_WARN("faild to destory query session", K(ret));
       }
       ret = tmp_ret;
+    } else if (FALSE_IT(set_compressor_type())) {
     } else if (result_.is_end_) {
       if (OB_FAIL(destory_query_session(false))) {
         LOG_WARN("fail to destory query session", K(ret), K(query_session_id_));
       }
+    } else if (GCONF._enable_tableapi_query_prefetch) {
+      // keep the session in use until the next result is prefetched in after_process
+      query_session_->set_prefetching(true);
+      need_prefetch_ = true;
     } else {
       query_session_->set_in_use(false);
     }
@@ -609,6 +736,41 @@ int ObTableQuerySyncP::try_process()
   return ret;
 }
 
+void ObTableQuerySyncP::set_compressor_type()
+{
+  const ObCompressorType compressor_type = query_session_->get_compressor_type();
+  if (INVALID_COMPRESSOR != compressor_type) {
+    this->set_result_compress_type(compressor_type);
+  }
+}
+
+int ObTableQuerySyncP::after_process(int error_code)
+{
+  // the audit of this request is closed before the next result is scanned
+  int ret = ParentType::after_process(error_code);
+  if (need_prefetch_) {
+    prefetch_next_result();
+  }
+  return ret;
+}
+
+// the result_ has been responded, scan the next result of the session while it is on
+// the way to the client, so that the next query_next needs not to wait for the scan.
+void ObTableQuerySyncP::prefetch_next_result()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(query_session_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null query session", K(ret), K(query_session_id_));
+  } else {
+    if (OB_FAIL(query_session_->prefetch_result(timeout_ts_))) {
+      LOG_WARN("fail to prefetch next result", K(ret), K(query_session_id_));
+    }
+    ObQuerySyncMgr::get_instance().finish_prefetch(query_session_id_, *query_session_);
+  }
+  need_prefetch_ = false;
+}
+
 // session.in_use_ must be true
 int ObTableQuerySyncP::destory_query_session(bool need_rollback_trans)
 {
@@ -17,6 +17,7 @@
 #include "share/table/ob_table_rpc_proxy.h"
 #include "ob_table_rpc_processor.h"
 #include "ob_table_service.h"
+#include "lib/lock/ob_fcond.h"
 
 namespace oceanbase
 {
@@ -44,7 +45,14 @@ public:
       result_iterator_(nullptr),
       allocator_(ObModIds::TABLE_PROC),
       table_service_ctx_(allocator_),
-      iterator_mementity_(nullptr)
+      iterator_mementity_(nullptr),
+      compressor_type_(common::INVALID_COMPRESSOR),
+      is_prefetching_(false),
+      has_prefetch_result_(false),
+      prefetch_is_end_(false),
+      prefetch_result_(),
+      prefetch_cond_(),
+      prefetch_waiter_cnt_(0)
   {}
   ~ObTableQuerySyncSession();
 
@@ -59,6 +67,19 @@ public:
   ObNormalTableQueryResultIterator *get_result_iterator() { return result_iterator_; }
   ObArenaAllocator *get_allocator() {return &allocator_;}
   common::ObObjectID get_tenant_id() { return tenant_id_; }
+  // the results of hbase model queries are compressed by tableapi_transport_compress_func
+  void init_compressor_type(const ObTableQuery &query);
+  common::ObCompressorType get_compressor_type() const { return compressor_type_; }
+  // the next result is scanned into prefetch_result_ after the current one is responded,
+  // and taken by the next query_next. A failed prefetch without any row is discarded, and
+  // the next query_next scans the result by itself.
+  void set_prefetching(bool is_prefetching) { is_prefetching_ = is_prefetching; }
+  bool is_prefetching() const { return is_prefetching_; }
+  bool has_prefetch_result() const { return has_prefetch_result_; }
+  int prefetch_result(const int64_t timeout_ts);
+  int fetch_prefetch_result(common::ObIAllocator &allocator, table::ObTableQuerySyncResult &result);
+  // the query_next waiting for the prefetch keeps the session from being recycled
+  bool has_prefetch_waiter() const { return prefetch_waiter_cnt_ > 0; }
 
 public:
   sql::TransState* get_trans_state() {return &trans_state_;}
@@ -74,6 +95,14 @@ private:
   ObArenaAllocator allocator_;
   ObTableServiceQueryCtx table_service_ctx_;
   lib::MemoryContext iterator_mementity_;
+  common::ObCompressorType compressor_type_;
+  bool is_prefetching_;
+  bool has_prefetch_result_;
+  bool prefetch_is_end_;
+  table::ObTableQueryResult prefetch_result_;
+  // signaled when the session is released by its prefetch
+  common::ObFCond prefetch_cond_;
+  int64_t prefetch_waiter_cnt_;
 
 private:
   // txn control
@@ -118,8 +147,10 @@ public:
   };
 
 public:
-  int get_query_session(uint64_t sessid, ObTableQuerySyncSession *&query_sess_ctx);
+  int get_query_session(uint64_t sessid, const int64_t timeout_ts, ObTableQuerySyncSession *&query_sess_ctx);
   int set_query_session(uint64_t sessid, ObTableQuerySyncSession *query_sess_ctx);
+  // release the session held by the prefetch and wake up the query_next waiting for it
+  void finish_prefetch(uint64_t sessid, ObTableQuerySyncSession &query_session);
   void clean_timeout_query_session();
 
 public:
@@ -166,6 +197,7 @@ public:
 protected:
   virtual int check_arg() override;
   virtual int try_process() override;
+  virtual int after_process(int error_code) override;
   virtual void reset_ctx() override;
   virtual void audit_on_finish() override;
   virtual uint64_t get_request_checksum() override;
@@ -187,6 +219,8 @@ private:
   int query_scan_with_old_context(const int64_t timeout);
   int query_scan_with_new_context(ObTableQuerySyncSession * session_ctx, table::ObTableQueryResultIterator *result_iterator,
     const int64_t timeout);
+  void set_compressor_type();
+  void prefetch_next_result();
 
 private:
   void set_trans_from_session(ObTableQuerySyncSession *query_session);
@@ -199,6 +233,7 @@ private:
   ObArenaAllocator allocator_;
   ObTableQuerySyncSession *query_session_;
   int64_t timeout_ts_;
+  bool need_prefetch_;
 };
 
 } // end namespace observer
@@ -429,6 +429,7 @@ int ObTableService::multi_put(ObTableServiceCtx &ctx,
       LOG_WARN("table id is invalid", K(ret), K(table_id));
     } else if (OB_FAIL(multi_put_iter.init(*access_service, *schema_service_, ctx))) {
       LOG_WARN("Fail to init multi put iterator, ", K(ret), K(table_id));
+    } else if (FALSE_IT(multi_put_iter.set_iter_all_rows(true))) {
     } else if (OB_FAIL(multi_put_iter.open(batch_operation))) {
       LOG_WARN("Fail to open multi put iterator, ", K(ret), K(table_id));
     } else if (OB_FAIL(build_table_param(table_id, multi_put_iter.get_column_ids(), table_param))) {
@@ -447,31 +448,49 @@ int ObTableService::multi_put(ObTableServiceCtx &ctx,
       dml_param.snapshot_ = ctx.param_.processor_->get_tx_snapshot();
       const int64_t N = batch_operation.count();
       NG_TRACE_EXT(insertup_calc_new_row, OB_ID(input_count), N);
-      for (int64_t i = 0; OB_SUCCESS == ret && i < N; ++i) {
-        multi_put_iter.continue_iter();
-        if (OB_FAIL(access_service->put_rows(
-            ls_id,
-            tablet_id,
-            *ctx.param_.processor_->get_trans_desc(),
-            dml_param,
-            multi_put_iter.get_column_ids(),
-            &multi_put_iter,
-            affected_rows))) {
-          if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
-            LOG_WARN("failed to put rows", K(ret), K(table_id));
-          } else {
-            NG_TRACE(locked);
-          }
-        } else if (OB_FAIL(add_one_result(result, ObTableOperationType::INSERT_OR_UPDATE, OB_SUCCESS, affected_rows))) {
-          LOG_WARN("failed to add result", K(ret));
+      // put never fails on an existing row, so all the rows of the batch are written by one
+      // put_rows, which shares the tablet and dml running ctx among them, and every row
+      // affects exactly one row.
+      if (OB_FAIL(access_service->put_rows(
+          ls_id,
+          tablet_id,
+          *ctx.param_.processor_->get_trans_desc(),
+          dml_param,
+          multi_put_iter.get_column_ids(),
+          &multi_put_iter,
+          affected_rows))) {
+        if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
+          LOG_WARN("failed to put rows", K(ret), K(table_id));
+        } else {
+          NG_TRACE(locked);
         }
-      } // end for
+      } else if (OB_FAIL(add_multi_put_results(N, affected_rows, result))) {
+        LOG_WARN("failed to add results of batch put", K(ret), K(N), K(affected_rows));
+      }
     }
   }
 
   return ret;
 }
 
+int ObTableService::add_multi_put_results(const int64_t op_cnt,
+                                          const int64_t affected_rows,
+                                          ObTableBatchOperationResult &result)
+{
+  int ret = OB_SUCCESS;
+  // every row of the batch is put, even if its key is repeated in the batch
+  if (OB_UNLIKELY(op_cnt != affected_rows)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected affected rows of batch put", K(ret), K(op_cnt), K(affected_rows));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < op_cnt; ++i) {
+    if (OB_FAIL(add_one_result(result, ObTableOperationType::INSERT_OR_UPDATE, OB_SUCCESS, 1))) {
+      LOG_WARN("failed to add result", K(ret));
+    }
+  } // end for
+  return ret;
+}
+
 int ObTableService::do_multi_insert_or_update(ObTableServiceGetCtx &ctx,
                                               const ObTableBatchOperation &batch_operation,
                                               ObTableBatchOperationResult &result)
@@ -2001,6 +2020,75 @@ int ObTableService::fill_query_scan_ranges(ObTableServiceCtx &ctx,
   return ret;
 }
 
+// The rows of a htable whose row key K does not start with the prefix of the filter never pass
+// it, so the scan ranges are narrowed to [(prefix, MIN, MIN), (successor of prefix, MIN, MIN))
+// and such rows are not read from the storage at all. When no row passes the filter, every range
+// is replaced by a false range, which the storage skips.
+int ObTableService::narrow_htable_scan_ranges(ObTableServiceCtx &ctx,
+                                              const ObString &row_key_prefix,
+                                              const bool is_empty,
+                                              storage::ObTableScanParam &scan_param)
+{
+  int ret = OB_SUCCESS;
+  const int64_t rowkey_cnt = ctx.columns_type_.count();
+  ObObj *lower_objs = NULL;
+  ObObj *upper_objs = NULL;
+  char *successor = NULL;
+  int64_t successor_len = row_key_prefix.length();
+  if (is_empty) {
+    const int64_t N = scan_param.key_ranges_.count();
+    for (int64_t i = 0; i < N; ++i) {
+      scan_param.key_ranges_.at(i).set_false_range();
+    } // end for
+    LOG_DEBUG("no row passes the htable filter", K(scan_param.key_ranges_));
+  } else if (row_key_prefix.empty() || rowkey_cnt <= 0
+      || CS_TYPE_BINARY != ctx.columns_type_.at(0).get_collation_type()) {
+    // the storage order of K is not the byte order of the prefix
+  } else if (OB_ISNULL(lower_objs = static_cast<ObObj*>(ctx.param_.allocator_->alloc(sizeof(ObObj) * rowkey_cnt)))
+             || OB_ISNULL(upper_objs = static_cast<ObObj*>(ctx.param_.allocator_->alloc(sizeof(ObObj) * rowkey_cnt)))
+             || OB_ISNULL(successor = static_cast<char*>(ctx.param_.allocator_->alloc(successor_len)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("no memory", K(ret), K(rowkey_cnt), K(successor_len));
+  } else {
+    MEMCPY(successor, row_key_prefix.ptr(), successor_len);
+    while (successor_len > 0 && static_cast<uint8_t>(successor[successor_len - 1]) == UINT8_MAX) {
+      --successor_len;
+    }
+    if (successor_len > 0) {
+      ++successor[successor_len - 1];
+    }
+    for (int64_t i = 0; i < rowkey_cnt; ++i) {
+      lower_objs[i].set_min_value();
+      upper_objs[i].set_min_value();
+    }
+    lower_objs[0].set_varbinary(row_key_prefix);
+    upper_objs[0].set_varbinary(ObString(successor_len, successor));
+    const ObRowkey lower_key(lower_objs, rowkey_cnt);
+    const ObRowkey upper_key(upper_objs, rowkey_cnt);
+    const int64_t N = scan_param.key_ranges_.count();
+    for (int64_t i = 0; i < N; ++i) {
+      ObNewRange &range = scan_param.key_ranges_.at(i);
+      ObNewRange narrowed_range = range;
+      if (range.start_key_.is_min_row() || range.start_key_.compare(lower_key) < 0) {
+        narrowed_range.start_key_ = lower_key;
+        narrowed_range.border_flag_.set_inclusive_start();
+      }
+      // all the bytes of the prefix are 0xff, no upper bound
+      if (successor_len > 0
+          && (range.end_key_.is_max_row() || range.end_key_.compare(upper_key) >= 0)) {
+        narrowed_range.end_key_ = upper_key;
+        narrowed_range.border_flag_.unset_inclusive_end();
+      }
+      // keep the empty range as it was, the filter drops all its rows anyway
+      if (!narrowed_range.empty()) {
+        range = narrowed_range;
+      }
+    } // end for
+    LOG_DEBUG("narrow htable scan ranges", K(row_key_prefix), K(scan_param.key_ranges_));
+  }
+  return ret;
+}
+
 int ObTableService::fill_query_scan_param(ObTableServiceCtx &ctx,
                                           const ObIArray<uint64_t> &output_column_ids,
                                           int64_t schema_version,
@@ -2235,6 +2323,8 @@ int ObTableService::execute_query(ObTableServiceQueryCtx &ctx, const ObTableQuer
   int64_t padding_num = 0;
   ObHColumnDescriptor hcolumn_desc;
   ObHColumnDescriptor *p_hcolumn_desc = NULL;
+  ObString row_key_prefix;
+  bool is_empty_prefix = false;
   ObAccessService *access_service = MTL(ObAccessService *);
   const uint64_t tenant_id = MTL_ID();
   if (query.get_htable_filter().is_valid()) {
@@ -2267,6 +2357,11 @@ int ObTableService::execute_query(ObTableServiceQueryCtx &ctx, const ObTableQuer
                                             (table_id != index_id) ? padding_num : -1,
                                             ctx.scan_param_))) {
     LOG_WARN("failed to fill range", K(ret));
+  } else if (NULL != p_hcolumn_desc
+             && ctx.htable_result_iterator_->get_row_key_prefix(row_key_prefix, is_empty_prefix)
+             && OB_FAIL(narrow_htable_scan_ranges(ctx, row_key_prefix, is_empty_prefix,
+                                                  ctx.scan_param_))) {
+    LOG_WARN("failed to narrow htable scan ranges", K(ret), K(row_key_prefix), K(is_empty_prefix));
   } else if (OB_FAIL(fill_query_scan_param(ctx, output_column_ids, schema_version,
                                            query.get_scan_order(), index_id, query.get_limit(),
                                            query.get_offset(), ctx.scan_param_, for_update))) {
@@ -239,13 +239,16 @@ private:
                                           common::ObIArray<sql::ObExprResType> *columns_type);
 
   int insert_or_update_can_use_put(table::ObTableEntityType entity_type, uint64_t table_id, const table::ObITableEntity &entity, bool &use_put);
-  int add_one_result(ObTableBatchOperationResult &result,
-                     table::ObTableOperationType::Type op_type,
-                     int32_t error_code,
-                     int64_t affected_rows);
+  static int add_one_result(ObTableBatchOperationResult &result,
+                            table::ObTableOperationType::Type op_type,
+                            int32_t error_code,
+                            int64_t affected_rows);
   int do_put(ObTableServiceCtx &ctx, const ObTableOperation &table_operation, ObTableOperationResult &result);
   int do_insert_or_update(ObTableServiceGetCtx &ctx, const ObTableOperation &table_operation, ObTableOperationResult &result);
   int multi_put(ObTableServiceCtx &ctx, const ObTableBatchOperation &batch_operation, ObTableBatchOperationResult &result);
+  static int add_multi_put_results(const int64_t op_cnt,
+                                   const int64_t affected_rows,
+                                   ObTableBatchOperationResult &result);
   int do_multi_insert_or_update(ObTableServiceGetCtx &ctx,
                                 const ObTableBatchOperation &batch_operation,
                                 ObTableBatchOperationResult &result);
@@ -311,6 +314,10 @@ private:
                              const ObTableQuery &query,
                              int64_t padding_num,
                              storage::ObTableScanParam &scan_param);
+  static int narrow_htable_scan_ranges(ObTableServiceCtx &ctx,
+                                       const ObString &row_key_prefix,
+                                       const bool is_empty,
+                                       storage::ObTableScanParam &scan_param);
   int fill_query_scan_param(ObTableServiceCtx &ctx,
                             const common::ObIArray<uint64_t> &output_column_ids,
                             int64_t schema_version,
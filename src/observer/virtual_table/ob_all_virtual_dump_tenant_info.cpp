@@ -172,6 +172,18 @@ int ObAllVirtualDumpTenantInfo::inner_get_next_row(common::ObNewRow *&row)
           //large_queued
           cells[i].set_int(t.large_req_queue_.size());
           break;
+        case OB_APP_MIN_COLUMN_ID + 32:
+          //steal_req_cnt
+          cells[i].set_int(t.stolen_req_cnt_);
+          break;
+        case OB_APP_MIN_COLUMN_ID + 33: {
+          //group_queue_time
+          const int64_t len = t.print_group_queue_time(group_queue_time_buf_,
+                                                       GROUP_QUEUE_TIME_BUF_LEN);
+          cells[i].set_varchar(ObString(len, group_queue_time_buf_));
+          cells[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+          break;
+        }
         default:
           ret = OB_ERR_UNEXPECTED;
           SERVER_LOG(WARN, "invalid column id, ", K(ret), K(col_id));
@@ -25,7 +25,9 @@ public:
   virtual ~ObAllVirtualDumpTenantInfo();
   virtual int inner_get_next_row(common::ObNewRow *&row);
 private:
+  static const int64_t GROUP_QUEUE_TIME_BUF_LEN = 4000;
   char ip_buf_[common::OB_IP_STR_BUFF];
+  char group_queue_time_buf_[GROUP_QUEUE_TIME_BUF_LEN];
   bool is_inited_;
   DISALLOW_COPY_AND_ASSIGN(ObAllVirtualDumpTenantInfo);
 };
@@ -0,0 +1,127 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_all_virtual_log_group_commit_stat.h"
+#include "lib/ob_define.h"
+#include "lib/ob_errno.h"
+#include "lib/oblog/ob_log_module.h"
+#include "logservice/ob_log_service.h"
+#include "logservice/palf/palf_env.h"
+
+namespace oceanbase
+{
+namespace observer
+{
+int ObAllVirtualLogGroupCommitStat::inner_get_next_row(common::ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  if (false == start_to_read_) {
+    auto func_iterate_tenant = [&]() -> int
+    {
+      int ret = OB_SUCCESS;
+      logservice::ObLogService *log_service = MTL(logservice::ObLogService*);
+      palf::PalfEnv *palf_env = NULL;
+      if (NULL == log_service) {
+        SERVER_LOG(INFO, "tenant has no ObLogService", K(MTL_ID()));
+      } else if (NULL == (palf_env = log_service->get_palf_env())) {
+        SERVER_LOG(INFO, "tenant has no PalfEnv", K(MTL_ID()));
+      } else if (OB_FAIL(insert_stat_(palf_env->get_palf_env_impl()->get_log_io_worker().get_group_commit_controller()))) {
+        SERVER_LOG(WARN, "insert stat failed", K(ret));
+      } else if (OB_FAIL(scanner_.add_row(cur_row_))) {
+        SERVER_LOG(WARN, "iter group commit stat failed", K(ret));
+      }
+      return ret;
+    };
+    if (OB_FAIL(omt_->operate_each_tenant_for_sys_or_self(func_iterate_tenant))) {
+      SERVER_LOG(WARN, "iter tenant failed", K(ret));
+    } else {
+      scanner_it_ = scanner_.begin();
+      start_to_read_ = true;
+    }
+  }
+  if (OB_SUCC(ret) && start_to_read_) {
+    if (OB_FAIL(scanner_it_.get_next_row(cur_row_))) {
+      if (OB_ITER_END != ret) {
+        SERVER_LOG(WARN, "get next row failed", K(ret));
+      }
+    } else {
+      row = &cur_row_;
+    }
+  }
+  return ret;
+}
+
+int ObAllVirtualLogGroupCommitStat::insert_stat_(const palf::LogGroupCommitController &controller)
+{
+  int ret = OB_SUCCESS;
+  const common::ObLog2Histogram &batch_size_hist = controller.get_batch_size_histogram();
+  const common::ObLog2Histogram &wait_time_hist = controller.get_wait_time_histogram();
+  const common::ObLog2Histogram &io_cost_hist = controller.get_io_cost_histogram();
+  const int64_t count = output_column_ids_.count();
+  for (int64_t i = 0; OB_SUCC(ret) && i < count; i++) {
+    uint64_t col_id = output_column_ids_.at(i);
+    switch (col_id) {
+      case OB_APP_MIN_COLUMN_ID:
+        cur_row_.cells_[i].set_int(MTL_ID());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 1:
+        if (false == GCTX.self_addr().ip_to_string(ip_, common::OB_IP_PORT_STR_BUFF)) {
+          ret = OB_ERR_UNEXPECTED;
+          SERVER_LOG(WARN, "ip_to_string failed", K(ret));
+        } else {
+          cur_row_.cells_[i].set_varchar(ObString::make_string(ip_));
+          cur_row_.cells_[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        }
+        break;
+      case OB_APP_MIN_COLUMN_ID + 2:
+        cur_row_.cells_[i].set_int(GCTX.self_addr().get_port());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 3:
+        cur_row_.cells_[i].set_int(controller.get_target_commit_latency_us());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 4:
+        cur_row_.cells_[i].set_int(controller.get_batch_window_us());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 5:
+        cur_row_.cells_[i].set_int(controller.get_avg_arrival_interval_us());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 6:
+        cur_row_.cells_[i].set_int(batch_size_hist.get_total_count());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 7:
+        cur_row_.cells_[i].set_int(batch_size_hist.get_avg_value());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 8:
+        cur_row_.cells_[i].set_int(batch_size_hist.get_percentile(99));
+        break;
+      case OB_APP_MIN_COLUMN_ID + 9:
+        cur_row_.cells_[i].set_int(wait_time_hist.get_avg_value());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 10:
+        cur_row_.cells_[i].set_int(wait_time_hist.get_percentile(99));
+        break;
+      case OB_APP_MIN_COLUMN_ID + 11:
+        cur_row_.cells_[i].set_int(io_cost_hist.get_avg_value());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 12:
+        cur_row_.cells_[i].set_int(io_cost_hist.get_percentile(99));
+        break;
+      default:
+        ret = OB_ERR_UNEXPECTED;
+        SERVER_LOG(WARN, "unkown column");
+        break;
+    }
+  }
+  return ret;
+}
+} // namespace observer
+} // namespace oceanbase
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_all_virtual_tx_commit_stage_stat.h"
+#include "lib/ob_define.h"
+#include "lib/ob_errno.h"
+#include "lib/oblog/ob_log_module.h"
+#include "storage/tx/ob_trans_service.h"
+
+namespace oceanbase
+{
+using namespace transaction;
+namespace observer
+{
+int ObAllVirtualTxCommitStageStat::inner_get_next_row(common::ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  if (false == start_to_read_) {
+    auto func_iterate_tenant = [&]() -> int
+    {
+      int ret = OB_SUCCESS;
+      ObTransService *txs = MTL(ObTransService*);
+      ObTxCommitStageStatIterator stat_iter;
+      ObTxCommitStageStat stat;
+      if (NULL == txs) {
+        SERVER_LOG(INFO, "tenant has no ObTransService", K(MTL_ID()));
+      } else if (OB_FAIL(txs->iterate_tx_commit_stage_stat(stat_iter))) {
+        SERVER_LOG(WARN, "iterate tx commit stage stat failed", K(ret));
+      } else {
+        while (OB_SUCC(ret) && OB_SUCC(stat_iter.get_next(stat))) {
+          if (OB_FAIL(insert_stat_(stat))) {
+            SERVER_LOG(WARN, "insert stat failed", K(ret), K(stat));
+          } else if (OB_FAIL(scanner_.add_row(cur_row_))) {
+            SERVER_LOG(WARN, "iter tx commit stage stat failed", K(ret));
+          }
+        }
+        if (OB_ITER_END == ret) {
+          ret = OB_SUCCESS;
+        }
+      }
+      return ret;
+    };
+    if (OB_FAIL(omt_->operate_each_tenant_for_sys_or_self(func_iterate_tenant))) {
+      SERVER_LOG(WARN, "iter tenant failed", K(ret));
+    } else {
+      scanner_it_ = scanner_.begin();
+      start_to_read_ = true;
+    }
+  }
+  if (OB_SUCC(ret) && start_to_read_) {
+    if (OB_FAIL(scanner_it_.get_next_row(cur_row_))) {
+      if (OB_ITER_END != ret) {
+        SERVER_LOG(WARN, "get next row failed", K(ret));
+      }
+    } else {
+      row = &cur_row_;
+    }
+  }
+  return ret;
+}
+
+int ObAllVirtualTxCommitStageStat::insert_stat_(const ObTxCommitStageStat &stat)
+{
+  int ret = OB_SUCCESS;
+  const int64_t count = output_column_ids_.count();
+  for (int64_t i = 0; OB_SUCC(ret) && i < count; i++) {
+    uint64_t col_id = output_column_ids_.at(i);
+    switch (col_id) {
+      case OB_APP_MIN_COLUMN_ID:
+        cur_row_.cells_[i].set_int(MTL_ID());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 1:
+        if (false == stat.get_addr().ip_to_string(ip_, common::OB_IP_PORT_STR_BUFF)) {
+          ret = OB_ERR_UNEXPECTED;
+          SERVER_LOG(WARN, "ip_to_string failed", K(ret));
+        } else {
+          cur_row_.cells_[i].set_varchar(ObString::make_string(ip_));
+          cur_row_.cells_[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        }
+        break;
+      case OB_APP_MIN_COLUMN_ID + 2:
+        cur_row_.cells_[i].set_int(stat.get_addr().get_port());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 3:
+        cur_row_.cells_[i].set_int(stat.get_ls_id().id());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 4:
+        cur_row_.cells_[i].set_varchar(ObString::make_string(stat.get_stage()));
+        cur_row_.cells_[i].set_collation_type(ObCharset::get_default_collation(ObCharset::get_default_charset()));
+        break;
+      case OB_APP_MIN_COLUMN_ID + 5:
+        cur_row_.cells_[i].set_int(stat.get_sample_count());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 6:
+        cur_row_.cells_[i].set_int(stat.get_avg_latency());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 7:
+        cur_row_.cells_[i].set_int(stat.get_p50_latency());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 8:
+        cur_row_.cells_[i].set_int(stat.get_p90_latency());
+        break;
+      case OB_APP_MIN_COLUMN_ID + 9:
+        cur_row_.cells_[i].set_int(stat.get_p99_latency());
+        break;
+      default:
+        ret = OB_ERR_UNEXPECTED;
+        SERVER_LOG(WARN, "unkown column");
+        break;
+    }
+  }
+  return ret;
+}
+} // namespace observer
+} // namespace oceanbase
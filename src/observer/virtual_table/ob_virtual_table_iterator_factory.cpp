@@ -175,6 +175,9 @@
 #include "observer/virtual_table/ob_all_virtual_log_stat.h"
 #include "observer/virtual_table/ob_all_virtual_apply_stat.h"
 #include "observer/virtual_table/ob_all_virtual_replay_stat.h"
+#include "observer/virtual_table/ob_all_virtual_replay_queue_stat.h"
+#include "observer/virtual_table/ob_all_virtual_log_group_commit_stat.h"
+#include "observer/virtual_table/ob_all_virtual_tx_commit_stage_stat.h"
 #include "observer/virtual_table/ob_all_virtual_unit.h"
 #include "observer/virtual_table/ob_all_virtual_server.h"
 #include "observer/virtual_table/ob_all_virtual_obj_lock.h"
@@ -1587,6 +1590,45 @@ int ObVTIterCreator::create_vt_iter(ObVTableScanParam &params,
             }
             break;
           }
+          case OB_ALL_VIRTUAL_REPLAY_QUEUE_STAT_TID: {
+            ObAllVirtualReplayQueueStat *replay_queue_stat = NULL;
+            omt::ObMultiTenant *omt = GCTX.omt_;
+            if (OB_UNLIKELY(NULL == omt)) {
+              ret = OB_ERR_UNEXPECTED;
+              SERVER_LOG(WARN, "get tenant fail", K(ret));
+            } else if (OB_FAIL(NEW_VIRTUAL_TABLE(ObAllVirtualReplayQueueStat, replay_queue_stat, omt))) {
+              SERVER_LOG(ERROR, "ObAllVirtualReplayQueueStat construct fail", K(ret));
+            } else {
+              vt_iter = static_cast<ObVirtualTableIterator *>(replay_queue_stat);
+            }
+            break;
+          }
+          case OB_ALL_VIRTUAL_LOG_GROUP_COMMIT_STAT_TID: {
+            ObAllVirtualLogGroupCommitStat *group_commit_stat = NULL;
+            omt::ObMultiTenant *omt = GCTX.omt_;
+            if (OB_UNLIKELY(NULL == omt)) {
+              ret = OB_ERR_UNEXPECTED;
+              SERVER_LOG(WARN, "get tenant fail", K(ret));
+            } else if (OB_FAIL(NEW_VIRTUAL_TABLE(ObAllVirtualLogGroupCommitStat, group_commit_stat, omt))) {
+              SERVER_LOG(ERROR, "ObAllVirtualLogGroupCommitStat construct fail", K(ret));
+            } else {
+              vt_iter = static_cast<ObVirtualTableIterator *>(group_commit_stat);
+            }
+            break;
+          }
+          case OB_ALL_VIRTUAL_TX_COMMIT_STAGE_STAT_TID: {
+            ObAllVirtualTxCommitStageStat *commit_stage_stat = NULL;
+            omt::ObMultiTenant *omt = GCTX.omt_;
+            if (OB_UNLIKELY(NULL == omt)) {
+              ret = OB_ERR_UNEXPECTED;
+              SERVER_LOG(WARN, "get tenant fail", K(ret));
+            } else if (OB_FAIL(NEW_VIRTUAL_TABLE(ObAllVirtualTxCommitStageStat, commit_stage_stat, omt))) {
+              SERVER_LOG(ERROR, "ObAllVirtualTxCommitStageStat construct fail", K(ret));
+            } else {
+              vt_iter = static_cast<ObVirtualTableIterator *>(commit_stage_stat);
+            }
+            break;
+          }
           case OB_ALL_VIRTUAL_ARCHIVE_STAT_TID: {
             ObAllVirtualLSArchiveStat *ls_archive_stat = NULL;
             omt::ObMultiTenant *omt = GCTX.omt_;
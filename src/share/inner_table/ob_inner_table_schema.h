@@ -833,6 +833,9 @@ public:
   static int all_virtual_schema_memory_schema(share::schema::ObTableSchema &table_schema);
   static int all_virtual_schema_slot_schema(share::schema::ObTableSchema &table_schema);
   static int all_virtual_minor_freeze_info_schema(share::schema::ObTableSchema &table_schema);
+  static int all_virtual_replay_queue_stat_schema(share::schema::ObTableSchema &table_schema);
+  static int all_virtual_log_group_commit_stat_schema(share::schema::ObTableSchema &table_schema);
+  static int all_virtual_tx_commit_stage_stat_schema(share::schema::ObTableSchema &table_schema);
   static int all_virtual_sql_audit_ora_schema(share::schema::ObTableSchema &table_schema);
   static int all_virtual_plan_stat_ora_schema(share::schema::ObTableSchema &table_schema);
   static int all_virtual_plan_cache_plan_explain_ora_schema(share::schema::ObTableSchema &table_schema);
@@ -2734,6 +2737,9 @@ const schema_create_func virtual_table_schema_creators [] = {
   ObInnerTableSchema::all_virtual_schema_memory_schema,
   ObInnerTableSchema::all_virtual_schema_slot_schema,
   ObInnerTableSchema::all_virtual_minor_freeze_info_schema,
+  ObInnerTableSchema::all_virtual_replay_queue_stat_schema,
+  ObInnerTableSchema::all_virtual_log_group_commit_stat_schema,
+  ObInnerTableSchema::all_virtual_tx_commit_stage_stat_schema,
   ObInnerTableSchema::all_virtual_sql_audit_ora_schema,
   ObInnerTableSchema::all_virtual_plan_stat_ora_schema,
   ObInnerTableSchema::all_virtual_plan_cache_plan_explain_ora_schema,
@@ -4007,6 +4013,9 @@ const uint64_t tenant_space_tables [] = {
   OB_ALL_VIRTUAL_PRIVILEGE_TID,
   OB_ALL_VIRTUAL_QUERY_RESPONSE_TIME_TID,
   OB_ALL_VIRTUAL_LS_REPLICA_TASK_PLAN_TID,
+  OB_ALL_VIRTUAL_REPLAY_QUEUE_STAT_TID,
+  OB_ALL_VIRTUAL_LOG_GROUP_COMMIT_STAT_TID,
+  OB_ALL_VIRTUAL_TX_COMMIT_STAGE_STAT_TID,
   OB_ALL_VIRTUAL_SQL_AUDIT_ORA_TID,
   OB_ALL_VIRTUAL_SQL_AUDIT_ORA_ALL_VIRTUAL_SQL_AUDIT_I1_TID,
   OB_ALL_VIRTUAL_PLAN_STAT_ORA_TID,
@@ -5793,6 +5802,9 @@ const char* const tenant_space_table_names [] = {
   OB_ALL_VIRTUAL_PRIVILEGE_TNAME,
   OB_ALL_VIRTUAL_QUERY_RESPONSE_TIME_TNAME,
   OB_ALL_VIRTUAL_LS_REPLICA_TASK_PLAN_TNAME,
+  OB_ALL_VIRTUAL_REPLAY_QUEUE_STAT_TNAME,
+  OB_ALL_VIRTUAL_LOG_GROUP_COMMIT_STAT_TNAME,
+  OB_ALL_VIRTUAL_TX_COMMIT_STAGE_STAT_TNAME,
   OB_ALL_VIRTUAL_SQL_AUDIT_ORA_TNAME,
   OB_ALL_VIRTUAL_SQL_AUDIT_ORA_ALL_VIRTUAL_SQL_AUDIT_I1_TNAME,
   OB_ALL_VIRTUAL_PLAN_STAT_ORA_TNAME,
@@ -7118,6 +7130,9 @@ const uint64_t tenant_distributed_vtables [] = {
   OB_ALL_VIRTUAL_ASH_TID,
   OB_ALL_VIRTUAL_DML_STATS_TID,
   OB_ALL_VIRTUAL_QUERY_RESPONSE_TIME_TID,
+  OB_ALL_VIRTUAL_REPLAY_QUEUE_STAT_TID,
+  OB_ALL_VIRTUAL_LOG_GROUP_COMMIT_STAT_TID,
+  OB_ALL_VIRTUAL_TX_COMMIT_STAGE_STAT_TID,
   OB_ALL_VIRTUAL_SQL_AUDIT_ORA_TID,
   OB_ALL_VIRTUAL_SQL_AUDIT_ORA_ALL_VIRTUAL_SQL_AUDIT_I1_TID,
   OB_ALL_VIRTUAL_PLAN_STAT_ORA_TID,
@@ -9152,11 +9167,11 @@ static inline int get_sys_table_lob_aux_schema(const uint64_t tid,
 
 const int64_t OB_CORE_TABLE_COUNT = 4;
 const int64_t OB_SYS_TABLE_COUNT = 212;
-const int64_t OB_VIRTUAL_TABLE_COUNT = 550;
+const int64_t OB_VIRTUAL_TABLE_COUNT = 553;
 const int64_t OB_SYS_VIEW_COUNT = 601;
-const int64_t OB_SYS_TENANT_TABLE_COUNT = 1368;
+const int64_t OB_SYS_TENANT_TABLE_COUNT = 1371;
 const int64_t OB_CORE_SCHEMA_VERSION = 1;
-const int64_t OB_BOOTSTRAP_SCHEMA_VERSION = 1371;
+const int64_t OB_BOOTSTRAP_SCHEMA_VERSION = 1374;
 
 } // end namespace share
 } // end namespace oceanbase
@@ -581,6 +581,9 @@ const uint64_t OB_ALL_VIRTUAL_LS_REPLICA_TASK_PLAN_TID = 12335; // "__all_virtua
 const uint64_t OB_ALL_VIRTUAL_SCHEMA_MEMORY_TID = 12336; // "__all_virtual_schema_memory"
 const uint64_t OB_ALL_VIRTUAL_SCHEMA_SLOT_TID = 12337; // "__all_virtual_schema_slot"
 const uint64_t OB_ALL_VIRTUAL_MINOR_FREEZE_INFO_TID = 12338; // "__all_virtual_minor_freeze_info"
+const uint64_t OB_ALL_VIRTUAL_REPLAY_QUEUE_STAT_TID = 12340; // "__all_virtual_replay_queue_stat"
+const uint64_t OB_ALL_VIRTUAL_LOG_GROUP_COMMIT_STAT_TID = 12341; // "__all_virtual_log_group_commit_stat"
+const uint64_t OB_ALL_VIRTUAL_TX_COMMIT_STAGE_STAT_TID = 12342; // "__all_virtual_tx_commit_stage_stat"
 const uint64_t OB_ALL_VIRTUAL_SQL_AUDIT_ORA_TID = 15009; // "ALL_VIRTUAL_SQL_AUDIT_ORA"
 const uint64_t OB_ALL_VIRTUAL_PLAN_STAT_ORA_TID = 15010; // "ALL_VIRTUAL_PLAN_STAT_ORA"
 const uint64_t OB_ALL_VIRTUAL_PLAN_CACHE_PLAN_EXPLAIN_ORA_TID = 15012; // "ALL_VIRTUAL_PLAN_CACHE_PLAN_EXPLAIN_ORA"
@@ -2466,6 +2469,9 @@ const char *const OB_ALL_VIRTUAL_LS_REPLICA_TASK_PLAN_TNAME = "__all_virtual_ls_
 const char *const OB_ALL_VIRTUAL_SCHEMA_MEMORY_TNAME = "__all_virtual_schema_memory";
 const char *const OB_ALL_VIRTUAL_SCHEMA_SLOT_TNAME = "__all_virtual_schema_slot";
 const char *const OB_ALL_VIRTUAL_MINOR_FREEZE_INFO_TNAME = "__all_virtual_minor_freeze_info";
+const char *const OB_ALL_VIRTUAL_REPLAY_QUEUE_STAT_TNAME = "__all_virtual_replay_queue_stat";
+const char *const OB_ALL_VIRTUAL_LOG_GROUP_COMMIT_STAT_TNAME = "__all_virtual_log_group_commit_stat";
+const char *const OB_ALL_VIRTUAL_TX_COMMIT_STAGE_STAT_TNAME = "__all_virtual_tx_commit_stage_stat";
 const char *const OB_ALL_VIRTUAL_SQL_AUDIT_ORA_TNAME = "ALL_VIRTUAL_SQL_AUDIT";
 const char *const OB_ALL_VIRTUAL_PLAN_STAT_ORA_TNAME = "ALL_VIRTUAL_PLAN_STAT";
 const char *const OB_ALL_VIRTUAL_PLAN_CACHE_PLAN_EXPLAIN_ORA_TNAME = "ALL_VIRTUAL_PLAN_CACHE_PLAN_EXPLAIN";
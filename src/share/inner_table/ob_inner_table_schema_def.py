@@ -7183,6 +7183,8 @@ def_table_schema(
     ('queue_4', 'bigint:20'),
     ('queue_5', 'bigint:20'),
     ('large_queued', 'bigint:20'),
+    ('steal_req_cnt', 'bigint:20'),
+    ('group_queue_time', 'varchar:4000'),
   ],
   partition_columns = ['svr_ip', 'svr_port'],
   vtable_route_policy = 'distributed',
@@ -10767,6 +10769,90 @@ def_table_schema(
 
 # 12339: __all_virtual_show_trace
 
+def_table_schema(
+  owner = 'keqing.llt',
+  table_name = '__all_virtual_replay_queue_stat',
+  table_id = '12340',
+  table_type = 'VIRTUAL_TABLE',
+  gm_columns = [],
+  in_tenant_space = True,
+  rowkey_columns = [
+  ],
+
+  normal_columns = [
+    ('tenant_id', 'int'),
+    ('ls_id', 'int'),
+    ('svr_ip', 'varchar:MAX_IP_ADDR_LENGTH'),
+    ('svr_port', 'int'),
+    ('queue_idx', 'int'),
+    ('pending_cnt', 'int'),
+    ('replayed_cnt', 'int'),
+    ('min_unreplayed_lsn', 'uint'),
+    ('min_unreplayed_log_scn', 'uint'),
+    ('replay_lag', 'int'),
+  ],
+
+  partition_columns = ['svr_ip', 'svr_port'],
+  vtable_route_policy = 'distributed',
+)
+
+def_table_schema(
+  owner = 'keqing.llt',
+  table_name = '__all_virtual_log_group_commit_stat',
+  table_id = '12341',
+  table_type = 'VIRTUAL_TABLE',
+  gm_columns = [],
+  in_tenant_space = True,
+  rowkey_columns = [
+  ],
+
+  normal_columns = [
+    ('tenant_id', 'int'),
+    ('svr_ip', 'varchar:MAX_IP_ADDR_LENGTH'),
+    ('svr_port', 'int'),
+    ('target_commit_latency', 'int'),
+    ('batch_window', 'int'),
+    ('avg_arrival_interval', 'int'),
+    ('batch_count', 'int'),
+    ('avg_batch_size', 'int'),
+    ('p99_batch_size', 'int'),
+    ('avg_wait_time', 'int'),
+    ('p99_wait_time', 'int'),
+    ('avg_io_cost', 'int'),
+    ('p99_io_cost', 'int'),
+  ],
+
+  partition_columns = ['svr_ip', 'svr_port'],
+  vtable_route_policy = 'distributed',
+)
+
+def_table_schema(
+  owner = 'chensen.cs',
+  table_name = '__all_virtual_tx_commit_stage_stat',
+  table_id = '12342',
+  table_type = 'VIRTUAL_TABLE',
+  gm_columns = [],
+  in_tenant_space = True,
+  rowkey_columns = [
+  ],
+
+  normal_columns = [
+    ('tenant_id', 'int'),
+    ('svr_ip', 'varchar:MAX_IP_ADDR_LENGTH'),
+    ('svr_port', 'int'),
+    ('ls_id', 'int'),
+    ('stage', 'varchar:32'),
+    ('sample_count', 'int'),
+    ('avg_latency', 'int'),
+    ('p50_latency', 'int'),
+    ('p90_latency', 'int'),
+    ('p99_latency', 'int'),
+  ],
+
+  partition_columns = ['svr_ip', 'svr_port'],
+  vtable_route_policy = 'distributed',
+)
+
 #
 # 余留位置
 #
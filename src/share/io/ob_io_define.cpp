@@ -17,6 +17,7 @@
 #include "share/io/ob_io_struct.h"
 #include "share/io/ob_io_manager.h"
 #include "lib/time/ob_time_utility.h"
+#include "lib/worker.h"
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -364,6 +365,12 @@ ObIORequest::ObIORequest()
     retry_count_(0),
     tenant_io_mgr_(),
     copied_callback_(nullptr),
+    is_merged_(false),
+    merge_next_(nullptr),
+    merge_raw_buf_(nullptr),
+    merge_buf_(nullptr),
+    merge_offset_(0),
+    merge_size_(0),
     callback_buf_size_(0),    
     callback_buf_()
 {
@@ -427,6 +434,9 @@ void ObIORequest::destroy()
     control_block_ = nullptr;
   }
   io_info_.reset();
+  free_merge_buf();
+  is_merged_ = false;
+  merge_next_ = nullptr;
   if (nullptr != raw_buf_ && nullptr != tenant_io_mgr_.get_ptr()) {
     tenant_io_mgr_.get_ptr()->io_allocator_.free(raw_buf_);
     raw_buf_ = nullptr;
@@ -600,6 +610,61 @@ int ObIORequest::prepare()
   return ret;
 }
 
+int ObIORequest::prepare_merged_read(const int64_t merge_offset, const int64_t merge_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!io_info_.flag_.is_read() || nullptr == control_block_ || nullptr != merge_raw_buf_
+      || merge_offset > io_offset_ || merge_offset + merge_size < io_offset_ + io_size_
+      || !is_io_aligned(merge_offset) || !is_io_aligned(merge_size))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid merged read", K(ret), K(merge_offset), K(merge_size), K(*this));
+  } else if (OB_ISNULL(tenant_io_mgr_.get_ptr())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("tenant io manager is null", K(ret));
+  } else if (OB_ISNULL(merge_raw_buf_ = tenant_io_mgr_.get_ptr()->io_allocator_.alloc(merge_size + DIO_READ_ALIGN_SIZE))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(merge_size));
+  } else {
+    merge_buf_ = reinterpret_cast<char *>(upper_align(reinterpret_cast<int64_t>(merge_raw_buf_), DIO_READ_ALIGN_SIZE));
+    merge_offset_ = merge_offset;
+    merge_size_ = merge_size;
+    if (OB_FAIL(io_info_.fd_.device_handle_->io_prepare_pread(
+            io_info_.fd_,
+            merge_buf_,
+            merge_size_,
+            merge_offset_,
+            control_block_,
+            this/*data*/))) {
+      LOG_WARN("prepare merged io read failed", K(ret), K(*this));
+    }
+  }
+  if (OB_FAIL(ret)) {
+    free_merge_buf();
+  }
+  return ret;
+}
+
+void ObIORequest::copy_merged_data(ObIORequest &member, const int64_t complete_size, int64_t &member_size) const
+{
+  // the part of the merged read covered by the member, the member may overlap with others
+  const int64_t skip_size = member.io_offset_ - merge_offset_;
+  member_size = max(0, min(member.io_size_, complete_size - skip_size));
+  if (member_size > 0 && nullptr != merge_buf_) {
+    MEMCPY(member.io_buf_, merge_buf_ + skip_size, member_size);
+  }
+}
+
+void ObIORequest::free_merge_buf()
+{
+  if (nullptr != merge_raw_buf_ && nullptr != tenant_io_mgr_.get_ptr()) {
+    tenant_io_mgr_.get_ptr()->io_allocator_.free(merge_raw_buf_);
+  }
+  merge_raw_buf_ = nullptr;
+  merge_buf_ = nullptr;
+  merge_offset_ = 0;
+  merge_size_ = 0;
+}
+
 bool ObIORequest::can_callback() const
 {
   return nullptr != copied_callback_ && nullptr != io_buf_;
@@ -852,29 +917,35 @@ int ObIOHandle::wait(const int64_t timeout_ms)
     int real_wait_timeout = min(OB_IO_MANAGER.get_io_config().data_storage_io_timeout_ms_, timeout_ms);
 
     if (real_wait_timeout > 0) {
-      ObThreadCondGuard guard(req_->cond_);
-      if (OB_FAIL(guard.get_ret())) {
-        LOG_ERROR("fail to guard request condition", K(ret));
-      } else {
-        int64_t wait_ms = real_wait_timeout;
-        int64_t begin_ms = ObTimeUtility::fast_current_time();
-        while (OB_SUCC(ret) && !req_->is_finished_ && wait_ms > 0) {
-          if (OB_FAIL(req_->cond_.wait(wait_ms))) {
-            LOG_WARN("fail to wait request condition", K(ret), K(wait_ms), K(*req_));
-          } else if (!req_->is_finished_) {
-            int64_t duration_ms = ObTimeUtility::fast_current_time() - begin_ms;
-            wait_ms = real_wait_timeout - duration_ms;
+      // notify omt that I'd begin to wait
+      THIS_WORKER.sched_wait();
+      {
+        ObThreadCondGuard guard(req_->cond_);
+        if (OB_FAIL(guard.get_ret())) {
+          LOG_ERROR("fail to guard request condition", K(ret));
+        } else {
+          int64_t wait_ms = real_wait_timeout;
+          int64_t begin_ms = ObTimeUtility::fast_current_time();
+          while (OB_SUCC(ret) && !req_->is_finished_ && wait_ms > 0) {
+            if (OB_FAIL(req_->cond_.wait(wait_ms))) {
+              LOG_WARN("fail to wait request condition", K(ret), K(wait_ms), K(*req_));
+            } else if (!req_->is_finished_) {
+              int64_t duration_ms = ObTimeUtility::fast_current_time() - begin_ms;
+              wait_ms = real_wait_timeout - duration_ms;
+            }
+          }
+          if (OB_UNLIKELY(wait_ms <= 0)) { // rarely happen
+            ret = OB_TIMEOUT;
+            LOG_WARN("fail to wait request condition due to spurious wakeup", 
+                K(ret), K(wait_ms), K(*req_));
+          }
+          if (OB_TIMEOUT == ret) {
+            OB_IO_MANAGER.get_device_health_detector().record_failure(*req_);
           }
-        }
-        if (OB_UNLIKELY(wait_ms <= 0)) { // rarely happen
-          ret = OB_TIMEOUT;
-          LOG_WARN("fail to wait request condition due to spurious wakeup", 
-              K(ret), K(wait_ms), K(*req_));
-        }
-        if (OB_TIMEOUT == ret) {
-          OB_IO_MANAGER.get_device_health_detector().record_failure(*req_);
         }
       }
+      // notify omt that my waiting is done
+      THIS_WORKER.sched_run();
     } else {
       ret = OB_TIMEOUT;
     }
@@ -222,6 +222,9 @@ public:
   void cancel();
   int alloc_io_buf();
   int prepare();
+  int prepare_merged_read(const int64_t merge_offset, const int64_t merge_size);
+  void copy_merged_data(ObIORequest &member, const int64_t complete_size, int64_t &member_size) const;
+  void free_merge_buf();
   bool can_callback() const;
   void finish(const ObIORetCode &ret_code);
   void inc_ref(const char *msg = nullptr);
@@ -231,7 +234,8 @@ public:
   VIRTUAL_TO_STRING_KV(K(is_inited_), K(is_finished_), K(is_canceled_), K(has_estimated_), K(io_info_), K(deadline_ts_),
       KP(control_block_), KP(raw_buf_), KP(io_buf_), K(io_offset_), K(io_size_), K(complete_size_),
       K(time_log_), KP(channel_), K(ref_cnt_), K(out_ref_cnt_),
-      K(trace_id_), K(ret_code_), K(retry_count_), K(callback_buf_size_), KP(copied_callback_), K(tenant_io_mgr_));
+      K(trace_id_), K(ret_code_), K(retry_count_), K(callback_buf_size_), KP(copied_callback_), K(tenant_io_mgr_),
+      K(is_merged_), KP(merge_next_), KP(merge_buf_), K(merge_offset_), K(merge_size_));
 private:
   int alloc_aligned_io_buf();
 public:
@@ -258,6 +262,14 @@ public:
   int32_t retry_count_;
   ObRefHolder<ObTenantIOManager> tenant_io_mgr_;
   ObIOCallback *copied_callback_;
+  // adjacent reads merged by the sender are submitted with the iocb of the first request,
+  // which reads into merge_buf_ and copies the data back to the others when returned.
+  bool is_merged_;
+  ObIORequest *merge_next_;
+  void *merge_raw_buf_;
+  char *merge_buf_;
+  int64_t merge_offset_;
+  int64_t merge_size_;
   int64_t callback_buf_size_;
   char callback_buf_[];
   };
@@ -54,6 +54,7 @@ void ObIOConfig::set_default_value()
   data_storage_error_tolerance_time_ = 300L * 1000L * 1000L; // 300s
   disk_io_thread_count_ = 8;
   data_storage_io_timeout_ms_ = 120L * 1000L; // 120s
+  enable_io_merge_ = false;
 }
 
 bool ObIOConfig::is_valid() const
@@ -74,6 +75,7 @@ void ObIOConfig::reset()
   data_storage_error_tolerance_time_ = 0;
   disk_io_thread_count_ = 0;
   data_storage_io_timeout_ms_ = 0;
+  enable_io_merge_ = false;
 }
 
 /******************             IOMemoryPool              **********************/
@@ -648,7 +650,8 @@ ObIOSender::ObIOSender(ObIAllocator &allocator)
     tg_id_(-1),
     io_queue_(nullptr),
     queue_cond_(),
-    sender_req_count_(0)
+    sender_req_count_(0),
+    merged_submit_count_(0)
 {
 
 }
@@ -743,6 +746,7 @@ void ObIOSender::destroy()
   is_inited_ = false;
   stop_submit_ = false;
   sender_req_count_ = 0;
+  merged_submit_count_ = 0;
   LOG_INFO("io sender destroyed", KCSTRING(lbt()));
 }
 
@@ -888,7 +892,7 @@ int ObIOSender::enqueue_phy_queue(ObPhyQueue *phyqueue)
   return ret;
 }
 
-int ObIOSender::dequeue_request(ObIORequest *&req)
+int ObIOSender::dequeue_request(ObIORequest *&req, const bool need_wait)
 {
   int ret = OB_SUCCESS;
   if (!is_inited_) {
@@ -903,7 +907,7 @@ int ObIOSender::dequeue_request(ObIORequest *&req)
       ret = io_queue_->pop_phyqueue(req, queue_deadline_ts);
       if (OB_SUCC(ret)) {
         ATOMIC_DEC(&sender_req_count_);
-      } else if (OB_EAGAIN == ret || OB_ENTRY_NOT_EXIST == ret) {
+      } else if (need_wait && (OB_EAGAIN == ret || OB_ENTRY_NOT_EXIST == ret)) {
         const int64_t timeout_us = calc_wait_timeout(queue_deadline_ts);
         int tmp_ret = OB_SUCCESS;
         if (timeout_us > 0 && OB_SUCCESS != (tmp_ret = queue_cond_.wait_us(timeout_us))) {
@@ -990,36 +994,188 @@ void ObIOSender::pop_and_submit()
   } else if (OB_ISNULL(req)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("request is null", K(ret));
+  } else if (!can_merge(*req)) {
+    submit_request(*req);
   } else {
-    RequestHolder req_holder(req);
-    req->sender_ = this;
-    bool is_retry = false;
-    ObTraceIDGuard trace_guard(req->trace_id_);
-    if (req->is_canceled_) {
-      ret = OB_CANCELED;
+    // take the other requests which are ready now without waiting, so that no latency is added,
+    // and merge the adjacent reads among them
+    ObSEArray<ObIORequest *, MAX_MERGE_BATCH_COUNT> merge_reqs;
+    if (OB_FAIL(merge_reqs.push_back(req))) {
+      LOG_WARN("push back request failed", K(ret));
+      submit_request(*req);
+    }
+    while (OB_SUCC(ret) && merge_reqs.count() < MAX_MERGE_BATCH_COUNT) {
+      ObIORequest *next_req = nullptr;
+      if (OB_FAIL(dequeue_request(next_req, false/*need_wait*/))) {
+        if (OB_EAGAIN != ret && OB_ENTRY_NOT_EXIST != ret) {
+          LOG_WARN("pop request from send queue failed", K(ret));
+        }
+      } else if (OB_ISNULL(next_req)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("request is null", K(ret));
+      } else if (!can_merge(*next_req)) {
+        submit_request(*next_req);
+      } else if (OB_FAIL(merge_reqs.push_back(next_req))) {
+        LOG_WARN("push back request failed", K(ret));
+        submit_request(*next_req);
+      }
+    }
+    if (merge_reqs.count() > 0) {
+      merge_and_submit(&merge_reqs.at(0), merge_reqs.count());
+    }
+  }
+}
+
+void ObIOSender::submit_request(ObIORequest &req)
+{
+  int ret = OB_SUCCESS;
+  RequestHolder req_holder(&req);
+  req.sender_ = this;
+  bool is_retry = false;
+  ObTraceIDGuard trace_guard(req.trace_id_);
+  if (req.is_canceled_) {
+    ret = OB_CANCELED;
+  } else {
+    if (OB_FAIL(submit(req))) {
+      if (OB_EAGAIN == ret) {
+        req.dec_ref("phyqueue_dec"); // ref for io queue
+        if (OB_FAIL(enqueue_request(req))) {
+          LOG_WARN("retry push request to queue failed", K(ret), K(req));
+        } else {
+          is_retry = true;
+        }
+      } else if (OB_CANCELED != ret) {
+        LOG_WARN("submit io request failed", K(ret));
+      }
+    }
+  }
+  // the request has only three result here: submitted, failed, retrying
+  if (OB_FAIL(ret)) {
+    req.finish(ret);
+  }
+  if (OB_LIKELY(!is_retry)) {
+    req.dec_ref("phyqueue_dec"); // ref for io queue
+  }
+}
+
+bool ObIOSender::can_merge(ObIORequest &req) const
+{
+  return OB_IO_MANAGER.get_io_config().enable_io_merge_
+      && req.get_flag().is_read()
+      && !req.get_flag().is_sync()
+      && !req.is_canceled_
+      && nullptr != req.tenant_io_mgr_.get_ptr();
+}
+
+void ObIOSender::merge_and_submit(ObIORequest **reqs, const int64_t count)
+{
+  int ret = OB_SUCCESS;
+  // the aligned range to read is decided by prepare, the callback may allocate the buffer itself
+  int64_t prepared_count = 0;
+  for (int64_t i = 0; i < count; ++i) {
+    if (OB_FAIL(reqs[i]->prepare())) {
+      LOG_WARN("prepare io request failed", K(ret), KPC(reqs[i]));
+      submit_request(*reqs[i]);
     } else {
-      if (OB_FAIL(submit(*req))) {
-        if (OB_EAGAIN == ret) {
-          req->dec_ref("phyqueue_dec"); // ref for io queue
-          ObIORequest &re_req = *req;
-          if (OB_FAIL(enqueue_request(re_req))) {
-            LOG_WARN("retry push request to queue failed", K(ret), K(re_req));
-          } else {
-            is_retry = true;
-          }
-        } else if (OB_CANCELED != ret) {
-          LOG_WARN("submit io request failed", K(ret));
+      reqs[prepared_count++] = reqs[i];
+    }
+  }
+  std::sort(reqs, reqs + prepared_count, [](const ObIORequest *left, const ObIORequest *right) {
+    const ObIOFd &left_fd = left->io_info_.fd_;
+    const ObIOFd &right_fd = right->io_info_.fd_;
+    bool bret = false;
+    if (left_fd.device_handle_ != right_fd.device_handle_) {
+      bret = left_fd.device_handle_ < right_fd.device_handle_;
+    } else if (left_fd.first_id_ != right_fd.first_id_) {
+      bret = left_fd.first_id_ < right_fd.first_id_;
+    } else if (left_fd.second_id_ != right_fd.second_id_) {
+      bret = left_fd.second_id_ < right_fd.second_id_;
+    } else {
+      bret = left->io_offset_ < right->io_offset_;
+    }
+    return bret;
+  });
+  int64_t begin = 0;
+  while (begin < prepared_count) {
+    const ObIORequest &first = *reqs[begin];
+    int64_t merge_end = first.io_offset_ + first.io_size_;
+    int64_t end = begin + 1;
+    for (; end < prepared_count; ++end) {
+      const ObIORequest &req = *reqs[end];
+      const int64_t req_end = req.io_offset_ + req.io_size_;
+      if (req.io_info_.fd_ != first.io_info_.fd_
+          || req.io_info_.tenant_id_ != first.io_info_.tenant_id_
+          || req.io_offset_ > merge_end
+          || max(merge_end, req_end) - first.io_offset_ > MAX_MERGE_IO_SIZE) {
+        break;
+      } else {
+        merge_end = max(merge_end, req_end);
+      }
+    }
+    if (end - begin > 1 && OB_SUCC(submit_merged(reqs + begin, end - begin))) {
+      // all submitted by one io
+    } else {
+      // submit one by one, the failed or full requests are retried there
+      for (int64_t i = begin; i < end; ++i) {
+        submit_request(*reqs[i]);
+      }
+    }
+    begin = end;
+  }
+}
+
+int ObIOSender::submit_merged(ObIORequest **reqs, const int64_t count)
+{
+  int ret = OB_SUCCESS;
+  ObIORequest &head = *reqs[0];
+  ObDeviceChannel *device_channel = nullptr;
+  int64_t merge_end = 0;
+  for (int64_t i = 0; i < count; ++i) {
+    merge_end = max(merge_end, reqs[i]->io_offset_ + reqs[i]->io_size_);
+  }
+  ObTraceIDGuard trace_guard(head.trace_id_);
+  if (OB_UNLIKELY(stop_submit_)) {
+    ret = OB_STATE_NOT_MATCH;
+    LOG_WARN("sender stop submit", K(ret), K(stop_submit_));
+  } else if (OB_FAIL(OB_IO_MANAGER.get_device_channel(head.io_info_.fd_.device_handle_, device_channel))) {
+    LOG_WARN("get device channel failed", K(ret), K(head));
+  } else if (OB_FAIL(head.prepare_merged_read(head.io_offset_, merge_end - head.io_offset_))) {
+    LOG_WARN("prepare merged read failed", K(ret), K(head), K(merge_end));
+  } else {
+    for (int64_t i = 0; i < count; ++i) {
+      reqs[i]->sender_ = this;
+      reqs[i]->is_merged_ = true;
+      reqs[i]->merge_next_ = i + 1 < count ? reqs[i + 1] : nullptr;
+    }
+    {
+      // lock request condition to prevent canceling halfway
+      ObThreadCondGuard guard(head.cond_);
+      if (OB_FAIL(guard.get_ret())) {
+        LOG_ERROR("fail to guard master condition", K(ret));
+      } else if (head.is_canceled_) {
+        ret = OB_CANCELED;
+      } else if (OB_FAIL(device_channel->submit(head))) {
+        if (OB_EAGAIN != ret) {
+          LOG_WARN("submit merged io request failed", K(ret), K(head), K(count), KPC(device_channel));
         }
+      } else {
+        ATOMIC_INC(&merged_submit_count_);
       }
     }
-    // the request has only three result here: submitted, failed, retrying
     if (OB_FAIL(ret)) {
-      req->finish(ret);
+      for (int64_t i = 0; i < count; ++i) {
+        reqs[i]->is_merged_ = false;
+        reqs[i]->merge_next_ = nullptr;
+      }
+      head.free_merge_buf();
     }
-    if (OB_LIKELY(!is_retry)) {
-      req->dec_ref("phyqueue_dec"); // ref for io queue
+  }
+  if (OB_SUCC(ret)) {
+    for (int64_t i = 0; i < count; ++i) {
+      reqs[i]->dec_ref("phyqueue_dec"); // ref for io queue
     }
   }
+  return ret;
 }
 
 int64_t ObIOSender::calc_wait_timeout(const int64_t queue_deadline)
@@ -1424,9 +1580,18 @@ int ObAsyncIOChannel::submit(ObIORequest &req)
     req.channel_ = this;
     req.time_log_.submit_ts_ = ObTimeUtility::fast_current_time();
     req.inc_ref("os_inc"); // ref for file system
+    for (ObIORequest *member = req.merge_next_; nullptr != member; member = member->merge_next_) {
+      // merged requests return along with the first one
+      member->channel_ = this;
+      member->time_log_.submit_ts_ = req.time_log_.submit_ts_;
+      member->inc_ref("os_inc"); // ref for file system
+    }
     if (OB_FAIL(device_handle_->io_submit(io_context_, req.control_block_))) {
       ATOMIC_DEC(&submit_count_);
       req.dec_ref("os_dec"); // ref for file system
+      for (ObIORequest *member = req.merge_next_; nullptr != member; member = member->merge_next_) {
+        member->dec_ref("os_dec"); // ref for file system
+      }
       LOG_WARN("io_submit failed", K(ret), K(submit_count_), K(req));
     } else {
       LOG_DEBUG("Success to submit io request, ", K(ret), K(submit_count_), KP(&req), KP(io_context_));
@@ -1441,6 +1606,8 @@ void ObAsyncIOChannel::cancel(ObIORequest &req)
   if (OB_UNLIKELY(!is_inited_)) {
     ret = OB_NOT_INIT;
     LOG_WARN("not init", K(ret), K(is_inited_));
+  } else if (req.is_merged_) {
+    // the io is shared with other merged requests, just wait it to return
   } else if (0 != req.time_log_.submit_ts_ && 0 == req.time_log_.return_ts_) {
     // Note: here if ob_io_cancel failed (possibly due to kernel not supporting io_cancel),
     // neither we or the get_events thread would call control.callback_->process(),
@@ -1487,41 +1654,10 @@ void ObAsyncIOChannel::get_events()
         ATOMIC_FAS(&device_channel_->used_io_depth_, req->io_size_);
         const int system_errno = io_events_->get_ith_ret_code(i);
         const int complete_size = io_events_->get_ith_ret_bytes(i);
-        if (OB_LIKELY(0 == system_errno)) { // io succ
-          if (complete_size == req->io_size_) { // full complete
-            LOG_DEBUG("Success to get io event", K(*req), K(complete_size));
-            if (OB_FAIL(on_full_return(*req))) {
-              LOG_WARN("process full return io request failed", K(ret), K(*req));
-            }
-          } else if (complete_size >= 0 && complete_size < req->io_size_) { // partial complete
-            LOG_WARN("io request partial finished", K(*req), K(complete_size));
-            if (0 == complete_size || !is_io_aligned(complete_size)) { // reach end of file
-              if (OB_FAIL(on_partial_return(*req, complete_size))) {
-                LOG_WARN("process partial return io request failed", K(ret), K(complete_size), K(*req));
-              }
-            } else {
-              if (OB_FAIL(on_partial_retry(*req, complete_size))) { // partial retry
-                LOG_WARN("partial retry io request failed", K(ret), K(complete_size), K(*req));
-              }
-            }
-          } else { // invalid complete size
-            LOG_WARN("invalid complete size", K(*req), K(complete_size));
-            if (OB_FAIL(on_failed(*req, ObIORetCode(OB_IO_ERROR, complete_size)))) { // use complete_size as errno here
-              LOG_WARN("process failed io request failed", K(ret), K(*req));
-            }
-          }
-        } else { // io failed
-          LOG_ERROR("io request failed", K(*req), K(system_errno), K(complete_size));
-          const bool need_retry = false; // wait io device to support retry policy
-          if (need_retry) {
-            if (OB_FAIL(on_full_retry(*req))) {
-              LOG_WARN("retry io request failed", K(ret), K(system_errno), K(*req));
-            }
-          } else {
-            if (OB_FAIL(on_failed(*req, ObIORetCode(OB_IO_ERROR, system_errno)))) {
-              LOG_WARN("process failed io request failed", K(ret), K(*req));
-            }
-          }
+        if (req->is_merged_) {
+          on_merged_return(*req, system_errno, complete_size);
+        } else {
+          on_return(*req, system_errno, complete_size);
         }
       }
       ATOMIC_DEC(&submit_count_);
@@ -1529,6 +1665,87 @@ void ObAsyncIOChannel::get_events()
   }
 }
 
+void ObAsyncIOChannel::on_return(ObIORequest &req, const int system_errno, const int64_t complete_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_LIKELY(0 == system_errno)) { // io succ
+    if (complete_size == req.io_size_) { // full complete
+      LOG_DEBUG("Success to get io event", K(req), K(complete_size));
+      if (OB_FAIL(on_full_return(req))) {
+        LOG_WARN("process full return io request failed", K(ret), K(req));
+      }
+    } else if (complete_size >= 0 && complete_size < req.io_size_) { // partial complete
+      LOG_WARN("io request partial finished", K(req), K(complete_size));
+      if (0 == complete_size || !is_io_aligned(complete_size)) { // reach end of file
+        if (OB_FAIL(on_partial_return(req, complete_size))) {
+          LOG_WARN("process partial return io request failed", K(ret), K(complete_size), K(req));
+        }
+      } else {
+        if (OB_FAIL(on_partial_retry(req, complete_size))) { // partial retry
+          LOG_WARN("partial retry io request failed", K(ret), K(complete_size), K(req));
+        }
+      }
+    } else { // invalid complete size
+      LOG_WARN("invalid complete size", K(req), K(complete_size));
+      if (OB_FAIL(on_failed(req, ObIORetCode(OB_IO_ERROR, complete_size)))) { // use complete_size as errno here
+        LOG_WARN("process failed io request failed", K(ret), K(req));
+      }
+    }
+  } else { // io failed
+    LOG_ERROR("io request failed", K(req), K(system_errno), K(complete_size));
+    const bool need_retry = false; // wait io device to support retry policy
+    if (need_retry) {
+      if (OB_FAIL(on_full_retry(req))) {
+        LOG_WARN("retry io request failed", K(ret), K(system_errno), K(req));
+      }
+    } else {
+      if (OB_FAIL(on_failed(req, ObIORetCode(OB_IO_ERROR, system_errno)))) {
+        LOG_WARN("process failed io request failed", K(ret), K(req));
+      }
+    }
+  }
+}
+
+void ObAsyncIOChannel::on_merged_return(ObIORequest &req, const int system_errno, const int64_t complete_size)
+{
+  int ret = OB_SUCCESS;
+  // split the merged io back, each request returns as if it is read alone
+  const bool is_succ = 0 == system_errno && complete_size >= 0;
+  // an aligned short return does not mean the end of file, the requests after it are not read
+  // at all and are submitted again alone
+  const bool is_short = is_succ && complete_size > 0 && complete_size < req.merge_size_
+      && is_io_aligned(complete_size);
+  ObIORequest *member = req.merge_next_;
+  req.merge_next_ = nullptr;
+  while (nullptr != member) {
+    ObIORequest *next = member->merge_next_;
+    RequestHolder holder(member);
+    member->dec_ref("os_dec"); // ref for file system
+    member->time_log_.return_ts_ = req.time_log_.return_ts_;
+    member->merge_next_ = nullptr;
+    member->is_merged_ = false;
+    int64_t member_size = 0;
+    if (is_succ) {
+      req.copy_merged_data(*member, complete_size, member_size);
+    }
+    if (is_short && 0 == member_size) {
+      if (OB_FAIL(on_partial_retry(*member, 0))) {
+        LOG_WARN("resubmit merged io request failed", K(ret), K(complete_size), KPC(member));
+      }
+    } else {
+      on_return(*member, system_errno, is_succ ? member_size : complete_size);
+    }
+    member = next;
+  }
+  int64_t head_size = 0;
+  if (is_succ) {
+    req.copy_merged_data(req, complete_size, head_size);
+  }
+  req.free_merge_buf();
+  req.is_merged_ = false;
+  on_return(req, system_errno, is_succ ? head_size : complete_size);
+}
+
 int ObAsyncIOChannel::on_full_return(ObIORequest &req)
 {
   int ret = OB_SUCCESS;
@@ -45,7 +45,8 @@ public:
       K(data_storage_warning_tolerance_time_),
       K(data_storage_error_tolerance_time_),
       K(disk_io_thread_count_),
-      K(data_storage_io_timeout_ms_));
+      K(data_storage_io_timeout_ms_),
+      K(enable_io_merge_));
 
 public:
   static const int64_t MAX_IO_THREAD_COUNT = 32 * 2;
@@ -57,6 +58,8 @@ public:
   // resource related
   int64_t disk_io_thread_count_;
   int64_t data_storage_io_timeout_ms_;
+  // schedule related
+  bool enable_io_merge_;
 };
 
 template<int64_t SIZE>
@@ -213,13 +216,20 @@ public:
   int alloc_mclock_queue(ObIAllocator &allocator, ObMClockQueue *&io_queue);
   int enqueue_request(ObIORequest &req);
   int enqueue_phy_queue(ObPhyQueue *phyqueue);
-  int dequeue_request(ObIORequest *&req);
+  int dequeue_request(ObIORequest *&req, const bool need_wait = true);
   int remove_phy_queue(const uint64_t tenant_id);
   int notify();
   int32_t get_queue_count() const;
-  TO_STRING_KV(K(is_inited_), K(stop_submit_), KPC(io_queue_), K(tg_id_));
+  int64_t get_merged_submit_count() const { return ATOMIC_LOAD(&merged_submit_count_); }
+  TO_STRING_KV(K(is_inited_), K(stop_submit_), KPC(io_queue_), K(tg_id_), K(merged_submit_count_));
+  static const int64_t MAX_MERGE_BATCH_COUNT = 32;
+  static const int64_t MAX_MERGE_IO_SIZE = 2L * 1024L * 1024L; // 2MB
 //private:
   void pop_and_submit();
+  void submit_request(ObIORequest &req);
+  bool can_merge(ObIORequest &req) const;
+  void merge_and_submit(ObIORequest **reqs, const int64_t count);
+  int submit_merged(ObIORequest **reqs, const int64_t count);
   int64_t calc_wait_timeout(const int64_t queue_deadline);
   int submit(ObIORequest &req);
 
@@ -231,6 +241,7 @@ public:
   ObThreadCond queue_cond_;
   hash::ObHashMap<uint64_t, ObTenantPhyQueues *> tenant_map_;
   int64_t sender_req_count_;
+  int64_t merged_submit_count_; // ios submitted for merged requests
 };
 
 
@@ -304,6 +315,8 @@ public:
 
 private:
   void get_events();
+  void on_return(ObIORequest &req, const int system_errno, const int64_t complete_size);
+  void on_merged_return(ObIORequest &req, const int system_errno, const int64_t complete_size);
   int on_full_return(ObIORequest &req);
   int on_partial_return(ObIORequest &req, const int64_t complete_size);
   int on_partial_retry(ObIORequest &req, const int64_t complete_size);
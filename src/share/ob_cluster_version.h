@@ -146,6 +146,8 @@ cal_version(const uint64_t major, const uint64_t minor, const uint64_t major_pat
 // - 4. Print: cluster version str will be printed as 4 parts.
 #define CLUSTER_VERSION_3_2_3_0 (oceanbase::common::cal_version(3, 2, 3, 0))
 #define CLUSTER_VERSION_4_0_0_0 (oceanbase::common::cal_version(4, 0, 0, 0))
+// the observers before it can not replay the compressed tx log blocks
+#define CLUSTER_VERSION_4_1_0_0 (oceanbase::common::cal_version(4, 1, 0, 0))
 //FIXME If you update the above version, please update me, CLUSTER_CURRENT_VERSION & ObUpgradeChecker!!!!!!
 //!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 #define CLUSTER_CURRENT_VERSION CLUSTER_VERSION_4_0_0_0
@@ -92,7 +92,9 @@ ObLocalDevice::ObLocalDevice()
     block_bitmap_(nullptr),
     allocator_(),
     iocb_pool_(),
-    is_fs_support_punch_hole_(true)
+    is_fs_support_punch_hole_(true),
+    use_io_uring_(false),
+    use_io_uring_sqpoll_(false)
 {
 
   MEMSET(store_dir_, 0, sizeof(store_dir_));
@@ -141,6 +143,10 @@ int ObLocalDevice::init(const common::ObIODOpts &opts)
         datafile_size = opts.opts_[i].value_.value_int64;
       } else if (0 == STRCMP(opts.opts_[i].key_, "media_id")) {
         media_id = opts.opts_[i].value_.value_int64;
+      } else if (0 == STRCMP(opts.opts_[i].key_, "io_uring")) {
+        use_io_uring_ = opts.opts_[i].value_.value_bool;
+      } else if (0 == STRCMP(opts.opts_[i].key_, "io_uring_sqpoll")) {
+        use_io_uring_sqpoll_ = opts.opts_[i].value_.value_bool;
       } else {
         ret = OB_NOT_SUPPORTED;
         SHARE_LOG(WARN, "Not supported option, ", K(ret), K(i), K(opts.opts_[i].key_));
@@ -272,6 +278,8 @@ void ObLocalDevice::destroy()
     ::close(block_fd_);
   }
   block_fd_ = 0;
+  use_io_uring_ = false;
+  use_io_uring_sqpoll_ = false;
   is_inited_ = false;
   is_marked_ = false;
   is_fs_support_punch_hole_ = true;
@@ -1020,7 +1028,12 @@ int ObLocalDevice::io_setup(
     int sys_ret = 0;
     ObLocalIOContext *local_context = nullptr;
     local_context = new (buf) ObLocalIOContext();
-    if (0 != (sys_ret = ::io_setup(max_events, &(local_context->io_context_)))) {
+    if (use_io_uring_) {
+      setup_io_uring(max_events, *local_context);
+    }
+    if (nullptr != local_context->io_uring_) {
+      io_context = local_context;
+    } else if (0 != (sys_ret = ::io_setup(max_events, &(local_context->io_context_)))) {
       ret = OB_IO_ERROR;
       SHARE_LOG(WARN, "Fail to setup io context, ", K(ret), K(sys_ret), KERRMSG);
     } else {
@@ -1034,6 +1047,39 @@ int ObLocalDevice::io_setup(
   return ret;
 }
 
+void ObLocalDevice::setup_io_uring(const uint32_t max_events, ObLocalIOContext &io_context)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  ObLocalIOUring *io_uring = nullptr;
+  if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObLocalIOUring)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SHARE_LOG(WARN, "Fail to allocate memory, ", K(ret));
+  } else if (FALSE_IT(io_uring = new (buf) ObLocalIOUring())) {
+  } else if (OB_FAIL(io_uring->init(max_events, use_io_uring_sqpoll_))) {
+    io_uring->~ObLocalIOUring();
+    allocator_.free(io_uring);
+    io_uring = nullptr;
+  } else {
+    io_context.io_uring_ = io_uring;
+  }
+  if (OB_FAIL(ret)) {
+    SHARE_LOG(WARN, "Fail to setup io uring, fall back to libaio, ", K(ret), K(max_events),
+        K_(use_io_uring_sqpoll));
+  } else {
+    SHARE_LOG(INFO, "io context uses io uring, ", K(max_events), K_(use_io_uring_sqpoll));
+  }
+}
+
+void ObLocalDevice::destroy_io_uring(ObLocalIOContext &io_context)
+{
+  if (nullptr != io_context.io_uring_) {
+    io_context.io_uring_->~ObLocalIOUring();
+    allocator_.free(io_context.io_uring_);
+    io_context.io_uring_ = nullptr;
+  }
+}
+
 int ObLocalDevice::io_destroy(common::ObIOContext *io_context)
 {
   int ret = OB_SUCCESS;
@@ -1050,7 +1096,10 @@ int ObLocalDevice::io_destroy(common::ObIOContext *io_context)
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
   } else {
     int sys_ret = 0;
-    if ((sys_ret = ::io_destroy(local_io_context->io_context_)) != 0) {
+    if (nullptr != local_io_context->io_uring_) {
+      destroy_io_uring(*local_io_context);
+      allocator_.free(io_context);
+    } else if ((sys_ret = ::io_destroy(local_io_context->io_context_)) != 0) {
       ret = OB_IO_ERROR;
       SHARE_LOG(WARN, "Fail to destroy io context, ", K(ret), K(sys_ret), KERRMSG);
     } else {
@@ -1150,6 +1199,10 @@ int ObLocalDevice::io_submit(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->io_uring_) {
+    if (OB_FAIL(local_io_context->io_uring_->submit(local_iocb->iocb_))) {
+      SHARE_LOG(WARN, "Fail to submit io uring, ", K(ret));
+    }
   } else {
     iocbp = &(local_iocb->iocb_);
     int submit_ret = ::io_submit(local_io_context->io_context_, 1, &iocbp);
@@ -1182,6 +1235,10 @@ int ObLocalDevice::io_cancel(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->io_uring_) {
+    // the canceled request would still be completed on the cq, so io_uring never cancels,
+    // the same as the kernels which do not support io_cancel
+    ret = OB_NOT_SUPPORTED;
   } else {
     int sys_ret = 0;
     if ((sys_ret = ::io_cancel(local_io_context->io_context_, &(local_iocb->iocb_), &local_event)) < 0) {
@@ -1214,6 +1271,11 @@ int ObLocalDevice::io_getevents(
   } else if (OB_ISNULL(local_io_context = dynamic_cast<ObLocalIOContext*> (io_context))) {
     ret = OB_INVALID_ARGUMENT;
     SHARE_LOG(WARN, "Invalid io context pointer, ", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->io_uring_) {
+    if (OB_FAIL(local_io_context->io_uring_->get_events(min_nr, local_io_events->max_event_cnt_,
+        local_io_events->io_events_, timeout, local_io_events->complete_io_cnt_))) {
+      SHARE_LOG(WARN, "Fail to get io uring events, ", K(ret));
+    }
   } else {
     int sys_ret = 0;
     while ((sys_ret = ::io_getevents(
@@ -16,6 +16,7 @@
 #include <libaio.h>
 #include "lib/allocator/ob_fifo_allocator.h"
 #include "common/storage/ob_io_device.h"
+#include "share/ob_local_io_uring.h"
 
 namespace oceanbase {
 namespace share {
@@ -35,11 +36,13 @@ private:
 class ObLocalIOContext : public common::ObIOContext
 {
 public:
-  ObLocalIOContext() : io_context_() {}
+  ObLocalIOContext() : io_context_(), io_uring_(nullptr) {}
   virtual ~ObLocalIOContext() {}
 private:
   friend class ObLocalDevice;
   io_context_t io_context_;
+  // not null if the context uses io_uring instead of libaio
+  ObLocalIOUring *io_uring_;
 };
 
 class ObLocalIOEvents : public common::ObIOEvents
@@ -191,6 +194,8 @@ private:
   static int pread_impl(const int64_t fd, void *buf, const int64_t size, const int64_t offset, int64_t &read_size);
   static int pwrite_impl(const int64_t fd, const void *buf, const int64_t size, const int64_t offset, int64_t &write_size);
   static int convert_sys_errno();
+  void setup_io_uring(const uint32_t max_events, ObLocalIOContext &io_context);
+  void destroy_io_uring(ObLocalIOContext &io_context);
 private:
   static const int64_t DEFUALT_PRE_ALLOCATED_IOCB_COUNT = 32 * 512;// 32 thread * max_io_depth
 
@@ -213,6 +218,8 @@ private:
   common::ObFIFOAllocator allocator_;
   ObIOCBPool<ObLocalIOCB> iocb_pool_;
   bool is_fs_support_punch_hole_;
+  bool use_io_uring_;
+  bool use_io_uring_sqpoll_;
 };
 
 OB_INLINE int64_t ObLocalDevice::get_block_file_offset(const common::ObIOFd &fd, const int64_t offset)
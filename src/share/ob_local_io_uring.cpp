@@ -0,0 +1,347 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "share/ob_local_io_uring.h"
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/utility/utility.h"
+
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#endif
+#endif
+
+#ifdef IORING_ENTER_EXT_ARG
+#define OB_HAS_IO_URING 1
+// the system call numbers of io_uring are the same on all architectures
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#else
+#define OB_HAS_IO_URING 0
+#endif
+
+using namespace oceanbase::common;
+
+namespace oceanbase {
+namespace share {
+
+#if OB_HAS_IO_URING
+static int sys_io_uring_setup(const uint32_t entries, struct io_uring_params *params)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+static int sys_io_uring_enter(
+    const int fd,
+    const uint32_t to_submit,
+    const uint32_t min_complete,
+    const uint32_t flags,
+    const void *arg,
+    const size_t arg_size)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+                                    arg, arg_size));
+}
+#endif
+
+ObLocalIOUring::ObLocalIOUring()
+  : is_inited_(false),
+    sqpoll_(false),
+    ring_fd_(-1),
+    sq_ring_ptr_(MAP_FAILED),
+    sq_ring_size_(0),
+    cq_ring_ptr_(MAP_FAILED),
+    cq_ring_size_(0),
+    sqes_(nullptr),
+    sqes_size_(0),
+    sq_entries_(0),
+    sq_head_(nullptr),
+    sq_tail_(nullptr),
+    sq_mask_(nullptr),
+    sq_flags_(nullptr),
+    sq_array_(nullptr),
+    cq_head_(nullptr),
+    cq_tail_(nullptr),
+    cq_mask_(nullptr),
+    cqes_(nullptr),
+    enter_cnt_(0),
+    sq_lock_(),
+    enter_lock_()
+{
+}
+
+ObLocalIOUring::~ObLocalIOUring()
+{
+  destroy();
+}
+
+int ObLocalIOUring::init(const uint32_t entries, const bool sqpoll)
+{
+  int ret = OB_SUCCESS;
+#if OB_HAS_IO_URING
+  struct io_uring_params params;
+  MEMSET(&params, 0, sizeof(params));
+  if (sqpoll) {
+    params.flags |= IORING_SETUP_SQPOLL;
+    params.sq_thread_idle = 10; // ms
+  }
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    SHARE_LOG(WARN, "The io uring has been inited, ", K(ret));
+  } else if (OB_UNLIKELY(0 == entries)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid argument, ", K(ret), K(entries));
+  } else if ((ring_fd_ = sys_io_uring_setup(entries, &params)) < 0) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "Fail to setup io uring, ", K(ret), K(entries), K(sqpoll), K(errno), KERRMSG);
+  } else if (0 == (params.features & IORING_FEAT_EXT_ARG)) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "The kernel does not support waiting io uring with timeout, ", K(ret),
+        K(params.features));
+  } else {
+    sqpoll_ = sqpoll;
+    sq_entries_ = params.sq_entries;
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    const bool single_mmap = 0 != (params.features & IORING_FEAT_SINGLE_MMAP);
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = MAX(sq_ring_size_, cq_ring_size_);
+    }
+    if (MAP_FAILED == (sq_ring_ptr_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING))) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "Fail to mmap sq ring, ", K(ret), K(sq_ring_size_), K(errno), KERRMSG);
+    } else if (FALSE_IT(cq_ring_ptr_ = single_mmap ? sq_ring_ptr_ : ::mmap(nullptr, cq_ring_size_,
+        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING))) {
+    } else if (MAP_FAILED == cq_ring_ptr_) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "Fail to mmap cq ring, ", K(ret), K(cq_ring_size_), K(errno), KERRMSG);
+    } else {
+      void *sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          ring_fd_, IORING_OFF_SQES);
+      if (MAP_FAILED == sqes) {
+        ret = OB_IO_ERROR;
+        SHARE_LOG(WARN, "Fail to mmap sqes, ", K(ret), K(sqes_size_), K(errno), KERRMSG);
+      } else {
+        char *sq_ring = static_cast<char *>(sq_ring_ptr_);
+        char *cq_ring = static_cast<char *>(cq_ring_ptr_);
+        sqes_ = static_cast<struct io_uring_sqe *>(sqes);
+        sq_head_ = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.tail);
+        sq_mask_ = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.ring_mask);
+        sq_flags_ = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.flags);
+        sq_array_ = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.array);
+        cq_head_ = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.tail);
+        cq_mask_ = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<struct io_uring_cqe *>(cq_ring + params.cq_off.cqes);
+        is_inited_ = true;
+      }
+    }
+  }
+  if (OB_UNLIKELY(!is_inited_)) {
+    destroy();
+  }
+#else
+  UNUSED(entries);
+  UNUSED(sqpoll);
+  ret = OB_NOT_SUPPORTED;
+  SHARE_LOG(WARN, "io uring is not supported by this build, ", K(ret));
+#endif
+  return ret;
+}
+
+void ObLocalIOUring::destroy()
+{
+  if (nullptr != sqes_) {
+    ::munmap(sqes_, sqes_size_);
+    sqes_ = nullptr;
+  }
+  if (MAP_FAILED != cq_ring_ptr_ && cq_ring_ptr_ != sq_ring_ptr_) {
+    ::munmap(cq_ring_ptr_, cq_ring_size_);
+  }
+  cq_ring_ptr_ = MAP_FAILED;
+  if (MAP_FAILED != sq_ring_ptr_) {
+    ::munmap(sq_ring_ptr_, sq_ring_size_);
+    sq_ring_ptr_ = MAP_FAILED;
+  }
+  if (ring_fd_ >= 0) {
+    ::close(ring_fd_);
+    ring_fd_ = -1;
+  }
+  sq_head_ = sq_tail_ = sq_mask_ = sq_flags_ = sq_array_ = nullptr;
+  cq_head_ = cq_tail_ = cq_mask_ = nullptr;
+  cqes_ = nullptr;
+  sq_entries_ = 0;
+  enter_cnt_ = 0;
+  sqpoll_ = false;
+  is_inited_ = false;
+}
+
+int ObLocalIOUring::submit(const struct iocb &cb)
+{
+  int ret = OB_SUCCESS;
+#if OB_HAS_IO_URING
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "The io uring has not been inited, ", K(ret));
+  } else if (OB_UNLIKELY(IO_CMD_PREAD != cb.aio_lio_opcode && IO_CMD_PWRITE != cb.aio_lio_opcode)) {
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(WARN, "Not supported io command, ", K(ret), K(cb.aio_lio_opcode));
+  } else {
+    {
+      ObSpinLockGuard guard(sq_lock_);
+      const uint32_t tail = *sq_tail_;
+      if (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+        ret = OB_EAGAIN;
+        SHARE_LOG(DEBUG, "The sq of io uring is full, ", K(ret), K(tail), K(sq_entries_));
+      } else {
+        const uint32_t idx = tail & *sq_mask_;
+        struct io_uring_sqe *sqe = &sqes_[idx];
+        MEMSET(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IO_CMD_PREAD == cb.aio_lio_opcode ? IORING_OP_READ : IORING_OP_WRITE;
+        sqe->fd = cb.aio_fildes;
+        sqe->addr = reinterpret_cast<uint64_t>(cb.u.c.buf);
+        sqe->len = static_cast<uint32_t>(cb.u.c.nbytes);
+        sqe->off = static_cast<uint64_t>(cb.u.c.offset);
+        sqe->user_data = reinterpret_cast<uint64_t>(cb.data);
+        sq_array_[idx] = idx;
+        __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (sqpoll_) {
+      if (0 != (__atomic_load_n(sq_flags_, __ATOMIC_ACQUIRE) & IORING_SQ_NEED_WAKEUP)) {
+        (void)sys_io_uring_enter(ring_fd_, 0, 0, IORING_ENTER_SQ_WAKEUP, nullptr, 0);
+      }
+    } else {
+      // the sqe is queued, it is submitted by this thread or the one in io_uring_enter
+      flush_sq();
+    }
+  }
+#else
+  UNUSED(cb);
+  ret = OB_NOT_SUPPORTED;
+#endif
+  return ret;
+}
+
+void ObLocalIOUring::flush_sq()
+{
+#if OB_HAS_IO_URING
+  // the thread which holds enter_lock_ submits all the queued sqes in one system call, the
+  // others do not wait for it. The sq is checked again after unlocking, so the sqes queued
+  // while the holder is in io_uring_enter are never left behind
+  uint32_t to_submit = 0;
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  while (0 != (to_submit = __atomic_load_n(sq_tail_, __ATOMIC_ACQUIRE)
+                           - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE))
+         && OB_SUCCESS == enter_lock_.trylock()) {
+    int sys_ret = 0;
+    // the kernel consumes the sq from its head, the sqes of a failed system call are kept in the
+    // sq and submitted by the next one
+    while ((sys_ret = sys_io_uring_enter(ring_fd_, to_submit, 0, 0, nullptr, 0)) < 0
+           && EINTR == errno);
+    if (sys_ret > 0) {
+      ATOMIC_INC(&enter_cnt_);
+    }
+    enter_lock_.unlock();
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (sys_ret < 0) {
+      SHARE_LOG(WARN, "Fail to submit io uring, ", K(sys_ret), K(to_submit), K(errno), KERRMSG);
+      break;
+    } else if (0 == sys_ret) {
+      // the kernel can not take more sqes now, e.g. the cq is overflowed
+      break;
+    }
+  }
+#endif
+}
+
+int64_t ObLocalIOUring::reap_events(const int64_t max_nr, struct io_event *events)
+{
+  int64_t cnt = 0;
+#if OB_HAS_IO_URING
+  uint32_t head = *cq_head_;
+  const uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+  for (; head != tail && cnt < max_nr; ++head, ++cnt) {
+    const struct io_uring_cqe &cqe = cqes_[head & *cq_mask_];
+    events[cnt].data = reinterpret_cast<void *>(cqe.user_data);
+    events[cnt].obj = nullptr;
+    // negative errno is kept as libaio does
+    events[cnt].res = static_cast<unsigned long>(static_cast<long>(cqe.res));
+    events[cnt].res2 = 0;
+  }
+  __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+#else
+  UNUSED(max_nr);
+  UNUSED(events);
+#endif
+  return cnt;
+}
+
+int ObLocalIOUring::get_events(
+    const int64_t min_nr,
+    const int64_t max_nr,
+    struct io_event *events,
+    struct timespec *timeout,
+    int64_t &event_cnt)
+{
+  int ret = OB_SUCCESS;
+  event_cnt = 0;
+#if OB_HAS_IO_URING
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    SHARE_LOG(WARN, "The io uring has not been inited, ", K(ret));
+  } else if (OB_ISNULL(events) || OB_UNLIKELY(max_nr <= 0 || min_nr > max_nr)) {
+    ret = OB_INVALID_ARGUMENT;
+    SHARE_LOG(WARN, "Invalid argument, ", K(ret), KP(events), K(min_nr), K(max_nr));
+  } else if (!sqpoll_ && FALSE_IT(flush_sq())) {
+  } else if ((event_cnt = reap_events(max_nr, events)) < min_nr) {
+    struct __kernel_timespec ts;
+    struct io_uring_getevents_arg arg;
+    MEMSET(&arg, 0, sizeof(arg));
+    if (nullptr != timeout) {
+      ts.tv_sec = timeout->tv_sec;
+      ts.tv_nsec = timeout->tv_nsec;
+      arg.ts = reinterpret_cast<uint64_t>(&ts);
+    }
+    const int sys_ret = sys_io_uring_enter(ring_fd_, 0, static_cast<uint32_t>(min_nr - event_cnt),
+        IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+    if (sys_ret < 0 && ETIME != errno && EINTR != errno) {
+      ret = OB_IO_ERROR;
+      SHARE_LOG(WARN, "Fail to wait io uring, ", K(ret), K(sys_ret), K(errno), KERRMSG);
+    } else {
+      event_cnt += reap_events(max_nr - event_cnt, events + event_cnt);
+    }
+  }
+#else
+  UNUSED(min_nr);
+  UNUSED(max_nr);
+  UNUSED(events);
+  UNUSED(timeout);
+  ret = OB_NOT_SUPPORTED;
+#endif
+  return ret;
+}
+
+} /* namespace share */
+} /* namespace oceanbase */
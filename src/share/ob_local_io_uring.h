@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef SRC_SHARE_OB_LOCAL_IO_URING_H_
+#define SRC_SHARE_OB_LOCAL_IO_URING_H_
+
+#include <libaio.h>
+#include "lib/lock/ob_spin_lock.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace oceanbase {
+namespace share {
+
+// An io_uring ring used by ObLocalDevice in place of the libaio context of an io channel.
+//
+// The requests are still prepared as libaio iocbs and translated to sqes on submit, and the
+// completions are returned as libaio io_events, so the callers of ObIODevice see no difference.
+// The sq is shared by all the submitting threads and protected by a spin lock which is only held
+// to fill the sqes, the cq is reaped by the single polling thread of the channel. Without sqpoll,
+// the sqes queued by the concurrent submitting threads are submitted together by one
+// io_uring_enter. With sqpoll, the kernel thread consumes the sq and submitting needs no system
+// call unless the kernel thread has gone idle.
+//
+// The ring relies on IORING_ENTER_EXT_ARG (linux 5.11) to wait for completions with a timeout,
+// init() returns OB_NOT_SUPPORTED if the kernel or the build headers do not support it.
+class ObLocalIOUring
+{
+public:
+  ObLocalIOUring();
+  ~ObLocalIOUring();
+  int init(const uint32_t entries, const bool sqpoll);
+  void destroy();
+  int submit(const struct iocb &cb);
+  int get_events(
+      const int64_t min_nr,
+      const int64_t max_nr,
+      struct io_event *events,
+      struct timespec *timeout,
+      int64_t &event_cnt);
+  bool is_sqpoll() const { return sqpoll_; }
+private:
+  void flush_sq();
+  int64_t reap_events(const int64_t max_nr, struct io_event *events);
+private:
+  bool is_inited_;
+  bool sqpoll_;
+  int ring_fd_;
+  void *sq_ring_ptr_;
+  int64_t sq_ring_size_;
+  void *cq_ring_ptr_;
+  int64_t cq_ring_size_;
+  struct io_uring_sqe *sqes_;
+  int64_t sqes_size_;
+  uint32_t sq_entries_;
+  uint32_t *sq_head_;
+  uint32_t *sq_tail_;
+  uint32_t *sq_mask_;
+  uint32_t *sq_flags_;
+  uint32_t *sq_array_;
+  uint32_t *cq_head_;
+  uint32_t *cq_tail_;
+  uint32_t *cq_mask_;
+  struct io_uring_cqe *cqes_;
+  int64_t enter_cnt_; // io_uring_enter calls which submitted the sq
+  common::ObSpinLock sq_lock_;
+  common::ObSpinLock enter_lock_;
+  DISALLOW_COPY_AND_ASSIGN(ObLocalIOUring);
+};
+
+} /* namespace share */
+} /* namespace oceanbase */
+
+#endif /* SRC_SHARE_OB_LOCAL_IO_URING_H_ */
@@ -225,6 +225,10 @@ DEF_STR_WITH_CHECKER(tableapi_transport_compress_func, OB_CLUSTER_PARAMETER, "no
                      common::ObConfigCompressFuncChecker,
                      "compressor used for tableAPI query result. Values: none, lz4_1.0, snappy_1.0, zlib_1.0, zstd_1.0 zstd 1.3.8",
                      ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_tableapi_query_prefetch, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether the next result of a tableAPI sync query is scanned in advance "
+         "after the current result is responded. Value: True or False",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_CAP(_sort_area_size, OB_TENANT_PARAMETER, "128M", "[2M,]",
         "size of maximum memory that could be used by SORT. Range: [2M,+∞)",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -300,6 +304,16 @@ DEF_INT(global_write_halt_residual_memory, OB_CLUSTER_PARAMETER, "30", "(0, 100)
         "disable write to memstore when observer memstore free memory(plus memory hold by blockcache) lower than this limit, Range: (0, 100)"
         "limit calc by (memory_limit - system_memory) * global_write_halt_residual_memory/100",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_tenant_work_stealing, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether the idle workers of a tenant take the queued requests of its busy "
+         "resource groups and deeper request levels, a group never runs more requests than its "
+         "max token count, and no request is stolen from the groups while cgroup is enabled",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_blocked_worker_compensation, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether a tenant activates one more worker for each of its workers blocked "
+         "on remote das, gts or io waits, so that a small cpu_quota_concurrency keeps the "
+         "same concurrency",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(px_workers_per_cpu_quota, OB_CLUSTER_PARAMETER, "10", "[0,20]",
         "the ratio(integer) between the number of system allocated px workers vs "
         "the maximum number of threads that can be scheduled concurrently. Range: [0, 20]",
@@ -503,17 +517,15 @@ DEF_INT(log_disk_percentage, OB_CLUSTER_PARAMETER, "0", "[0,99]",
 //                     "compressor used for clog transport. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
 //                     ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
-// TODO(xianlin.lh): add the feature on 4.1
-//DEF_BOOL(enable_clog_persistence_compress, OB_TENANT_PARAMETER, "False",
-//         "If this option is set to true, use compression for clog persistence. "
-//         "The default is false(no compression)",
-//         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(enable_clog_persistence_compress, OB_TENANT_PARAMETER, "False",
+         "If this option is set to true, use compression for clog persistence. "
+         "The default is false(no compression)",
+         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
-// TODO(xianlin.lh): add the feature on 4.1
-//DEF_STR_WITH_CHECKER(clog_persistence_compress_func, OB_TENANT_PARAMETER, "lz4_1.0",
-//                     common::ObConfigPerfCompressFuncChecker,
-//                     "compressor used for clog persistence. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
-//                     ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_STR_WITH_CHECKER(clog_persistence_compress_func, OB_TENANT_PARAMETER, "lz4_1.0",
+                     common::ObConfigPerfCompressFuncChecker,
+                     "compressor used for clog persistence. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
+                     ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 // TODO(shuning.tsn) : add the feature on 4.1
 //DEF_BOOL(enable_log_archive, OB_CLUSTER_PARAMETER, "False",
@@ -546,6 +558,18 @@ DEF_INT(log_disk_utilization_threshold, OB_TENANT_PARAMETER,"80",
         "Range: [10, 100)",
         ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
+DEF_TIME(_log_target_commit_latency, OB_TENANT_PARAMETER, "2ms", "[0ms, 100ms]",
+        "target latency of the group commit of log writes, the log io worker waits for more logs "
+        "before writing a batch only when the write latency is below it, 0 means never wait. "
+        "Range: [0ms, 100ms]",
+        ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
+DEF_CAP(_log_hot_cache_size, OB_TENANT_PARAMETER, "8M", "[0M, 64M]",
+        "size of the cache of the recently written log of each log stream, it takes effect "
+        "for the log streams created or loaded after it is changed, 0 means disable the cache. "
+        "Range: [0M, 64M]",
+        ObParameterAttr(Section::LOGSERVICE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+
 // ========================= LogService Config End   =====================
 DEF_INT(resource_hard_limit, OB_CLUSTER_PARAMETER, "100", "[100, 10000]",
         "system utilization should not be large than resource_hard_limit",
@@ -730,6 +754,18 @@ DEF_INT_WITH_CHECKER(disk_io_thread_count, OB_CLUSTER_PARAMETER, "8",
                      "[2,32]",
                      "The number of io threads on each disk. The default value is 8. Range: [2,32] in even integer",
                      ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_io_request_merge, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether the adjacent reads of the same file which are ready to be sent together "
+         "are merged into one io. Value: True or False",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_io_uring, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether the data disk is accessed with io_uring instead of libaio, "
+         "libaio is still used if the kernel does not support io_uring. Value: True or False",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_BOOL(_enable_io_uring_sqpoll, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether io_uring submits the data disk io with a kernel polling thread, "
+         "only takes effect when _enable_io_uring is True. Value: True or False",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 DEF_INT(_io_callback_thread_count, OB_TENANT_PARAMETER, "8", "[1,64]",
         "The number of io callback threads. The default value is 8. Range: [1,64] in integer",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -994,6 +1030,11 @@ DEF_TIME(_backup_task_keep_alive_timeout, OB_CLUSTER_PARAMETER, "10m", "[1s,)",
 DEF_BOOL(ob_enable_batched_multi_statement, OB_TENANT_PARAMETER, "False",
          "enable use of batched multi statement",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_ins_multi_values_batch_opt, OB_TENANT_PARAMETER, "False",
+         "enable executing a multi-row INSERT ... VALUES statement as a batch of single row "
+         "statements, which share one array-bound plan regardless of the number of rows. "
+         "It is always enabled when ob_enable_batched_multi_statement is True",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_BOOL(_enable_dist_data_access_service, OB_TENANT_PARAMETER, "True",
          "enable use das service",
@@ -1031,6 +1072,10 @@ DEF_STR_WITH_CHECKER(_ob_plan_cache_gc_strategy, OB_CLUSTER_PARAMETER, "REPORT",
 DEF_BOOL(_enable_plan_cache_mem_diagnosis, OB_CLUSTER_PARAMETER, "False",
          "wether turn plan cache ref count diagnosis on",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_plan_cache_hot_node_cache, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether the recently hit plan cache nodes are cached per cpu, "
+         "which lets hot statements skip the global plan cache map",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_STR(external_kms_info, OB_TENANT_PARAMETER, "",
         "when using the external key management center, "
@@ -1244,6 +1289,10 @@ DEF_STR(_trace_control_info, OB_TENANT_PARAMETER, "{\n  \"type_t\": {\n    \"lev
 DEF_INT(_print_sample_ppm, OB_TENANT_PARAMETER, "0", "[0, 1000000]",
         "In the full link diagnosis, control the frequency of printing traces to the log (unit is ppm, parts per million).",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_tx_commit_stage_sample_ratio, OB_TENANT_PARAMETER, "0", "[0, 100]",
+        "percentage of committing transactions whose latency of each commit stage is traced, "
+        "0 disables the tracing. Range: [0, 100]",
+        ObParameterAttr(Section::TRANS, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_TIME(ob_query_switch_leader_retry_timeout, OB_TENANT_PARAMETER, "0ms", "[0ms,]",
          "max time spend on retry caused by leader swith or network disconnection"
          "Range: [0ms, +∞)",
@@ -118,6 +118,9 @@ ObPxTransmitSpec::ObPxTransmitSpec(ObIAllocator &alloc, const ObPhyOperatorType
 
 ObPxTransmitOp::ObPxTransmitOp(ObExecContext &exec_ctx, const ObOpSpec &spec, ObOpInput *input)
 : ObTransmitOp(exec_ctx, spec, input),
+  slice_row_keys_(NULL),
+  slice_row_cnts_(NULL),
+  slice_row_cnts_cap_(0),
   px_row_allocator_(common::ObModIds::OB_SQL_PX),
   transmited_(false),
   // first_row_(),
@@ -145,6 +148,9 @@ void ObPxTransmitOp::destroy()
   px_row_allocator_.reset();
   ch_blocks_.reset();
   blk_bufs_.reset();
+  slice_row_keys_ = NULL;
+  slice_row_cnts_ = NULL;
+  slice_row_cnts_cap_ = 0;
   task_channels_.reset();
   dfc_.destroy();
   loop_.reset();
@@ -614,27 +620,17 @@ int ObPxTransmitOp::send_rows_in_batch(ObSliceIdxCalc &slice_calc)
       }
     } else if (brs_.size_ > 0) {
       int64_t *indexes = NULL;
+      int64_t key_cnt = 0;
       if (OB_FAIL(slice_calc.get_slice_idx_vec(spec_.output_, eval_ctx_,
                                                *brs_.skip_, brs_.size_,
                                                indexes))) {
         LOG_WARN("calc slice indexes failed", K(ret));
+      } else if (OB_FAIL(group_rows_by_slice(indexes, key_cnt))) {
+        LOG_WARN("group rows by slice failed", K(ret));
       } else {
-        for (int64_t i = 0; OB_SUCC(ret) && i < brs_.size_; i++) {
-          if (brs_.skip_->at(i) || indexes[i] < 0) { continue; }
-            __builtin_prefetch(&blk_bufs_.at(indexes[i]),
-                               0, // for read
-                               1); // low temporal locality
-        }
-        for (int64_t i = 0; OB_SUCC(ret) && i < brs_.size_; i++) {
-          if (brs_.skip_->at(i) || indexes[i] < 0) { continue; }
-          if (blk_bufs_.at(indexes[i]).is_inited()) {
-            __builtin_prefetch(blk_bufs_.at(indexes[i]).head(),
-                               1, // for write
-                               1); // low temporal locality
-          }
-        }
-        for (int64_t i = 0; OB_SUCC(ret) && i < brs_.size_; i++) {
-          if (brs_.skip_->at(i)) {
+        // rows to drop
+        for (int64_t i = 0; OB_SUCC(ret) && key_cnt < brs_.size_ && i < brs_.size_; i++) {
+          if (brs_.skip_->at(i) || indexes[i] >= 0) {
             continue;
           }
           batch_info_guard.set_batch_idx(i);
@@ -644,6 +640,16 @@ int ObPxTransmitOp::send_rows_in_batch(ObSliceIdxCalc &slice_calc)
             LOG_WARN("fail emit row to interm result", K(ret), K(slice_idx_array));
           }
         }
+        for (int64_t k = 0; OB_SUCC(ret) && k < key_cnt; k++) {
+          const int64_t slice_idx = static_cast<int64_t>(slice_row_keys_[k] >> 32);
+          const int64_t i = static_cast<int64_t>(slice_row_keys_[k] & UINT32_MAX);
+          batch_info_guard.set_batch_idx(i);
+          row_count += 1;
+          metric_.count();
+          if (OB_FAIL(send_row(slice_idx, send_row_time_recorder, tablet_id.get_int()))) {
+            LOG_WARN("fail emit row to interm result", K(ret), K(slice_idx_array));
+          }
+        }
       }
     }
     if (OB_SUCC(ret) && brs_.end_) {
@@ -677,6 +683,82 @@ int ObPxTransmitOp::send_rows_in_batch(ObSliceIdxCalc &slice_calc)
   return ret;
 }
 
+int ObPxTransmitOp::group_rows_by_slice(const int64_t *indexes, int64_t &key_cnt)
+{
+  int ret = OB_SUCCESS;
+  const int64_t ch_cnt = task_channels_.count();
+  const bool counting_sort = ch_cnt <= spec_.max_batch_size_;
+  key_cnt = 0;
+  if (NULL == slice_row_keys_
+      && OB_ISNULL(slice_row_keys_ = static_cast<uint64_t *>(
+          ctx_.get_allocator().alloc(sizeof(uint64_t) * spec_.max_batch_size_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc slice row keys failed", K(ret), K(spec_.max_batch_size_));
+  } else if (counting_sort && slice_row_cnts_cap_ < ch_cnt + 1) {
+    if (OB_ISNULL(slice_row_cnts_ = static_cast<int64_t *>(
+        ctx_.get_allocator().alloc(sizeof(int64_t) * (ch_cnt + 1))))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("alloc slice row counts failed", K(ret), K(ch_cnt));
+    } else {
+      slice_row_cnts_cap_ = ch_cnt + 1;
+    }
+  }
+  if (OB_SUCC(ret) && OB_FAIL(build_slice_row_keys(indexes, *brs_.skip_, brs_.size_, ch_cnt,
+                                                   counting_sort ? slice_row_cnts_ : NULL,
+                                                   slice_row_keys_, key_cnt))) {
+    LOG_WARN("build slice row keys failed", K(ret), K(ch_cnt));
+  }
+  return ret;
+}
+
+int ObPxTransmitOp::build_slice_row_keys(const int64_t *indexes,
+                                         const ObBitVector &skip,
+                                         const int64_t size,
+                                         const int64_t ch_cnt,
+                                         int64_t *slice_row_cnts,
+                                         uint64_t *slice_row_keys,
+                                         int64_t &key_cnt)
+{
+  int ret = OB_SUCCESS;
+  key_cnt = 0;
+  for (int64_t i = 0; OB_SUCC(ret) && i < size; i++) {
+    if (skip.at(i) || indexes[i] < 0) {
+    } else if (OB_UNLIKELY(indexes[i] >= ch_cnt)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("invalid slice index", K(ret), K(i), K(indexes[i]), K(ch_cnt));
+    } else {
+      key_cnt++;
+    }
+  }
+  if (OB_FAIL(ret) || 0 == key_cnt) {
+  } else if (NULL != slice_row_cnts) {
+    // slice_row_cnts[s] is the start position of slice s after the prefix sum
+    MEMSET(slice_row_cnts, 0, sizeof(int64_t) * (ch_cnt + 1));
+    for (int64_t i = 0; i < size; i++) {
+      if (!skip.at(i) && indexes[i] >= 0) {
+        slice_row_cnts[indexes[i] + 1]++;
+      }
+    }
+    for (int64_t s = 1; s < ch_cnt; s++) {
+      slice_row_cnts[s] += slice_row_cnts[s - 1];
+    }
+    for (int64_t i = 0; i < size; i++) {
+      if (!skip.at(i) && indexes[i] >= 0) {
+        slice_row_keys[slice_row_cnts[indexes[i]]++] = (static_cast<uint64_t>(indexes[i]) << 32) | i;
+      }
+    }
+  } else {
+    int64_t pos = 0;
+    for (int64_t i = 0; i < size; i++) {
+      if (!skip.at(i) && indexes[i] >= 0) {
+        slice_row_keys[pos++] = (static_cast<uint64_t>(indexes[i]) << 32) | i;
+      }
+    }
+    std::sort(slice_row_keys, slice_row_keys + key_cnt);
+  }
+  return ret;
+}
+
 int ObPxTransmitOp::send_eof_row()
 {
   int ret = OB_SUCCESS;
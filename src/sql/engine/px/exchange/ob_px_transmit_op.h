@@ -143,6 +143,20 @@ private:
   int send_row(int64_t slice_idx,
                int64_t &time_recorder,
                int64_t tablet_id);
+  // Group the rows of current batch by slice index into slice_row_keys_, so that
+  // the rows are appended to one channel block after another. A key is
+  // (slice index << 32 | row index), rows of the same slice keep their order.
+  // Rows skipped or with negative slice index are not grouped.
+  int group_rows_by_slice(const int64_t *indexes, int64_t &key_cnt);
+  // Fill slice_row_keys with the keys of rows [0, size), a counting sort is used
+  // when slice_row_cnts (ch_cnt + 1 counters) is given, otherwise the keys are sorted.
+  static int build_slice_row_keys(const int64_t *indexes,
+                                  const ObBitVector &skip,
+                                  const int64_t size,
+                                  const int64_t ch_cnt,
+                                  int64_t *slice_row_cnts,
+                                  uint64_t *slice_row_keys,
+                                  int64_t &key_cnt);
   int send_eof_row();
   int broadcast_eof_row();
   int next_row();
@@ -158,6 +172,11 @@ private:
 protected:
   ObArray<ObChunkDatumStore::Block *> ch_blocks_;
   ObArray<ObChunkDatumStore::BlockBufferWrap> blk_bufs_;
+  uint64_t *slice_row_keys_;
+  // row count of each slice for counting sort, used when the channel count is
+  // not larger than the batch size, otherwise slice_row_keys_ is sorted directly.
+  int64_t *slice_row_cnts_;
+  int64_t slice_row_cnts_cap_;
   common::ObArray<dtl::ObDtlChannel*> task_channels_;
   common::ObArenaAllocator px_row_allocator_;
   ObPxTaskChSet task_ch_set_;
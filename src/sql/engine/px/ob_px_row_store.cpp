@@ -186,19 +186,14 @@ int ObReceiveRowReader::add_buffer(dtl::ObDtlLinkedBuffer &buf, bool &transferre
     }
   } else {
     // add buffer to receive list.
+    // The rows are swizzled one by one when they are iterated, see next_store_row(),
+    // so that the block is scanned only once and the buffer is used in place,
+    // local channels hand the buffer over by pointer without any copy.
     int64_t rows = 0;
     if (dtl::PX_DATUM_ROW == buf.msg_type()) {
-      auto block = reinterpret_cast<ObChunkDatumStore::Block *>(buf.buf());
-      rows = block->rows_;
-      if (rows > 0 && OB_FAIL(block->swizzling(NULL))) {
-        LOG_WARN("block swizzling failed", K(ret));
-      }
+      rows = reinterpret_cast<ObChunkDatumStore::Block *>(buf.buf())->rows_;
     } else {
-      auto block = reinterpret_cast<ObChunkRowStore::Block *>(buf.buf());
-      rows = block->rows_;
-      if (rows > 0 && OB_FAIL(block->swizzling(NULL))) {
-        LOG_WARN("block swizzling failed", K(ret));
-      }
+      rows = reinterpret_cast<ObChunkRowStore::Block *>(buf.buf())->rows_;
     }
     if (OB_SUCC(ret)){
       if (rows > 0) {
@@ -284,6 +279,8 @@ const ROW *ObReceiveRowReader::next_store_row()
       if (OB_FAIL(ret)) {
         LOG_WARN("fetch store row failed", K(ret));
       } else {
+        // the row is received unswizzled, each row is iterated only once
+        const_cast<ROW *>(srow)->swizzling();
         cur_iter_rows_ += 1;
       }
     }
@@ -34,6 +34,21 @@ public:
   virtual int open(ObExecContext &ctx) = 0;
   virtual int get_next_row(ObExecContext &ctx, const common::ObNewRow *&row) = 0;
   virtual int close(ObExecContext &ctx) = 0;
+  // batch interface, only the local vectorized plan is able to return a batch of rows,
+  // the rows are the datums of the output exprs, see get_batch_output()
+  virtual bool is_vectorized() const { return false; }
+  virtual int get_next_batch(ObExecContext &ctx,
+                             const int64_t max_row_cnt,
+                             const ObBatchRows *&brs)
+  {
+    UNUSEDx(ctx, max_row_cnt, brs);
+    return common::OB_NOT_SUPPORTED;
+  }
+  virtual int get_batch_output(const common::ObIArray<ObExpr *> *&exprs, ObEvalCtx *&eval_ctx)
+  {
+    UNUSEDx(exprs, eval_ctx);
+    return common::OB_NOT_SUPPORTED;
+  }
 };
 
 class ObExecuteResult : public ObIExecuteResult
@@ -49,6 +64,12 @@ public:
   virtual int open(ObExecContext &ctx) override;
   virtual int get_next_row(ObExecContext &ctx, const common::ObNewRow *&row) override;
   virtual int close(ObExecContext &ctx) override;
+  virtual bool is_vectorized() const override;
+  virtual int get_next_batch(ObExecContext &ctx,
+                             const int64_t max_row_cnt,
+                             const ObBatchRows *&brs) override;
+  virtual int get_batch_output(const common::ObIArray<ObExpr *> *&exprs,
+                               ObEvalCtx *&eval_ctx) override;
 
   inline int get_err_code() { return err_code_; }
 
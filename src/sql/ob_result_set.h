@@ -116,6 +116,13 @@ public:
   /// get the next result row
   /// @return OB_ITER_END when no more data available
   int get_next_row(const common::ObNewRow *&row);
+  /// whether the rows can be fetched in batch, i.e. the local vectorized plan
+  bool is_vectorized_result() const;
+  /// get the next batch of result rows, no more than max_row_cnt rows (including the skipped ones)
+  /// @note don't mix with get_next_row()
+  int get_next_batch(const int64_t max_row_cnt, const ObBatchRows *&brs);
+  /// get the output exprs and eval ctx to locate the datums of the batch rows
+  int get_batch_output(const common::ObIArray<ObExpr *> *&exprs, ObEvalCtx *&eval_ctx);
   /// close the result set after get all the rows
   int close();
   /// get number of rows affected by INSERT/UPDATE/DELETE
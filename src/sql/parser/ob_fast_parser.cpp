@@ -12,6 +12,7 @@
 
 #define USING_LOG_PREFIX SQL_PARSER
 #include "ob_fast_parser.h"
+#include "ob_fast_parser_simd.h"
 #include "share/ob_define.h"
 #include "lib/ash/ob_active_session_guard.h"
 #include "lib/worker.h"
@@ -1354,7 +1355,11 @@ int ObFastParserBase::process_comment_content()
   bool is_match = false;
   char ch = raw_sql_.scan();
   while (!raw_sql_.is_search_end()) {
-    if ('*' == ch && '/' == raw_sql_.peek()) {
+    if ('*' != ch) {
+      // jump to the next '*'
+      ch = raw_sql_.scan_to(ObFastParserSimd::find_char(
+          raw_sql_.raw_sql_, raw_sql_.raw_sql_len_, raw_sql_.cur_pos_, '*'));
+    } else if ('/' == raw_sql_.peek()) {
       // scan '\/'
       raw_sql_.scan();
       is_match = true;
@@ -1606,9 +1611,10 @@ int ObFastParserBase::process_number(bool has_minus)
   bool need_parameterized = false;
   ObItemType param_type = T_INVALID;
   char ch = raw_sql_.char_at(raw_sql_.cur_pos_);
-  while (is_digit(ch)) {
+  if (is_digit(ch)) {
     is_digit_first = true;
-    ch = raw_sql_.scan();
+    ch = raw_sql_.scan_to(ObFastParserSimd::skip_digits(
+        raw_sql_.raw_sql_, raw_sql_.raw_sql_len_, raw_sql_.cur_pos_));
   }
   bool is_double = false;
   bool has_dot = false;
@@ -1616,8 +1622,9 @@ int ObFastParserBase::process_number(bool has_minus)
     is_double = true;
     has_dot = true;
     ch = raw_sql_.scan();
-    while (is_digit(ch)) {
-      ch = raw_sql_.scan();
+    if (is_digit(ch)) {
+      ch = raw_sql_.scan_to(ObFastParserSimd::skip_digits(
+          raw_sql_.raw_sql_, raw_sql_.raw_sql_len_, raw_sql_.cur_pos_));
     }
   }
   // If there is no digit, the content after the character 'e' does not need to be matched,
@@ -1835,8 +1842,9 @@ int ObFastParserMysql::process_string(const char quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && quote != ch) {
-        ch = raw_sql_.scan();
+      if (!raw_sql_.is_search_end() && '\\' != ch && quote != ch) {
+        ch = raw_sql_.scan_to(ObFastParserSimd::find_quote_or_backslash(
+            raw_sql_.raw_sql_, raw_sql_.raw_sql_len_, raw_sql_.cur_pos_, quote));
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -2300,8 +2308,9 @@ int ObFastParserOracle::process_string(const bool in_q_quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && '\'' != ch) {
-        ch = raw_sql_.scan();
+      if (!raw_sql_.is_search_end() && '\\' != ch && '\'' != ch) {
+        ch = raw_sql_.scan_to(ObFastParserSimd::find_quote_or_backslash(
+            raw_sql_.raw_sql_, raw_sql_.raw_sql_len_, raw_sql_.cur_pos_, '\''));
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -111,6 +111,8 @@ protected:
 			return raw_sql_[cur_pos_];
 		}
 		inline char scan() { return scan(1); }
+		// move to pos found by ObFastParserSimd, pos is not less than cur_pos_
+		inline char scan_to(const int64_t pos) { return scan(pos - cur_pos_); }
 		inline char reverse_scan()
 		{
 			if (cur_pos_ <= 0 || cur_pos_ >= raw_sql_len_ + 1) {
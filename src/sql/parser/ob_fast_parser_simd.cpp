@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_fast_parser_simd.h"
+#include <string.h>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace oceanbase
+{
+namespace sql
+{
+
+static int64_t find_quote_or_backslash_normal(const char *str,
+                                              const int64_t len,
+                                              int64_t pos,
+                                              const char quote)
+{
+  while (pos < len && '\\' != str[pos] && quote != str[pos]) {
+    pos++;
+  }
+  return pos;
+}
+
+static int64_t skip_digits_normal(const char *str, const int64_t len, int64_t pos)
+{
+  while (pos < len && str[pos] >= '0' && str[pos] <= '9') {
+    pos++;
+  }
+  return pos;
+}
+
+#if defined(__x86_64__)
+static const int64_t AVX2_WIDTH = 32;
+
+__attribute__((target("avx2")))
+static int64_t find_quote_or_backslash_avx2(const char *str,
+                                            const int64_t len,
+                                            int64_t pos,
+                                            const char quote)
+{
+  const __m256i quote_vec = _mm256_set1_epi8(quote);
+  const __m256i backslash_vec = _mm256_set1_epi8('\\');
+  int64_t ret_pos = -1;
+  while (-1 == ret_pos && pos + AVX2_WIDTH <= len) {
+    const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(str + pos));
+    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+        _mm256_or_si256(_mm256_cmpeq_epi8(data, quote_vec), _mm256_cmpeq_epi8(data, backslash_vec))));
+    if (0 != mask) {
+      ret_pos = pos + __builtin_ctz(mask);
+    } else {
+      pos += AVX2_WIDTH;
+    }
+  }
+  return -1 != ret_pos ? ret_pos : find_quote_or_backslash_normal(str, len, pos, quote);
+}
+
+__attribute__((target("avx2")))
+static int64_t skip_digits_avx2(const char *str, const int64_t len, int64_t pos)
+{
+  // bytes are compared as signed chars, so the non ascii bytes are never digits
+  const __m256i lower_vec = _mm256_set1_epi8('0' - 1);
+  const __m256i upper_vec = _mm256_set1_epi8('9' + 1);
+  int64_t ret_pos = -1;
+  while (-1 == ret_pos && pos + AVX2_WIDTH <= len) {
+    const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(str + pos));
+    const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(data, lower_vec),
+                                           _mm256_cmpgt_epi8(upper_vec, data));
+    const uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(digit));
+    if (0 != mask) {
+      ret_pos = pos + __builtin_ctz(mask);
+    } else {
+      pos += AVX2_WIDTH;
+    }
+  }
+  return -1 != ret_pos ? ret_pos : skip_digits_normal(str, len, pos);
+}
+
+static bool is_avx2_supported()
+{
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+}
+#else
+static bool is_avx2_supported()
+{
+  return false;
+}
+#endif
+
+static bool simd_enabled = is_avx2_supported();
+
+int64_t ObFastParserSimd::find_quote_or_backslash(const char *str,
+                                                  const int64_t len,
+                                                  const int64_t pos,
+                                                  const char quote)
+{
+#if defined(__x86_64__)
+  return simd_enabled ? find_quote_or_backslash_avx2(str, len, pos, quote)
+                      : find_quote_or_backslash_normal(str, len, pos, quote);
+#else
+  return find_quote_or_backslash_normal(str, len, pos, quote);
+#endif
+}
+
+int64_t ObFastParserSimd::skip_digits(const char *str, const int64_t len, const int64_t pos)
+{
+#if defined(__x86_64__)
+  return simd_enabled ? skip_digits_avx2(str, len, pos) : skip_digits_normal(str, len, pos);
+#else
+  return skip_digits_normal(str, len, pos);
+#endif
+}
+
+int64_t ObFastParserSimd::find_char(const char *str,
+                                    const int64_t len,
+                                    const int64_t pos,
+                                    const char ch)
+{
+  // memchr of glibc is vectorized already
+  int64_t ret_pos = len;
+  if (pos < len) {
+    const char *p = static_cast<const char *>(memchr(str + pos, ch, len - pos));
+    ret_pos = NULL == p ? len : p - str;
+  }
+  return ret_pos;
+}
+
+void ObFastParserSimd::set_simd_enabled(const bool enabled)
+{
+  simd_enabled = enabled && is_avx2_supported();
+}
+
+bool ObFastParserSimd::is_simd_enabled()
+{
+  return simd_enabled;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_PARSER_FAST_PARSER_SIMD_
+#define OCEANBASE_SQL_PARSER_FAST_PARSER_SIMD_
+
+#include <stdint.h>
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// Vectorized scanning of the long runs ObFastParser skips over (string literals,
+// numbers and comments), 32 bytes are checked at a time with AVX2.
+//
+// The fast parser is also built into the proxy parser, which is compiled without
+// -mavx2, so the AVX2 code is enabled by the function target attribute and only
+// used when the cpu supports it, otherwise the scalar code is used.
+//
+// All functions scan [pos, len) of str and return len if nothing is found.
+struct ObFastParserSimd
+{
+  // the first position holding quote or backslash
+  static int64_t find_quote_or_backslash(const char *str,
+                                         const int64_t len,
+                                         const int64_t pos,
+                                         const char quote);
+  // the first position holding a non digit char
+  static int64_t skip_digits(const char *str, const int64_t len, const int64_t pos);
+  // the first position holding ch
+  static int64_t find_char(const char *str, const int64_t len, const int64_t pos, const char ch);
+  // only for test and benchmark, simd can not be enabled if the cpu does not support it
+  static void set_simd_enabled(const bool enabled);
+  static bool is_simd_enabled();
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif /* OCEANBASE_SQL_PARSER_FAST_PARSER_SIMD_ */
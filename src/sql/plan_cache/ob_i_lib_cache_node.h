@@ -103,6 +103,7 @@ public:
       rwlock_(),
       ref_count_(0),
       lib_cache_(lib_cache),
+      cache_key_(NULL),
       co_list_lock_(common::ObLatchIds::PLAN_SET_LOCK),
       co_list_(allocator_)
   {
@@ -160,6 +161,9 @@ public:
   lib::MemoryContext &get_mem_context() { return mem_context_; }
   int64_t get_mem_size();
   ObPlanCache *get_lib_cache() const { return lib_cache_; }
+  // the key of this node in the lib cache map, allocated by this node
+  void set_cache_key(ObILibCacheKey *cache_key) { cache_key_ = cache_key; }
+  const ObILibCacheKey *get_cache_key() const { return cache_key_; }
 
   VIRTUAL_TO_STRING_KV(K_(ref_count), K_(lock_timeout_ts));
 
@@ -209,6 +213,7 @@ protected:
   int64_t lock_timeout_ts_;
   StmtStat node_stat_;
   ObPlanCache *lib_cache_;
+  ObILibCacheKey *cache_key_;
   common::SpinRWLock co_list_lock_;
   CacheObjList co_list_;
 };
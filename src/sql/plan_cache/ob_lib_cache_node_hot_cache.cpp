@@ -0,0 +1,154 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+#include "sql/plan_cache/ob_lib_cache_node_hot_cache.h"
+#include "lib/cpu/ob_cpu_topology.h"
+#include "lib/container/ob_se_array.h"
+#include "lib/container/ob_se_array_iterator.h"
+#include <algorithm>
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+ObLCNodeHotCache::ObLCNodeHotCache()
+  : is_inited_(false),
+    buckets_(NULL),
+    bucket_cnt_(0),
+    is_used_(false),
+    qsync_()
+{
+}
+
+ObLCNodeHotCache::~ObLCNodeHotCache()
+{
+  destroy();
+}
+
+int ObLCNodeHotCache::init(const uint64_t tenant_id)
+{
+  int ret = OB_SUCCESS;
+  const int64_t bucket_cnt = MAX(1, get_cpu_count());
+  void *buf = NULL;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_ISNULL(buf = ob_malloc(sizeof(Bucket) * bucket_cnt,
+                                       ObMemAttr(tenant_id, "LCNodeHotCache")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc hot cache buckets", K(ret), K(bucket_cnt));
+  } else {
+    buckets_ = new(buf) Bucket[bucket_cnt];
+    bucket_cnt_ = bucket_cnt;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObLCNodeHotCache::destroy()
+{
+  if (NULL != buckets_) {
+    // nodes are never referenced by the hot cache, just drop the slots
+    ob_free(buckets_);
+    buckets_ = NULL;
+  }
+  bucket_cnt_ = 0;
+  is_used_ = false;
+  is_inited_ = false;
+}
+
+ObILibCacheNode *ObLCNodeHotCache::get(const ObILibCacheKey &key, const uint64_t hash)
+{
+  ObILibCacheNode *node = NULL;
+  if (OB_LIKELY(is_inited_)) {
+    node = ATOMIC_LOAD(&get_slot_(hash));
+    if (NULL != node
+        && (OB_ISNULL(node->get_cache_key()) || !(*node->get_cache_key() == key))) {
+      node = NULL;
+    }
+  }
+  return node;
+}
+
+void ObLCNodeHotCache::put(const uint64_t hash, ObILibCacheNode *node)
+{
+  if (OB_LIKELY(is_inited_) && NULL != node && NULL != node->get_cache_key()) {
+    ObILibCacheNode *&slot = get_slot_(hash);
+    if (ATOMIC_LOAD(&slot) != node) {
+      ATOMIC_STORE(&slot, node);
+    }
+  }
+}
+
+bool ObLCNodeHotCache::is_used_after_erase_()
+{
+  // orders the load after the erase from the map: a reader which marks the hot cache
+  // used after the load finds the map without the erased nodes
+  MEM_BARRIER();
+  return ATOMIC_LOAD(&is_used_);
+}
+
+void ObLCNodeHotCache::purge(ObILibCacheNode *node)
+{
+  if (OB_LIKELY(is_inited_) && NULL != node && is_used_after_erase_()) {
+    bool purged = false;
+    // wait for the readers which got node from the map before it was erased,
+    // they may still put it into the slots
+    WaitQuiescent(qsync_);
+    for (int64_t i = 0; i < bucket_cnt_; i++) {
+      for (int64_t j = 0; j < SLOT_CNT_PER_CPU; j++) {
+        if (ATOMIC_BCAS(&buckets_[i].slots_[j], node, NULL)) {
+          purged = true;
+        }
+      }
+    }
+    if (purged) {
+      // wait for the readers which got node from the slots
+      WaitQuiescent(qsync_);
+    }
+  }
+}
+
+void ObLCNodeHotCache::purge(const ObIArray<ObILibCacheNode *> &nodes)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObILibCacheNode *, 64> sorted_nodes;
+  if (OB_UNLIKELY(!is_inited_) || nodes.empty() || !is_used_after_erase_()) {
+  } else if (OB_FAIL(sorted_nodes.assign(nodes))) {
+    LOG_WARN("failed to copy nodes, purge them one by one", K(ret), K(nodes.count()));
+    for (int64_t i = 0; i < nodes.count(); i++) {
+      purge(nodes.at(i));
+    }
+  } else {
+    bool purged = false;
+    std::sort(sorted_nodes.begin(), sorted_nodes.end());
+    WaitQuiescent(qsync_);
+    for (int64_t i = 0; i < bucket_cnt_; i++) {
+      for (int64_t j = 0; j < SLOT_CNT_PER_CPU; j++) {
+        ObILibCacheNode *node = ATOMIC_LOAD(&buckets_[i].slots_[j]);
+        if (NULL != node && std::binary_search(sorted_nodes.begin(), sorted_nodes.end(), node)
+            && ATOMIC_BCAS(&buckets_[i].slots_[j], node, NULL)) {
+          purged = true;
+        }
+      }
+    }
+    if (purged) {
+      WaitQuiescent(qsync_);
+    }
+  }
+}
+
+} // namespace sql
+} // namespace oceanbase
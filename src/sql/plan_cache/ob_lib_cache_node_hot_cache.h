@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_SQL_PLAN_CACHE_OB_LIB_CACHE_NODE_HOT_CACHE_
+#define OCEANBASE_SQL_PLAN_CACHE_OB_LIB_CACHE_NODE_HOT_CACHE_
+
+#include "lib/allocator/ob_qsync.h"
+#include "lib/container/ob_iarray.h"
+#include "sql/plan_cache/ob_i_lib_cache_key.h"
+#include "sql/plan_cache/ob_i_lib_cache_node.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+// A small per cpu cache of the recently hit lib cache nodes, a hot statement finds its
+// node here without the bucket latch of CacheKeyNodeMap and the reference count of the node.
+//
+// Nodes got from the hot cache are protected by qsync instead of the reference count:
+// 1. get() and put() must be called in the critical section of get_qsync(), and the
+//    node got can only be used until the critical section is left;
+// 2. put() is only called when the caller holds a reference of the node;
+// 3. after a node is erased from CacheKeyNodeMap, purge() must be called before the
+//    reference held by the map is released, the nodes erased together should be
+//    purged by one call, which waits for the readers only twice.
+// Readers call mark_used() in the critical section before they look up the map, purge()
+// does not wait for the readers at all until the hot cache is used, and does not wait for
+// them the second time if none of the nodes is in the slots.
+class ObLCNodeHotCache
+{
+public:
+  static const int64_t SLOT_CNT_PER_CPU = 16;
+  ObLCNodeHotCache();
+  ~ObLCNodeHotCache();
+  int init(const uint64_t tenant_id);
+  void destroy();
+  common::ObQSync &get_qsync() { return qsync_; }
+  void mark_used()
+  {
+    if (OB_UNLIKELY(!ATOMIC_LOAD(&is_used_))) {
+      ATOMIC_STORE(&is_used_, true);
+    }
+  }
+  ObILibCacheNode *get(const ObILibCacheKey &key, const uint64_t hash);
+  void put(const uint64_t hash, ObILibCacheNode *node);
+  void purge(ObILibCacheNode *node);
+  void purge(const common::ObIArray<ObILibCacheNode *> &nodes);
+private:
+  bool is_used_after_erase_();
+  struct Bucket
+  {
+    Bucket() { MEMSET(slots_, 0, sizeof(slots_)); }
+    ObILibCacheNode *slots_[SLOT_CNT_PER_CPU];
+  } CACHE_ALIGNED;
+  ObILibCacheNode *&get_slot_(const uint64_t hash)
+  {
+    return buckets_[common::icpu_id() % bucket_cnt_].slots_[hash % SLOT_CNT_PER_CPU];
+  }
+private:
+  bool is_inited_;
+  Bucket *buckets_;
+  int64_t bucket_cnt_;
+  // never reset, the readers of the hot cache may be in the critical section once it is set
+  bool is_used_;
+  common::ObQSync qsync_;
+  DISALLOW_COPY_AND_ASSIGN(ObLCNodeHotCache);
+};
+
+} // namespace sql
+} // namespace oceanbase
+
+#endif // OCEANBASE_SQL_PLAN_CACHE_OB_LIB_CACHE_NODE_HOT_CACHE_
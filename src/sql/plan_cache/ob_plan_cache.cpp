@@ -366,6 +366,8 @@ int ObPlanCache::init(int64_t hash_bucket, common::ObAddr addr,
                                                   ObModIds::OB_HASH_NODE_PLAN_CACHE,
                                                   tenant_id))) {
       SQL_PC_LOG(WARN, "failed to init PlanCache", K(ret));
+    } else if (OB_FAIL(hot_node_cache_.init(tenant_id))) {
+      SQL_PC_LOG(WARN, "failed to init hot node cache", K(ret));
     } else {
       cn_factory_.set_lib_cache(this);
       ObMemAttr attr = get_mem_attr();
@@ -830,6 +832,8 @@ int ObPlanCache::add_cache_obj(ObILibCacheCtx &ctx,
                                             static_cast<ObILibCacheKey&>(*key)))) {
       cache_node->dec_ref_count(LC_NODE_HANDLE);//cache node dec ref in alloc
       SQL_PC_LOG(WARN, "failed to deep copy cache key", K(ret), KPC(key));
+    } else {
+      cache_node->set_cache_key(cache_key);
     }
     if (OB_SUCC(ret)) {
       cache_node->inc_ref_count(LC_NODE_HANDLE); //inc ref count in block
@@ -877,6 +881,8 @@ int ObPlanCache::add_cache_obj(ObILibCacheCtx &ctx,
             LOG_WARN("unexpected error", K(ret), K(tmp_ret), K(del_node), K(cache_node));
           } else {
             cache_node->unlock();
+            // readers may have found the node in the map and put it to the hot cache
+            hot_node_cache_.purge(cache_node);
             cache_node->dec_ref_count(LC_NODE_HANDLE); //cache node dec ref in block
             cache_node->dec_ref_count(LC_NODE_HANDLE); //cache node dec ref in alloc
           }
@@ -910,23 +916,55 @@ int ObPlanCache::add_cache_obj(ObILibCacheCtx &ctx,
 int ObPlanCache::get_cache_obj(ObILibCacheCtx &ctx,
                                ObILibCacheKey *key,
                                ObCacheObjGuard &guard)
+{
+  int ret = OB_SUCCESS;
+  if (GCONF._enable_plan_cache_hot_node_cache) {
+    // the node found in the hot node cache is protected by the critical section
+    // instead of its reference count
+    CriticalGuard(hot_node_cache_.get_qsync());
+    hot_node_cache_.mark_used();
+    ret = inner_get_cache_obj(ctx, key, guard, true/*enable_hot_cache*/);
+  } else {
+    ret = inner_get_cache_obj(ctx, key, guard, false/*enable_hot_cache*/);
+  }
+  return ret;
+}
+
+int ObPlanCache::inner_get_cache_obj(ObILibCacheCtx &ctx,
+                                     ObILibCacheKey *key,
+                                     ObCacheObjGuard &guard,
+                                     const bool enable_hot_cache)
 {
   int ret = OB_SUCCESS;
   ObILibCacheNode *cache_node = NULL;
   ObILibCacheObject *cache_obj = NULL;
   // get the read lock and increase reference count
   ObLibCacheRlockAndRef r_ref_lock(LC_NODE_RD_HANDLE);
+  bool from_hot_cache = false;
+  uint64_t hash = 0;
   if (OB_ISNULL(key)) {
     ret = OB_INVALID_ARGUMENT;
     SQL_PC_LOG(WARN, "invalid null argument", K(ret), K(key));
+  } else if (enable_hot_cache
+             && OB_NOT_NULL(cache_node = hot_node_cache_.get(*key, hash = key->hash()))) {
+    if (OB_FAIL(cache_node->lock(true/*rlock*/))) {
+      cache_node = NULL;
+      ret = OB_ERR_UNEXPECTED;
+      SQL_PC_LOG(DEBUG, "failed to lock cache node from hot cache", K(ret));
+    } else {
+      from_hot_cache = true;
+    }
   } else if (OB_FAIL(get_value(key, cache_node, r_ref_lock /*read locked*/))) {
     ret = OB_ERR_UNEXPECTED;
     SQL_PC_LOG(DEBUG, "failed to get cache node from lib cache by key", K(ret));
   } else if (OB_UNLIKELY(NULL == cache_node)) {
     ret = OB_SQL_PC_NOT_EXIST;
     SQL_PC_LOG(DEBUG, "cache obj does not exist!", K(key));
-  } else {
-    LOG_DEBUG("inner_get_cache_obj", K(key), K(cache_node));
+  } else if (enable_hot_cache) {
+    hot_node_cache_.put(hash, cache_node);
+  }
+  if (OB_SUCC(ret) && NULL != cache_node) {
+    LOG_DEBUG("inner_get_cache_obj", K(key), K(cache_node), K(from_hot_cache));
     if (OB_FAIL(cache_node->update_node_stat(ctx))) {
       SQL_PC_LOG(WARN, "failed to update node stat",  K(ret));
     } else if (OB_FAIL(cache_node->get_cache_obj(ctx, key, cache_obj))) {
@@ -939,7 +977,9 @@ int ObPlanCache::get_cache_obj(ObILibCacheCtx &ctx,
     }
     // release lock whatever
     (void)cache_node->unlock();
-    (void)cache_node->dec_ref_count(LC_NODE_RD_HANDLE);
+    if (!from_hot_cache) {
+      (void)cache_node->dec_ref_count(LC_NODE_RD_HANDLE);
+    }
     NG_TRACE(pc_choose_plan);
   }
 
@@ -1262,12 +1302,32 @@ int ObPlanCache::batch_remove_cache_node(const LCKeyValueArray &to_evict)
 {
   int ret = OB_SUCCESS;
   int64_t N = to_evict.count();
+  ObSEArray<ObILibCacheNode *, 64> del_nodes;
   SQL_PC_LOG(INFO, "actual evict number", "evict_value_num", to_evict.count());
   for (int64_t i = 0; OB_SUCC(ret) && i < N; ++i) {
-    if (OB_FAIL(remove_cache_node(to_evict.at(i).key_))) {
-      SQL_PC_LOG(WARN, "failed to remove cache node from lib cache", K(ret));
+    ObILibCacheNode *del_node = NULL;
+    int hash_err = cache_key_node_map_.erase_refactored(to_evict.at(i).key_, &del_node);
+    if (OB_SUCCESS == hash_err) {
+      if (NULL == del_node) {
+        ret = OB_ERR_UNEXPECTED;
+        SQL_PC_LOG(ERROR, "pcv_set should not be null", K(to_evict.at(i).key_));
+      } else if (OB_FAIL(del_nodes.push_back(del_node))) {
+        SQL_PC_LOG(WARN, "failed to push back node", K(ret));
+        hot_node_cache_.purge(del_node);
+        del_node->dec_ref_count(LC_NODE_HANDLE);
+      }
+    } else if (OB_HASH_NOT_EXIST == hash_err) {
+      SQL_PC_LOG(INFO, "plan cache key is alreay be deleted", K(to_evict.at(i).key_));
+    } else {
+      ret = hash_err;
+      SQL_PC_LOG(WARN, "failed to erase pcv_set from plan cache by key", K(to_evict.at(i).key_), K(hash_err));
     }
   }
+  // the erased nodes are released whatever, and the readers are waited only once
+  hot_node_cache_.purge(del_nodes);
+  for (int64_t i = 0; i < del_nodes.count(); ++i) {
+    del_nodes.at(i)->dec_ref_count(LC_NODE_HANDLE);
+  }
   return ret;
 }
 
@@ -1279,6 +1339,7 @@ int ObPlanCache::remove_cache_node(ObILibCacheKey *key)
   hash_err = cache_key_node_map_.erase_refactored(key, &del_node);
   if (OB_SUCCESS == hash_err) {
     if (NULL != del_node) {
+      hot_node_cache_.purge(del_node);
       del_node->dec_ref_count(LC_NODE_HANDLE);
     } else {
       ret = OB_ERR_UNEXPECTED;
@@ -23,6 +23,7 @@
 #include "sql/plan_cache/ob_pc_ref_handle.h"
 #include "sql/plan_cache/ob_lib_cache_key_creator.h"
 #include "sql/plan_cache/ob_lib_cache_node_factory.h"
+#include "sql/plan_cache/ob_lib_cache_node_hot_cache.h"
 #include "sql/plan_cache/ob_lib_cache_object_manager.h"
 
 namespace oceanbase
@@ -344,6 +345,10 @@ private:
   bool calc_evict_num(int64_t &plan_cache_evict_num);
   int remove_cache_node(ObILibCacheKey *key);
   int batch_remove_cache_node(const LCKeyValueArray &to_evict);
+  int inner_get_cache_obj(ObILibCacheCtx &ctx,
+                          ObILibCacheKey *key,
+                          ObCacheObjGuard &guard,
+                          const bool enable_hot_cache);
   bool is_reach_memory_limit() { return get_mem_hold() > get_mem_limit(); }
   int construct_plan_cache_key(ObPlanCacheCtx &plan_ctx, ObLibCacheNameSpace ns);
   static int construct_plan_cache_key(ObSQLSessionInfo &session,
@@ -387,6 +392,7 @@ private:
   ObLCObjectManager co_mgr_;
   ObLCNodeFactory cn_factory_;
   CacheKeyNodeMap cache_key_node_map_;
+  ObLCNodeHotCache hot_node_cache_;
 };
 
 template<typename _callback>
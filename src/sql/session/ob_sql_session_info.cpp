@@ -2284,6 +2284,7 @@ void ObSQLSessionInfo::ObCachedTenantConfigInfo::refresh()
     if (OB_LIKELY(tenant_config.is_valid())) {
       // 2.是否允许 batch_multi_statement
       enable_batched_multi_statement_ = tenant_config->ob_enable_batched_multi_statement;
+      enable_ins_multi_values_batch_opt_ = tenant_config->_enable_ins_multi_values_batch_opt;
       // 3.是否允许bloom_filter
       if (tenant_config->_bloom_filter_enabled) {
         enable_bloom_filter_ = true;
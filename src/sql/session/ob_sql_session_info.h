@@ -461,6 +461,7 @@ public:
     ObCachedTenantConfigInfo(ObSQLSessionInfo *session) :
                                  is_external_consistent_(false),
                                  enable_batched_multi_statement_(false),
+                                 enable_ins_multi_values_batch_opt_(false),
                                  enable_sql_extension_(false),
                                  saved_tenant_info_(0),
                                  enable_bloom_filter_(true),
@@ -474,6 +475,7 @@ public:
     void refresh();
     bool get_is_external_consistent() const { return is_external_consistent_; }
     bool get_enable_batched_multi_statement() const { return enable_batched_multi_statement_; }
+    bool get_enable_ins_multi_values_batch_opt() const { return enable_ins_multi_values_batch_opt_; }
     bool get_enable_bloom_filter() const { return enable_bloom_filter_; }
     bool get_enable_sql_extension() const { return enable_sql_extension_; }
     ObAuditTrailType get_at_type() const { return at_type_; }
@@ -482,6 +484,7 @@ public:
     //租户级别配置项缓存session 上，避免每次获取都需要刷新
     bool is_external_consistent_;
     bool enable_batched_multi_statement_;
+    bool enable_ins_multi_values_batch_opt_;
     bool enable_sql_extension_;
     uint64_t saved_tenant_info_;
     bool enable_bloom_filter_;
@@ -892,6 +895,13 @@ public:
     cached_tenant_config_info_.refresh();
     return cached_tenant_config_info_.get_enable_batched_multi_statement();
   }
+  // a multi-row insert can be executed as batched single row inserts
+  bool is_enable_ins_multi_values_batch_opt()
+  {
+    cached_tenant_config_info_.refresh();
+    return cached_tenant_config_info_.get_enable_batched_multi_statement()
+           || cached_tenant_config_info_.get_enable_ins_multi_values_batch_opt();
+  }
   bool is_enable_bloom_filter()
   {
     cached_tenant_config_info_.refresh();
@@ -461,7 +461,7 @@ int ObBackupDataCtx::write_backup_file_header(const ObBackupFileHeader &file_hea
 }
 
 int ObBackupDataCtx::write_macro_block_data(const blocksstable::ObBufferReader &buffer,
-    const common::ObLogicMacroBlockId &logic_id, ObBackupMacroBlockIndex &macro_index)
+    const common::ObLogicMacroBlockId &logic_id, const int64_t data_checksum, ObBackupMacroBlockIndex &macro_index)
 {
   int ret = OB_SUCCESS;
   macro_index.reset();
@@ -473,6 +473,7 @@ int ObBackupDataCtx::write_macro_block_data(const blocksstable::ObBufferReader &
     LOG_WARN("get invalid args", K(ret), K(buffer), K(logic_id));
   } else if (OB_FAIL(write_macro_block_data_(buffer, logic_id, macro_index))) {
     LOG_WARN("failed to write macro block data", K(ret), K(buffer), K(logic_id));
+  } else if (FALSE_IT(macro_index.data_checksum_ = data_checksum)) {
   } else if (OB_FAIL(append_macro_block_index_(macro_index))) {
     LOG_WARN("failed to append macro block index", K(ret), K(macro_index));
   } else {
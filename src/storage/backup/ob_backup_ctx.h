@@ -169,7 +169,7 @@ public:
       common::ObInOutBandwidthThrottle &bandwidth_throttle);
   int write_backup_file_header(const ObBackupFileHeader &file_header);
   int write_macro_block_data(const blocksstable::ObBufferReader &macro_data,
-      const common::ObLogicMacroBlockId &logic_id, ObBackupMacroBlockIndex &macro_index);
+      const common::ObLogicMacroBlockId &logic_id, const int64_t data_checksum, ObBackupMacroBlockIndex &macro_index);
   int write_meta_data(const blocksstable::ObBufferReader &meta_data, const common::ObTabletID &tablet_id,
       const ObBackupMetaType &meta_type, ObBackupMetaIndex &meta_index);
   int close();
@@ -256,7 +256,7 @@ int ObBackupDataFileTrailer::check_valid() const
 
 /* ObBackupMacroBlockId */
 
-ObBackupMacroBlockId::ObBackupMacroBlockId() : logic_id_(), macro_block_id_()
+ObBackupMacroBlockId::ObBackupMacroBlockId() : logic_id_(), macro_block_id_(), data_checksum_(0)
 {}
 
 bool ObBackupMacroBlockId::is_valid()
@@ -268,6 +268,7 @@ void ObBackupMacroBlockId::reset()
 {
   logic_id_.reset();
   macro_block_id_.reset();
+  data_checksum_ = 0;
 }
 
 /* ObBackupPhysicalID */
@@ -391,10 +392,19 @@ DEFINE_GET_SERIALIZE_SIZE(ObBackupPhysicalID)
 /* ObBackupMacroBlockIndex */
 
 OB_SERIALIZE_MEMBER(
-    ObBackupMacroBlockIndex, logic_id_, backup_set_id_, ls_id_, turn_id_, retry_id_, file_id_, offset_, length_);
+    ObBackupMacroBlockIndex, logic_id_, backup_set_id_, ls_id_, turn_id_, retry_id_, file_id_, offset_, length_,
+    data_checksum_);
 
 ObBackupMacroBlockIndex::ObBackupMacroBlockIndex()
-    : logic_id_(), backup_set_id_(0), ls_id_(0), turn_id_(0), retry_id_(0), file_id_(0), offset_(0), length_(0)
+    : logic_id_(),
+      backup_set_id_(0),
+      ls_id_(0),
+      turn_id_(0),
+      retry_id_(0),
+      file_id_(0),
+      offset_(0),
+      length_(0),
+      data_checksum_(0)
 {}
 
 void ObBackupMacroBlockIndex::reset()
@@ -407,6 +417,7 @@ void ObBackupMacroBlockIndex::reset()
   file_id_ = 0;
   offset_ = 0;
   length_ = 0;
+  data_checksum_ = 0;
 }
 
 bool ObBackupMacroBlockIndex::is_valid() const
@@ -438,7 +449,19 @@ bool ObBackupMacroBlockIndex::operator==(const ObBackupMacroBlockIndex &other) c
 {
   return logic_id_ == other.logic_id_ && backup_set_id_ == other.backup_set_id_ && ls_id_ == other.ls_id_ &&
          turn_id_ == other.turn_id_ && retry_id_ == other.retry_id_ && file_id_ == other.file_id_ &&
-         offset_ == other.offset_ && length_ == other.length_;
+         offset_ == other.offset_ && length_ == other.length_ && data_checksum_ == other.data_checksum_;
+}
+
+int ObBackupMacroBlockIndex::check_data_checksum(const int64_t data_checksum) const
+{
+  int ret = OB_SUCCESS;
+  if (0 == data_checksum_ || 0 == data_checksum) {
+    // unknown data checksum, the index is written by the older version
+  } else if (data_checksum_ != data_checksum) {
+    ret = OB_CHECKSUM_ERROR;
+    LOG_WARN("data checksum not match", K(ret), K(data_checksum), KPC(this));
+  }
+  return ret;
 }
 
 /* ObBackupMacroRangeIndex */
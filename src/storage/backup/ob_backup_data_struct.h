@@ -185,9 +185,10 @@ struct ObBackupMacroBlockId {
   ObBackupMacroBlockId();
   bool is_valid();
   void reset();
-  TO_STRING_KV(K_(logic_id), K_(macro_block_id));
+  TO_STRING_KV(K_(logic_id), K_(macro_block_id), K_(data_checksum));
   common::ObLogicMacroBlockId logic_id_;
   blocksstable::MacroBlockId macro_block_id_;
+  int64_t data_checksum_;
 };
 
 struct ObBackupMacroBlockIndex;
@@ -262,8 +263,10 @@ public:
   bool is_valid() const;
   int get_backup_physical_id(ObBackupPhysicalID &physical_id) const;
   bool operator==(const ObBackupMacroBlockIndex &other) const;
-  TO_STRING_KV(
-      K_(logic_id), K_(backup_set_id), K_(ls_id), K_(turn_id), K_(retry_id), K_(file_id), K_(offset), K_(length));
+  // OB_CHECKSUM_ERROR if both data checksums are known and differ
+  int check_data_checksum(const int64_t data_checksum) const;
+  TO_STRING_KV(K_(logic_id), K_(backup_set_id), K_(ls_id), K_(turn_id), K_(retry_id), K_(file_id), K_(offset),
+      K_(length), K_(data_checksum));
   common::ObLogicMacroBlockId logic_id_;
   int64_t backup_set_id_;
   share::ObLSID ls_id_;
@@ -272,6 +275,9 @@ public:
   int64_t file_id_;
   int64_t offset_;
   int64_t length_;
+  // data checksum of the macro block, 0 means unknown, which is the case of the
+  // index written by the older version
+  int64_t data_checksum_;
 };
 
 // the index is group by blocks, a index block is typically 16KB in size
@@ -145,6 +145,7 @@ int ObTabletLogicMacroIdReader::get_next_batch(common::ObIArray<ObBackupMacroBlo
         ObBackupMacroBlockId macro_id;
         macro_id.logic_id_ = data_macro_block_meta.get_logic_id();
         macro_id.macro_block_id_ = data_macro_block_meta.get_macro_id();
+        macro_id.data_checksum_ = data_macro_block_meta.get_meta_val().data_checksum_;
         if (OB_FAIL(id_array.push_back(macro_id))) {
           LOG_WARN("failed to push back", K(ret), K(macro_id));
         }
@@ -187,6 +187,19 @@ int ObLSBackupRestoreUtil::read_macro_block_data(const common::ObString &path, c
     LOG_WARN("failed to alloc read buf", K(ret), K(macro_index));
   } else if (OB_FAIL(pread_file(path, storage_info, macro_index.offset_, macro_index.length_, buf))) {
     LOG_WARN("failed to pread buffer", K(ret), K(path), K(macro_index));
+  } else if (OB_FAIL(parse_macro_block_data(path, macro_index, buf, data_buffer))) {
+    LOG_WARN("failed to parse macro block data", K(ret), K(path), K(macro_index));
+  }
+  return ret;
+}
+
+int ObLSBackupRestoreUtil::parse_macro_block_data(const common::ObString &path,
+    const ObBackupMacroBlockIndex &macro_index, char *buf, blocksstable::ObBufferReader &data_buffer)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || !macro_index.is_valid() || !common::is_io_aligned(macro_index.length_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("get invalid args", K(ret), KP(buf), K(macro_index));
   } else {
     blocksstable::ObBufferReader buffer_reader(buf, macro_index.length_);
     const ObBackupCommonHeader *common_header = NULL;
@@ -35,6 +35,10 @@ public:
   static int read_macro_block_data(const common::ObString &path, const share::ObBackupStorageInfo *storage_info,
       const ObBackupMacroBlockIndex &macro_index, const int64_t align_size, common::ObIAllocator &allocator,
       blocksstable::ObBufferReader &data_buffer);
+  // parse the macro block data read from the backup file into buf, which is macro_index.length_ long,
+  // the data is moved to the front of buf after the common header is checked
+  static int parse_macro_block_data(const common::ObString &path, const ObBackupMacroBlockIndex &macro_index,
+      char *buf, blocksstable::ObBufferReader &data_buffer);
   static int pread_file(
       const ObString &path, const share::ObBackupStorageInfo *storage_info, const int64_t offset, const int64_t read_size, char *buf);
 };
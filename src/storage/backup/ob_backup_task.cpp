@@ -2271,6 +2271,10 @@ int ObPrefetchBackupInfoTask::check_backup_item_need_copy_(
           } else {
             LOG_WARN("failed to get macro block index", K(ret), K(item));
           }
+        } else if (OB_FAIL(macro_index.check_data_checksum(item.get_data_checksum()))) {
+          // the macro block of the previous backup set is referenced by logic id, which
+          // must identify the same content, or the restored data would be wrong
+          LOG_ERROR("reused macro block data checksum not match", K(ret), K(macro_index), K(item), K_(param));
         } else {
           LOG_DEBUG("macro block was reused", K(macro_index), K_(param));
           need_copy = false;
@@ -2673,12 +2677,13 @@ int ObLSBackupDataTask::do_backup_macro_block_data_()
         }
       } else if (OB_FAIL(check_macro_block_data_(buffer_reader))) {
         LOG_WARN("failed to check macro block data", K(ret), K(buffer_reader));
-      } else if (OB_FAIL(write_macro_block_data_(buffer_reader, logic_id, macro_index))) {
+      } else if (OB_FAIL(get_backup_item_(logic_id, backup_item))) {
+        LOG_WARN("failed to get backup item", K(ret), K(logic_id));
+      } else if (OB_FAIL(write_macro_block_data_(
+                     buffer_reader, logic_id, backup_item.get_data_checksum(), macro_index))) {
         LOG_WARN("failed to write macro block data", K(ret), K(buffer_reader), K(logic_id));
       } else if (OB_FAIL(macro_index.get_backup_physical_id(physical_id))) {
         LOG_WARN("failed to get backup physical id", K(ret), K(macro_index));
-      } else if (OB_FAIL(get_backup_item_(logic_id, backup_item))) {
-        LOG_WARN("failed to get backup item", K(ret), K(logic_id));
       } else if (OB_FAIL(mark_backup_item_finished_(backup_item, physical_id))) {
         LOG_WARN("failed to mark backup item finished", K(ret), K(backup_item), K(macro_index), K(physical_id));
       } else if (OB_FAIL(ls_backup_ctx_->stat_mgr_.add_macro_block(backup_data_type_, logic_id))) {
@@ -3008,14 +3013,14 @@ int ObLSBackupDataTask::check_macro_block_data_(const ObBufferReader &buffer)
   return ret;
 }
 
-int ObLSBackupDataTask::write_macro_block_data_(
-    const ObBufferReader &data, const common::ObLogicMacroBlockId &logic_id, ObBackupMacroBlockIndex &macro_index)
+int ObLSBackupDataTask::write_macro_block_data_(const ObBufferReader &data,
+    const common::ObLogicMacroBlockId &logic_id, const int64_t data_checksum, ObBackupMacroBlockIndex &macro_index)
 {
   int ret = OB_SUCCESS;
   if (!data.is_valid() || !logic_id.is_valid()) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("get invalid args", K(ret), K(data), K(logic_id));
-  } else if (OB_FAIL(backup_data_ctx_.write_macro_block_data(data, logic_id, macro_index))) {
+  } else if (OB_FAIL(backup_data_ctx_.write_macro_block_data(data, logic_id, data_checksum, macro_index))) {
     LOG_WARN("failed to write macro block data", K(ret), K(data), K(logic_id));
   } else {
     LOG_INFO("write macro block data", K(data), K(logic_id), K(macro_index));
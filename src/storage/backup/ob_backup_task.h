@@ -544,7 +544,7 @@ private:
       common::ObLogicMacroBlockId &logic_id);
   int check_macro_block_data_(const blocksstable::ObBufferReader &data);
   int write_macro_block_data_(const blocksstable::ObBufferReader &data, const common::ObLogicMacroBlockId &logic_id,
-      ObBackupMacroBlockIndex &macro_index);
+      const int64_t data_checksum, ObBackupMacroBlockIndex &macro_index);
   int write_backup_meta_(const blocksstable::ObBufferReader &data, const common::ObTabletID &tablet_id,
       const ObBackupMetaType &meta_type, ObBackupMetaIndex &meta_index);
   int get_tablet_handle_(const common::ObTabletID &tablet_id, storage::ObTabletHandle &tablet_handle);
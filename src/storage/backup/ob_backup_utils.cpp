@@ -1111,7 +1111,7 @@ int ObBackupDiskChecker::check_disk_space()
 /* ObBackupProviderItem */
 
 ObBackupProviderItem::ObBackupProviderItem()
-    : item_type_(PROVIDER_ITEM_MAX), logic_id_(), macro_block_id_(), table_key_(), tablet_id_()
+    : item_type_(PROVIDER_ITEM_MAX), logic_id_(), macro_block_id_(), table_key_(), tablet_id_(), data_checksum_(0)
 {}
 
 ObBackupProviderItem::~ObBackupProviderItem()
@@ -1119,7 +1119,7 @@ ObBackupProviderItem::~ObBackupProviderItem()
 
 int ObBackupProviderItem::set(const ObBackupProviderItemType &item_type, const common::ObLogicMacroBlockId &logic_id,
     const blocksstable::MacroBlockId &macro_block_id, const ObITable::TableKey &table_key,
-    const common::ObTabletID &tablet_id)
+    const common::ObTabletID &tablet_id, const int64_t data_checksum)
 {
   int ret = OB_SUCCESS;
   item_type_ = item_type;
@@ -1127,13 +1127,14 @@ int ObBackupProviderItem::set(const ObBackupProviderItemType &item_type, const c
   macro_block_id_ = macro_block_id;
   table_key_ = table_key;
   tablet_id_ = tablet_id;
+  data_checksum_ = data_checksum;
   return ret;
 }
 
 bool ObBackupProviderItem::operator==(const ObBackupProviderItem &other) const
 {
   return item_type_ == other.item_type_ && logic_id_ == other.logic_id_ && macro_block_id_ == other.macro_block_id_ &&
-         table_key_ == other.table_key_ && tablet_id_ == other.tablet_id_;
+         table_key_ == other.table_key_ && tablet_id_ == other.tablet_id_ && data_checksum_ == other.data_checksum_;
 }
 
 bool ObBackupProviderItem::operator!=(const ObBackupProviderItem &other) const
@@ -1166,6 +1167,11 @@ common::ObTabletID ObBackupProviderItem::get_tablet_id() const
   return tablet_id_;
 }
 
+int64_t ObBackupProviderItem::get_data_checksum() const
+{
+  return data_checksum_;
+}
+
 int64_t ObBackupProviderItem::get_deep_copy_size() const
 {
   return 0;
@@ -1180,6 +1186,7 @@ int ObBackupProviderItem::deep_copy(const ObBackupProviderItem &src, char *buf,
   macro_block_id_ = src.macro_block_id_;
   table_key_ = src.table_key_;
   tablet_id_ = src.tablet_id_;
+  data_checksum_ = src.data_checksum_;
   return ret;
 }
 
@@ -1205,6 +1212,7 @@ void ObBackupProviderItem::reset()
   macro_block_id_.reset();
   table_key_.reset();
   tablet_id_.reset();
+  data_checksum_ = 0;
 }
 
 DEFINE_SERIALIZE(ObBackupProviderItem)
@@ -1220,6 +1228,8 @@ DEFINE_SERIALIZE(ObBackupProviderItem)
     LOG_WARN("failed to serialize table key", K(ret));
   } else if (OB_FAIL(tablet_id_.serialize(buf, buf_len, pos))) {
     LOG_WARN("failed to serialize tablet id", K(ret));
+  } else if (OB_FAIL(serialization::encode_vi64(buf, buf_len, pos, data_checksum_))) {
+    LOG_WARN("failed to encode data checksum", K(ret));
   }
   return ret;
 }
@@ -1238,6 +1248,8 @@ DEFINE_DESERIALIZE(ObBackupProviderItem)
     LOG_WARN("failed to deserialize table key", K(ret));
   } else if (OB_FAIL(tablet_id_.deserialize(buf, data_len, pos))) {
     LOG_WARN("failed to deserialize tablet id", K(ret));
+  } else if (OB_FAIL(serialization::decode_vi64(buf, data_len, pos, &data_checksum_))) {
+    LOG_WARN("failed to decode data checksum", K(ret));
   } else {
     item_type_ = static_cast<ObBackupProviderItemType>(item_type_value);
   }
@@ -1252,6 +1264,7 @@ DEFINE_GET_SERIALIZE_SIZE(ObBackupProviderItem)
   size += macro_block_id_.get_serialize_size();
   size += table_key_.get_serialize_size();
   size += tablet_id_.get_serialize_size();
+  size += serialization::encoded_length_vi64(data_checksum_);
   return size;
 }
 
@@ -1799,8 +1812,8 @@ int ObBackupTabletProvider::add_macro_block_id_item_list_(const common::ObTablet
       LOG_WARN("failed to check macro block need skip", K(ret), K(macro_id));
     } else if (need_skip) {
       // do nothing
-    } else if (OB_FAIL(item.set(
-                   PROVIDER_ITEM_MACRO_ID, macro_id.logic_id_, macro_id.macro_block_id_, table_key, tablet_id))) {
+    } else if (OB_FAIL(item.set(PROVIDER_ITEM_MACRO_ID, macro_id.logic_id_, macro_id.macro_block_id_, table_key,
+                   tablet_id, macro_id.data_checksum_))) {
       LOG_WARN("failed to set item", K(ret), K(macro_id), K(table_key), K(tablet_id));
     } else if (!item.is_valid()) {
       ret = OB_INVALID_DATA;
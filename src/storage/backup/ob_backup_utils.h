@@ -179,7 +179,7 @@ public:
   virtual ~ObBackupProviderItem();
   int set(const ObBackupProviderItemType &item_type, const common::ObLogicMacroBlockId &logic_id,
       const blocksstable::MacroBlockId &macro_block_id, const storage::ObITable::TableKey &table_key,
-      const common::ObTabletID &tablet_id);
+      const common::ObTabletID &tablet_id, const int64_t data_checksum = 0);
   bool operator==(const ObBackupProviderItem &other) const;
   bool operator!=(const ObBackupProviderItem &other) const;
   ObBackupProviderItemType get_item_type() const;
@@ -187,11 +187,12 @@ public:
   blocksstable::MacroBlockId get_macro_block_id() const;
   const storage::ObITable::TableKey &get_table_key() const;
   common::ObTabletID get_tablet_id() const;
+  int64_t get_data_checksum() const;
   int64_t get_deep_copy_size() const;
   int deep_copy(const ObBackupProviderItem &src, char *buf, int64_t len, int64_t &pos);
   bool is_valid() const;
   void reset();
-  TO_STRING_KV(K_(item_type), K_(logic_id), K_(table_key), K_(tablet_id));
+  TO_STRING_KV(K_(item_type), K_(logic_id), K_(table_key), K_(tablet_id), K_(data_checksum));
   NEED_SERIALIZE_AND_DESERIALIZE;
 
 private:
@@ -200,6 +201,7 @@ private:
   blocksstable::MacroBlockId macro_block_id_;
   storage::ObITable::TableKey table_key_;
   common::ObTabletID tablet_id_;  // logic_id_.tablet_id_ may not equal to tablet_id_
+  int64_t data_checksum_;         // data checksum of the macro block, 0 if unknown
 };
 
 class ObBackupProviderItemCompare {
@@ -911,8 +911,10 @@ int ObTmpFile::aio_write(const ObTmpFileIOInfo &io_info, ObTmpFileIOHandle &hand
         //    b. 32KB < size <= 64KB, alloc_size = 64KB;
         //    c. 64KB < size        , alloc_size = size;
         // 2. big file
-        //    a. 32KB < size <= 64KB, alloc_size = 64KB;
-        //    b. 64KB < size        , alloc_size = size;
+        //    a. 32KB < size <= prealloc, alloc_size = prealloc;
+        //    b. prealloc < size        , alloc_size = size;
+        //    the prealloc starts from 64KB and doubles with the extents of the file up to 512KB,
+        //    so that a big file is laid out in long runs of pages, which are read back by fewer ios.
         //
         // NOTE: if the size is more than block size, it will be split into
         // multiple allocation.
@@ -1075,7 +1077,13 @@ int64_t ObTmpFile::small_file_prealloc_size()
 
 int64_t ObTmpFile::big_file_prealloc_size()
 {
-  return BIG_FILE_PREALLOC_EXTENT_SIZE * ObTmpMacroBlock::get_default_page_size();
+  const int64_t max_page_nums = MAX_BIG_FILE_PREALLOC_EXTENT_SIZE;
+  int64_t page_nums = BIG_FILE_PREALLOC_EXTENT_SIZE;
+  ObTmpFileExtent *tmp = file_meta_.get_last_extent();
+  if (is_big_ && NULL != tmp) {
+    page_nums = std::min(max_page_nums, std::max(page_nums, 2L * tmp->get_page_nums()));
+  }
+  return page_nums * ObTmpMacroBlock::get_default_page_size();
 }
 
 
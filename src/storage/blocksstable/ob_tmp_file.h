@@ -273,9 +273,11 @@ private:
 private:
   // NOTE:
   // 1.The pre-allocated macro should satisfy the following inequality:
-  //      SMALL_FILE_MAX_THRESHOLD < BIG_FILE_PREALLOC_EXTENT_SIZE < block size
+  //      SMALL_FILE_MAX_THRESHOLD < BIG_FILE_PREALLOC_EXTENT_SIZE
+  //        <= MAX_BIG_FILE_PREALLOC_EXTENT_SIZE < block size
   static const int64_t SMALL_FILE_MAX_THRESHOLD = 4;
   static const int64_t BIG_FILE_PREALLOC_EXTENT_SIZE = 8;
+  static const int64_t MAX_BIG_FILE_PREALLOC_EXTENT_SIZE = 64;
   static const int64_t READ_SIZE_PER_BATCH = 8 * 1024 * 1024; // 8MB
 
   ObTmpFileMeta file_meta_;
@@ -893,7 +893,7 @@ int ObTmpTenantMemBlockManager::wash(const uint64_t tenant_id, int64_t block_num
   if (OB_UNLIKELY(!is_inited_)) {
     ret = OB_NOT_INIT;
     STORAGE_LOG(WARN, "ObTmpBlockCache has not been inited", K(ret));
-  } else if (OB_FAIL(wait_write_io_finish())) {
+  } else if (OB_FAIL(wait_write_io_finish_if_full())) {
     STORAGE_LOG(WARN, "fail to wait previous write io", K(ret));
   } else {
     while (OB_SUCC(ret) && block_nums--) {
@@ -988,7 +988,7 @@ int ObTmpTenantMemBlockManager::wash(const uint64_t tenant_id, ObTmpMacroBlock *
   if (OB_UNLIKELY(!is_inited_)) {
     ret = OB_NOT_INIT;
     STORAGE_LOG(WARN, "ObTmpBlockCache has not been inited", K(ret));
-  } else if (OB_FAIL(wait_write_io_finish())) {
+  } else if (OB_FAIL(wait_write_io_finish_if_full())) {
     STORAGE_LOG(WARN, "fail to wait previous write io", K(ret));
   } else if (wash_block->is_disked()) {
     // nothing to do
@@ -1076,6 +1076,22 @@ int ObTmpTenantMemBlockManager::wait_write_io_finish()
   return ret;
 }
 
+int ObTmpTenantMemBlockManager::wait_write_io_finish_if_full()
+{
+  int ret = OB_SUCCESS;
+  if (write_handles_.count() >= MAX_WASH_WRITE_IO_NUM && OB_FAIL(wait_write_io_finish())) {
+    STORAGE_LOG(WARN, "fail to wait previous write io", K(ret), K(write_handles_.count()));
+  }
+  return ret;
+}
+
+bool ObTmpTenantMemBlockManager::check_need_wait_write(const ObTmpMacroBlock &t_mblk) const
+{
+  // the write io of a washed block is only reset after waited
+  return write_handles_.count() > 0
+      && !const_cast<ObTmpMacroBlock &>(t_mblk).get_macro_block_handle().get_io_handle().is_empty();
+}
+
 int ObTmpTenantMemBlockManager::write_io(
     const ObTmpBlockIOInfo &io_info,
     const ObTmpFileMacroBlockHeader &tmp_block_header,
@@ -269,6 +269,7 @@ public:
   int add_macro_block(const uint64_t tenant_id, ObTmpMacroBlock *&t_mblk);
   int wait_write_io_finish();
   OB_INLINE bool check_need_wait_write() { return write_handles_.count() > 0; }
+  bool check_need_wait_write(const ObTmpMacroBlock &t_mblk) const;
   int free_extent(const int64_t free_page_nums, const ObTmpMacroBlock *t_mblk);
 
 private:
@@ -283,6 +284,7 @@ private:
       const ObTmpFileMacroBlockHeader &tmp_block_header,
       ObMacroBlockHandle &handle);
   int refresh_dir_to_blk_map(const int64_t dir_id, const ObTmpMacroBlock *t_mblk);
+  int wait_write_io_finish_if_full();
   int64_t get_tenant_mem_block_num();
 
 private:
@@ -291,11 +293,13 @@ private:
   static const uint64_t DEFAULT_BUCKET_NUM = 1543L;
   static const uint64_t MBLK_HASH_BUCKET_NUM = 10243L;
   static const int64_t TENANT_MEM_BLOCK_NUM = 64L;
+  // the washed blocks are written back asynchronously, and only waited when so many are in flight.
+  static const int64_t MAX_WASH_WRITE_IO_NUM = 8L;
   typedef common::hash::ObHashMap<int64_t, ObTmpMacroBlock*, common::hash::SpinReadWriteDefendMode>
       TmpMacroBlockMap;
   typedef common::hash::ObHashMap<int64_t, int64_t, common::hash::SpinReadWriteDefendMode> Map;
 
-  common::ObSEArray<ObMacroBlockHandle*, 1> write_handles_;
+  common::ObSEArray<ObMacroBlockHandle*, MAX_WASH_WRITE_IO_NUM> write_handles_;
   TmpMacroBlockMap t_mblk_map_;  // <block id, tmp macro block>
   Map dir_to_blk_map_;           // <dir id, block id>
   int64_t free_page_nums_;
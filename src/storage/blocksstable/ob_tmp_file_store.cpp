@@ -1238,7 +1238,7 @@ int ObTmpTenantFileStore::read_page(ObTmpMacroBlock *block, ObTmpBlockIOInfo &io
 
     if (OB_SUCC(ret)) {
       // guarantee read io after the finished write.
-      if (OB_FAIL(wait_write_io_finish_if_need())) {
+      if (OB_FAIL(wait_write_io_finish_if_need(*block))) {
         STORAGE_LOG(WARN, "fail to wait previous write io", K(ret));
       } else {
         if (page_io_infos->count() > DEFAULT_PAGE_IO_MERGE_RATIO * page_nums) {
@@ -1292,12 +1292,13 @@ int ObTmpTenantFileStore::read_page(ObTmpMacroBlock *block, ObTmpBlockIOInfo &io
   return ret;
 }
 
-int ObTmpTenantFileStore::wait_write_io_finish_if_need()
+int ObTmpTenantFileStore::wait_write_io_finish_if_need(const ObTmpMacroBlock &block)
 {
-  // guarantee read io after the finished write.
+  // guarantee read io after the finished write of the block, the writes of other blocks
+  // are left in flight.
   int ret = OB_SUCCESS;
   SpinWLockGuard guard(lock_);
-  if (tmp_mem_block_manager_.check_need_wait_write()) {
+  if (tmp_mem_block_manager_.check_need_wait_write(block)) {
     if (OB_FAIL(tmp_mem_block_manager_.wait_write_io_finish())) {
       STORAGE_LOG(WARN, "fail to wait previous write io", K(ret));
     }
@@ -259,7 +259,7 @@ private:
   int free_extent(const int64_t block_id, const int32_t start_page_id, const int32_t page_nums);
   int free_macro_block(ObTmpMacroBlock *&t_mblk);
   int alloc_macro_block(const int64_t dir_id, const uint64_t tenant_id, ObTmpMacroBlock *&t_mblk);
-  int wait_write_io_finish_if_need();
+  int wait_write_io_finish_if_need(const ObTmpMacroBlock &block);
 
 private:
   static const uint64_t TOTAL_LIMIT = 15 * 1024L * 1024L * 1024L;
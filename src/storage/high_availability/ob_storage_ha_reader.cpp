@@ -365,7 +365,13 @@ ObCopyMacroBlockRestoreReader::ObCopyMacroBlockRestoreReader()
     allocator_("CMBReReader"),
     macro_block_index_(0),
     macro_block_count_(0),
-    data_size_(0)
+    data_size_(0),
+    prefetch_buf_(nullptr),
+    prefetch_buf_size_(0),
+    prefetch_offset_(0),
+    prefetch_path_(),
+    prefetch_index_list_(),
+    prefetch_index_pos_(0)
 {
 }
 
@@ -385,15 +391,16 @@ int ObCopyMacroBlockRestoreReader::init(
   } else if (!param.is_valid() || !param.is_leader_restore_) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid args", K(ret), K(param));
-  } else if (OB_FAIL(alloc_buffers())) {
-    LOG_WARN("failed to alloc buffers", K(ret));
   } else {
     table_key_ = param.table_key_;
     copy_macro_range_info_ = param.copy_macro_range_info_;
     restore_base_info_ = param.restore_base_info_;
     second_meta_index_store_ = param.second_meta_index_store_;
     restore_macro_block_id_mgr_ = param.restore_macro_block_id_mgr_;
-    if (OB_FAIL(restore_macro_block_id_mgr_->get_block_id_index(copy_macro_range_info_->start_macro_block_id_, macro_block_index_))) {
+    allocator_.set_attr(ObMemAttr(param.tenant_id_, "CMBReReader"));
+    if (OB_FAIL(alloc_buffers())) {
+      LOG_WARN("failed to alloc buffers", K(ret));
+    } else if (OB_FAIL(restore_macro_block_id_mgr_->get_block_id_index(copy_macro_range_info_->start_macro_block_id_, macro_block_index_))) {
       LOG_WARN("failed to get block id index", K(ret), KPC(copy_macro_range_info_));
     } else {
       macro_block_count_ = 0;
@@ -409,11 +416,16 @@ int ObCopyMacroBlockRestoreReader::alloc_buffers()
   char *buf = NULL;
 
   // used in init() func, should not check is_inited_
-  if (NULL == (buf = reinterpret_cast<char*>(allocator_.alloc(OB_DEFAULT_MACRO_BLOCK_SIZE)))) {
+  // the prefetch buffer is not larger than the macro blocks of the range
+  const int64_t prefetch_block_count = MAX(1, MIN(MAX_PREFETCH_MACRO_BLOCK_COUNT,
+      copy_macro_range_info_->macro_block_count_));
+  const int64_t buf_size = prefetch_block_count * (OB_DEFAULT_MACRO_BLOCK_SIZE + DIO_READ_ALIGN_SIZE);
+  if (NULL == (buf = reinterpret_cast<char*>(allocator_.alloc(buf_size)))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
-    LOG_WARN("failed to alloc buf", K(ret));
+    LOG_WARN("failed to alloc buf", K(ret), K(buf_size));
   } else {
-    data_buffer_.assign(buf, OB_DEFAULT_MACRO_BLOCK_SIZE);
+    prefetch_buf_ = buf;
+    prefetch_buf_size_ = buf_size;
   }
   return ret;
 }
@@ -440,46 +452,29 @@ int ObCopyMacroBlockRestoreReader::get_next_macro_block(
     LOG_WARN("not inited", K(ret));
   } else if (macro_block_count_ == copy_macro_range_info_->macro_block_count_) {
     ret = OB_ITER_END;
+  } else if (OB_FAIL(prefetch_macro_blocks_if_need())) {
+    LOG_WARN("failed to prefetch macro blocks", K(ret), K_(macro_block_index), K(table_key_));
   } else {
-    ObLogicMacroBlockId logic_block_id;
-    backup::ObBackupPhysicalID physic_block_id;
-    share::ObBackupDataType data_type;
-    share::ObBackupPath backup_path;
-    const int64_t align_size = DIO_READ_ALIGN_SIZE;
-    backup::ObBackupMacroBlockIndex macro_index;
-    share::ObBackupStorageInfo storage_info;
-    share::ObRestoreBackupSetBriefInfo backup_set_brief_info;
-    share::ObBackupDest backup_set_dest;
-    if (OB_FAIL(restore_macro_block_id_mgr_->get_macro_block_id(macro_block_index_, logic_block_id, physic_block_id))) {
-      LOG_WARN("failed to get macro block id", K(ret), K(macro_block_index_), K(table_key_), KPC(restore_base_info_));
-    } else if (OB_FAIL(physic_block_id.get_backup_macro_block_index(logic_block_id, macro_index))) {
-      LOG_WARN("failed to get backup macro block index", K(ret), K(logic_block_id), K(physic_block_id));
-    } else if (OB_FAIL(ObRestoreUtils::get_backup_data_type(table_key_, data_type))) {
-      LOG_WARN("fail to get backup data type", K(ret), K(table_key_));
-    } else if (OB_FAIL(restore_base_info_->get_restore_backup_set_dest(macro_index.backup_set_id_, backup_set_brief_info))) {
-      LOG_WARN("fail to get backup set dest", K(ret), K(macro_index));
-    } else if (OB_FAIL(backup_set_dest.set(backup_set_brief_info.backup_set_path_))) {
-      LOG_WARN("fail to set backup set dest", K(ret));
-    } else if (OB_FAIL(share::ObBackupPathUtil::get_macro_block_backup_path(backup_set_dest, macro_index.ls_id_,
-        data_type, macro_index.turn_id_, macro_index.retry_id_, macro_index.file_id_, backup_path))) {
-      LOG_WARN("failed to get macro block index", K(ret), K(restore_base_info_), K(macro_index), KPC(restore_base_info_));
-    } else if (OB_FAIL(backup::ObLSBackupRestoreUtil::read_macro_block_data(backup_path.get_obstr(),
-        restore_base_info_->backup_dest_.get_storage_info(), macro_index, align_size, allocator_, data_buffer_))) {
-      LOG_WARN("failed to read macro block data", K(ret), K(table_key_), K(macro_index), K(physic_block_id), KPC(restore_base_info_));
+    const backup::ObBackupMacroBlockIndex &macro_index = prefetch_index_list_.at(prefetch_index_pos_);
+    char *buf = prefetch_buf_ + (macro_index.offset_ - prefetch_offset_);
+    if (OB_FAIL(backup::ObLSBackupRestoreUtil::parse_macro_block_data(
+        prefetch_path_.get_obstr(), macro_index, buf, data_buffer_))) {
+      LOG_WARN("failed to parse macro block data", K(ret), K(table_key_), K(macro_index), K_(prefetch_path));
     } else {
       data_size_ += data_buffer_.length();
       data.assign(data_buffer_.data(), data_buffer_.length(), data_buffer_.length());
       header.is_reuse_macro_block_ = false;
       header.occupy_size_ = data_buffer_.length();
 
+      prefetch_index_pos_++;
       macro_block_count_++;
       macro_block_index_++;
       if (macro_block_count_ == copy_macro_range_info_->macro_block_count_) {
-        if (logic_block_id != copy_macro_range_info_->end_macro_block_id_) {
+        if (macro_index.logic_id_ != copy_macro_range_info_->end_macro_block_id_) {
           ret = OB_ERR_UNEXPECTED;
           LOG_WARN("get macro block end macro block id is not equal to macro block range",
-              K(ret), K_(macro_block_count), K_(macro_block_index), K(logic_block_id),
-              "end_macro_block_id", copy_macro_range_info_->end_macro_block_id_, K(physic_block_id), K(table_key_));
+              K(ret), K_(macro_block_count), K_(macro_block_index), K(macro_index),
+              "end_macro_block_id", copy_macro_range_info_->end_macro_block_id_, K(table_key_));
         }
       }
     }
@@ -487,6 +482,126 @@ int ObCopyMacroBlockRestoreReader::get_next_macro_block(
   return ret;
 }
 
+int ObCopyMacroBlockRestoreReader::prefetch_macro_blocks_if_need()
+{
+  int ret = OB_SUCCESS;
+  if (prefetch_index_pos_ < prefetch_index_list_.count()) {
+    // prefetched macro blocks are not consumed
+  } else if (OB_FAIL(prefetch_macro_blocks())) {
+    LOG_WARN("failed to prefetch macro blocks", K(ret));
+  }
+  return ret;
+}
+
+int ObCopyMacroBlockRestoreReader::prefetch_macro_blocks()
+{
+  int ret = OB_SUCCESS;
+  int64_t prefetch_size = 0;
+  prefetch_offset_ = 0;
+  prefetch_path_.reset();
+
+  if (OB_FAIL(get_prefetch_macro_block_indexes(prefetch_size))) {
+    LOG_WARN("failed to get prefetch macro block indexes", K(ret), K_(macro_block_index));
+  } else if (FALSE_IT(prefetch_offset_ = prefetch_index_list_.at(0).offset_)) {
+  } else if (OB_FAIL(get_macro_block_backup_path(prefetch_index_list_.at(0), prefetch_path_))) {
+    LOG_WARN("failed to get macro block backup path", K(ret), "macro_index", prefetch_index_list_.at(0));
+  } else if (OB_FAIL(backup::ObLSBackupRestoreUtil::pread_file(prefetch_path_.get_obstr(),
+      restore_base_info_->backup_dest_.get_storage_info(), prefetch_offset_, prefetch_size, prefetch_buf_))) {
+    LOG_WARN("failed to read macro block data", K(ret), K(table_key_), K_(prefetch_path), K_(prefetch_offset),
+        K(prefetch_size), KPC(restore_base_info_));
+  } else {
+    LOG_DEBUG("prefetch macro blocks", K(table_key_), K_(prefetch_path), K_(prefetch_offset), K(prefetch_size),
+        "macro_block_count", prefetch_index_list_.count());
+  }
+
+  if (OB_FAIL(ret)) {
+    prefetch_index_list_.reuse();
+  }
+  return ret;
+}
+
+int ObCopyMacroBlockRestoreReader::get_prefetch_macro_block_indexes(int64_t &prefetch_size)
+{
+  int ret = OB_SUCCESS;
+  backup::ObBackupMacroBlockIndex macro_index;
+  prefetch_size = 0;
+  prefetch_index_list_.reuse();
+  prefetch_index_pos_ = 0;
+
+  for (int64_t i = 0; OB_SUCC(ret) && macro_block_count_ + i < copy_macro_range_info_->macro_block_count_; ++i) {
+    if (OB_FAIL(get_macro_block_index(macro_block_index_ + i, macro_index))) {
+      LOG_WARN("failed to get macro block index", K(ret), K_(macro_block_index), K(i));
+    } else if (macro_index.length_ > prefetch_buf_size_) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("macro block is larger than prefetch buffer", K(ret), K(macro_index), K_(prefetch_buf_size));
+    } else if (i > 0 && (!is_sequential_macro_block(prefetch_index_list_.at(i - 1), macro_index)
+        || prefetch_size + macro_index.length_ > prefetch_buf_size_)) {
+      // read by the next prefetch
+      break;
+    } else if (OB_FAIL(prefetch_index_list_.push_back(macro_index))) {
+      LOG_WARN("failed to push macro index into array", K(ret), K(macro_index));
+    } else {
+      prefetch_size += macro_index.length_;
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (prefetch_index_list_.empty()) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("no macro block to prefetch", K(ret), K_(macro_block_count), KPC(copy_macro_range_info_));
+  }
+  return ret;
+}
+
+int ObCopyMacroBlockRestoreReader::get_macro_block_index(
+    const int64_t block_id_index,
+    backup::ObBackupMacroBlockIndex &macro_index)
+{
+  int ret = OB_SUCCESS;
+  ObLogicMacroBlockId logic_block_id;
+  backup::ObBackupPhysicalID physic_block_id;
+  macro_index.reset();
+  if (OB_FAIL(restore_macro_block_id_mgr_->get_macro_block_id(block_id_index, logic_block_id, physic_block_id))) {
+    LOG_WARN("failed to get macro block id", K(ret), K(block_id_index), K(table_key_), KPC(restore_base_info_));
+  } else if (OB_FAIL(physic_block_id.get_backup_macro_block_index(logic_block_id, macro_index))) {
+    LOG_WARN("failed to get backup macro block index", K(ret), K(logic_block_id), K(physic_block_id));
+  }
+  return ret;
+}
+
+int ObCopyMacroBlockRestoreReader::get_macro_block_backup_path(
+    const backup::ObBackupMacroBlockIndex &macro_index,
+    share::ObBackupPath &backup_path)
+{
+  int ret = OB_SUCCESS;
+  share::ObBackupDataType data_type;
+  share::ObRestoreBackupSetBriefInfo backup_set_brief_info;
+  share::ObBackupDest backup_set_dest;
+  if (OB_FAIL(ObRestoreUtils::get_backup_data_type(table_key_, data_type))) {
+    LOG_WARN("fail to get backup data type", K(ret), K(table_key_));
+  } else if (OB_FAIL(restore_base_info_->get_restore_backup_set_dest(macro_index.backup_set_id_, backup_set_brief_info))) {
+    LOG_WARN("fail to get backup set dest", K(ret), K(macro_index));
+  } else if (OB_FAIL(backup_set_dest.set(backup_set_brief_info.backup_set_path_))) {
+    LOG_WARN("fail to set backup set dest", K(ret));
+  } else if (OB_FAIL(share::ObBackupPathUtil::get_macro_block_backup_path(backup_set_dest, macro_index.ls_id_,
+      data_type, macro_index.turn_id_, macro_index.retry_id_, macro_index.file_id_, backup_path))) {
+    LOG_WARN("failed to get macro block index", K(ret), K(restore_base_info_), K(macro_index), KPC(restore_base_info_));
+  }
+  return ret;
+}
+
+bool ObCopyMacroBlockRestoreReader::is_sequential_macro_block(
+    const backup::ObBackupMacroBlockIndex &prev_index,
+    const backup::ObBackupMacroBlockIndex &macro_index) const
+{
+  return prev_index.backup_set_id_ == macro_index.backup_set_id_
+      && prev_index.ls_id_ == macro_index.ls_id_
+      && prev_index.turn_id_ == macro_index.turn_id_
+      && prev_index.retry_id_ == macro_index.retry_id_
+      && prev_index.file_id_ == macro_index.file_id_
+      && prev_index.offset_ + prev_index.length_ == macro_index.offset_;
+}
+
 /******************ObCopyMacroBlockHandle*********************/
 ObCopyMacroBlockHandle::ObCopyMacroBlockHandle()
   : is_reuse_macro_block_(false),
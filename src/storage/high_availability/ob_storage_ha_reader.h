@@ -125,8 +125,20 @@ public:
 
 private:
   int alloc_buffers();
+  int prefetch_macro_blocks_if_need();
+  int prefetch_macro_blocks();
+  int get_prefetch_macro_block_indexes(int64_t &prefetch_size);
+  int get_macro_block_index(const int64_t block_id_index, backup::ObBackupMacroBlockIndex &macro_index);
+  int get_macro_block_backup_path(const backup::ObBackupMacroBlockIndex &macro_index, share::ObBackupPath &backup_path);
+  bool is_sequential_macro_block(
+      const backup::ObBackupMacroBlockIndex &prev_index,
+      const backup::ObBackupMacroBlockIndex &macro_index) const;
 
 private:
+  // The macro blocks of a range which are adjacent in the same backup file are read with one
+  // sequential read of at most MAX_PREFETCH_MACRO_BLOCK_COUNT macro blocks, instead of one read
+  // for each macro block.
+  static const int64_t MAX_PREFETCH_MACRO_BLOCK_COUNT = 8;
   bool is_inited_;
   ObITable::TableKey table_key_;
   const ObCopyMacroRangeInfo *copy_macro_range_info_;
@@ -138,6 +150,12 @@ private:
   int64_t macro_block_index_;
   int64_t macro_block_count_;
   int64_t data_size_;
+  char *prefetch_buf_;
+  int64_t prefetch_buf_size_;
+  int64_t prefetch_offset_; // offset of prefetch_buf_ in the backup file
+  share::ObBackupPath prefetch_path_;
+  common::ObArray<backup::ObBackupMacroBlockIndex> prefetch_index_list_;
+  int64_t prefetch_index_pos_;
   DISALLOW_COPY_AND_ASSIGN(ObCopyMacroBlockRestoreReader);
 };
 
@@ -224,6 +224,7 @@ void ObLSTxCtxMgr::reset()
   txs_ = NULL;
   ts_mgr_ = NULL;
   ls_retain_ctx_mgr_.reset();
+  commit_latency_stat_.reset();
 
   ObRemoveAllTxCtxFunctor fn;
   ls_tx_ctx_map_.remove_if(fn);
@@ -1949,6 +1950,24 @@ int ObTxCtxMgr::iterate_tx_ctx_mgr_stat(const ObAddr &addr,
   return ret;
 }
 
+int ObTxCtxMgr::iterate_tx_commit_stage_stat(const ObAddr &addr,
+    ObTxCommitStageStatIterator &commit_stage_stat_iter)
+{
+  int ret = OB_SUCCESS;
+
+  if (IS_NOT_INIT) {
+    TRANS_LOG(WARN, "ObTxCtxMgr not inited");
+    ret = OB_NOT_INIT;
+  } else {
+    IterateLSTxCommitStageStatFunctor fn(addr, commit_stage_stat_iter);
+    if (OB_FAIL(foreach_ls_(fn))) {
+      TRANS_LOG(WARN, "for each all ls error", KR(ret));
+    }
+  }
+
+  return ret;
+}
+
 int ObTxCtxMgr::get_ls_min_uncommit_tx_prepare_version(const ObLSID &ls_id, int64_t &min_prepare_version)
 {
   int ret = OB_SUCCESS;
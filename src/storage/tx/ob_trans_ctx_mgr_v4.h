@@ -20,6 +20,7 @@
 #include "storage/tx/ob_trans_ctx.h"
 #include "storage/tx/ob_tx_ls_log_writer.h"
 #include "storage/tx/ob_tx_retain_ctx_mgr.h"
+#include "storage/tx/ob_tx_commit_latency_stat.h"
 #include "storage/tablelock/ob_lock_table.h"
 
 namespace oceanbase
@@ -77,6 +78,10 @@ typedef common::ObSimpleIterator<ObTxStat,
 typedef common::ObSimpleIterator<ObLSTxCtxMgrStat,
         ObModIds::OB_TRANS_VIRTUAL_TABLE_PARTITION_STAT, 16> ObTxCtxMgrStatIterator;
 
+// Is used to store and travserse the commit stage latency of all ObLSTxCtxMgr
+typedef common::ObSimpleIterator<ObTxCommitStageStat,
+        ObModIds::OB_TRANS_VIRTUAL_TABLE_PARTITION_STAT, 16> ObTxCommitStageStatIterator;
+
 // Is used to travserse all TxCtx's lock information
 typedef common::ObSimpleIterator<ObTxLockStat,
         ObModIds::OB_TRANS_VIRTUAL_TABLE_TRANS_STAT, 16> ObTxLockStatIterator;
@@ -296,6 +301,9 @@ public:
 
   ObITxLogAdapter *get_ls_log_adapter() { return tx_log_adapter_; }
 
+  // Get the latency stat of the sampled commits of this LogStream
+  ObTxCommitLatencyStat &get_commit_latency_stat() { return commit_latency_stat_; }
+
   // Get the tx_table of this LogStream
   int get_tx_table_guard(ObTxTableGuard &guard) {
     return tx_table_->get_tx_table_guard(guard);
@@ -676,6 +684,9 @@ private:
 
   ObTxRetainCtxMgr ls_retain_ctx_mgr_;
 
+  // Latency of each commit stage of the sampled transactions
+  ObTxCommitLatencyStat commit_latency_stat_;
+
   mutable RWLock rwlock_;
   // lock for concurrency between minor merge and remove / rebuild this LS
   // ATTENTION: the order between locks should be:
@@ -901,6 +912,13 @@ public:
   int iterate_tx_ctx_mgr_stat(const ObAddr &addr,
                               ObTxCtxMgrStatIterator &tx_ctx_mgr_stat_iter);
 
+  // Get the commit stage latency of all ObLSTxCtxMgr in the observer
+  // @param [in] addr: the address of the observer, which is used to populate each line of output;
+  // @param [out] commit_stage_stat_iter: Used to return the latency of each commit stage
+  //              of each ls, and then used to iteratively output to the virtual table;
+  int iterate_tx_commit_stage_stat(const ObAddr &addr,
+                                   ObTxCommitStageStatIterator &commit_stage_stat_iter);
+
   // Get all transaction information at the server level
   // @param [out] tx_stat_iter: Used to return all the collected TxCtx's Stat information,
   //             and then used to iteratively output to the virtual table;
@@ -11,6 +11,7 @@
  */
 
 #include "ob_trans_event.h"
+#include "ob_tx_commit_latency_stat.h"
 #include "lib/statistic_event/ob_stat_event.h"
 #include "lib/stat/ob_diagnose_info.h"
 #include "lib/stat/ob_session_stat.h"
@@ -498,5 +499,67 @@ void ObTransStatistic::add_trans_log_total_size(const uint64_t tenant_id, const
   EVENT_ADD(CLOG_TRANS_LOG_TOTAL_SIZE, value);
 }
 
+void ObTransStatistic::add_trans_log_compress_count(const uint64_t tenant_id, const int64_t value)
+{
+  common::ObTenantStatEstGuard guard(tenant_id);
+  EVENT_ADD(CLOG_TRANS_LOG_COMPRESS_COUNT, value);
+}
+
+void ObTransStatistic::add_trans_log_compress_origin_size(const uint64_t tenant_id, const int64_t value)
+{
+  common::ObTenantStatEstGuard guard(tenant_id);
+  EVENT_ADD(CLOG_TRANS_LOG_COMPRESS_ORIGIN_SIZE, value);
+}
+
+void ObTransStatistic::add_trans_log_compressed_size(const uint64_t tenant_id, const int64_t value)
+{
+  common::ObTenantStatEstGuard guard(tenant_id);
+  EVENT_ADD(CLOG_TRANS_LOG_COMPRESSED_SIZE, value);
+}
+
+void ObTransStatistic::add_trans_log_compress_time(const uint64_t tenant_id, const int64_t value)
+{
+  common::ObTenantStatEstGuard guard(tenant_id);
+  EVENT_ADD(CLOG_TRANS_LOG_COMPRESS_TIME, value);
+}
+
+void ObTransStatistic::add_trans_commit_stage_sample_count(const uint64_t tenant_id, const int64_t value)
+{
+  common::ObTenantStatEstGuard guard(tenant_id);
+  EVENT_ADD(TRANS_COMMIT_STAGE_SAMPLE_COUNT, value);
+}
+
+void ObTransStatistic::add_trans_commit_stage_time(const uint64_t tenant_id,
+                                                   const int64_t stage,
+                                                   const int64_t value)
+{
+  common::ObTenantStatEstGuard guard(tenant_id);
+  switch (stage) {
+    case ObTxCommitStage::REDO_FLUSHED: {
+      EVENT_ADD(TRANS_COMMIT_STAGE_REDO_FLUSH_TIME, value);
+      break;
+    }
+    case ObTxCommitStage::COMMIT_LOG_SUBMITTED: {
+      EVENT_ADD(TRANS_COMMIT_STAGE_LOG_SUBMIT_TIME, value);
+      break;
+    }
+    case ObTxCommitStage::COMMIT_LOG_SYNCED: {
+      EVENT_ADD(TRANS_COMMIT_STAGE_LOG_SYNC_TIME, value);
+      break;
+    }
+    case ObTxCommitStage::CALLBACK_EXECUTED: {
+      EVENT_ADD(TRANS_COMMIT_STAGE_CALLBACK_TIME, value);
+      break;
+    }
+    case ObTxCommitStage::RESPONSE_SENT: {
+      EVENT_ADD(TRANS_COMMIT_STAGE_RESPONSE_TIME, value);
+      break;
+    }
+    default: {
+      break;
+    }
+  }
+}
+
 } // transaction
 } // oceanbase
@@ -189,6 +189,14 @@ public:
   // count the number of batch commit trans
   void add_batch_commit_trans_count(const uint64_t tenant_id, const int64_t value);
   void add_trans_log_total_size(const uint64_t tenant_id, const int64_t value);
+  // count the compressed tx log blocks, their size before and after compression and the cost
+  void add_trans_log_compress_count(const uint64_t tenant_id, const int64_t value);
+  void add_trans_log_compress_origin_size(const uint64_t tenant_id, const int64_t value);
+  void add_trans_log_compressed_size(const uint64_t tenant_id, const int64_t value);
+  void add_trans_log_compress_time(const uint64_t tenant_id, const int64_t value);
+  // count the sampled commits and the time spent in each stage of them, see ObTxCommitStage
+  void add_trans_commit_stage_sample_count(const uint64_t tenant_id, const int64_t value);
+  void add_trans_commit_stage_time(const uint64_t tenant_id, const int64_t stage, const int64_t value);
 
 private:
   ObTransStatistic() : sys_trans_count_stat_("trans_sys_count"), user_trans_count_stat_("trans_user_count"),
@@ -501,6 +501,47 @@ private:
   const ObAddr &addr_;
 };
 
+class IterateLSTxCommitStageStatFunctor
+{
+public:
+  IterateLSTxCommitStageStatFunctor(const ObAddr &addr,
+                                    ObTxCommitStageStatIterator &commit_stage_stat_iter)
+      : commit_stage_stat_iter_(commit_stage_stat_iter), addr_(addr) {}
+  bool operator()(const share::ObLSID &ls_id, ObLSTxCtxMgr *ls_tx_ctx_mgr)
+  {
+    int tmp_ret = common::OB_SUCCESS;
+    bool bool_ret = false;
+
+    if (!ls_id.is_valid() || OB_ISNULL(ls_tx_ctx_mgr)) {
+      TRANS_LOG(WARN, "invalid argument", K(ls_id), KP(ls_tx_ctx_mgr));
+      tmp_ret = OB_INVALID_ARGUMENT;
+    } else {
+      const ObTxCommitLatencyStat &latency_stat = ls_tx_ctx_mgr->get_commit_latency_stat();
+      // one row for each stage except START_COMMIT, and one row for the whole commit
+      for (int64_t i = ObTxCommitStage::START_COMMIT + 1;
+           OB_SUCCESS == tmp_ret && i <= ObTxCommitStage::MAX_STAGE; i++) {
+        const ObTxCommitStage::Type stage = static_cast<ObTxCommitStage::Type>(i);
+        ObTxCommitStageStat stage_stat;
+        if (OB_TMP_FAIL(stage_stat.init(addr_,
+                                        ls_id,
+                                        ObTxCommitStage::to_str(stage),
+                                        ObTxCommitStage::MAX_STAGE == stage ?
+                                          latency_stat.get_total_histogram() :
+                                          latency_stat.get_stage_histogram(stage)))) {
+          TRANS_LOG(WARN, "ObTxCommitStageStat init error", K(tmp_ret), K_(addr), K(ls_id));
+        } else if (OB_TMP_FAIL(commit_stage_stat_iter_.push(stage_stat))) {
+          TRANS_LOG(WARN, "ObTxCommitStageStatIterator push error", K(tmp_ret), K(ls_id));
+        }
+      }
+      bool_ret = (OB_SUCCESS == tmp_ret);
+    }
+    return bool_ret;
+  }
+private:
+  ObTxCommitStageStatIterator &commit_stage_stat_iter_;
+  const ObAddr &addr_;
+};
+
 class IterateCheckTabletModifySchema
 {
 public:
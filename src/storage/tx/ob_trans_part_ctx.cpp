@@ -274,6 +274,7 @@ void ObPartTransCtx::default_init_()
   coord_prepare_info_arr_.reset();
   reserve_allocator_.reset();
   elr_handler_.reset();
+  commit_stage_trace_.reset();
 }
 
 int ObPartTransCtx::init_log_cbs_(const ObLSID &ls_id, const ObTransID &tx_id)
@@ -648,6 +649,9 @@ int ObPartTransCtx::commit(const ObLSArray &parts,
     } else {
       set_stc_by_now_();
     }
+    if (ls_tx_ctx_mgr_->get_commit_latency_stat().need_sample(trans_id_)) {
+      commit_stage_trace_.start(trans_id_);
+    }
     if (parts.count() == 1 && parts[0] == ls_id_) {
       exec_info_.trans_type_ = TransType::SP_TRANS;
       if (OB_FAIL(one_phase_commit_())) {
@@ -1663,6 +1667,7 @@ int ObPartTransCtx::on_success_ops_(ObTxLogCb *log_cb)
     } else if (ObTxLogType::TX_COMMIT_INFO_LOG == log_type) {
       ObTwoPhaseCommitLogType two_phase_log_type;
       set_durable_state_(ObTxState::REDO_COMPLETE);
+      commit_stage_trace_.record(ObTxCommitStage::REDO_FLUSHED);
       if (exec_info_.is_dup_tx_ && OB_FAIL(dup_table_tx_redo_sync_())) {
         TRANS_LOG(WARN, "dup table redo sync error", K(ret));
       }
@@ -1696,6 +1701,9 @@ int ObPartTransCtx::on_success_ops_(ObTxLogCb *log_cb)
       tg.click();
     } else if (ObTxLogTypeChecker::is_state_log(log_type)) {
       sub_state_.clear_state_log_submitting();
+      if (ObTxLogType::TX_PREPARE_LOG == log_type || ObTxLogType::TX_COMMIT_LOG == log_type) {
+        commit_stage_trace_.record(ObTxCommitStage::COMMIT_LOG_SYNCED);
+      }
       if (ObTxLogType::TX_PREPARE_LOG == log_type) {
 
         //must before apply log
@@ -2996,6 +3004,9 @@ int ObPartTransCtx::submit_log_impl_(const ObTxLogType log_type)
   if (OB_FAIL(ret)) {
     TRANS_LOG(WARN, "submit_log_impl_ failed", KR(ret), K(log_type), K(*this));
   } else {
+    if (ObTxLogType::TX_PREPARE_LOG == log_type || ObTxLogType::TX_COMMIT_LOG == log_type) {
+      commit_stage_trace_.record(ObTxCommitStage::COMMIT_LOG_SUBMITTED);
+    }
 #ifndef NDEBUG
     TRANS_LOG(INFO, "submit_log_impl_ end", KR(ret), K(log_type), K(*this));
 #endif
@@ -5926,6 +5937,7 @@ int ObPartTransCtx::on_local_commit_tx_()
   } else if (OB_FAIL(update_max_commit_version_())) {
     TRANS_LOG(WARN, "update max commit version failed", KR(ret), KPC(this));
   } else {
+    commit_stage_trace_.record(ObTxCommitStage::CALLBACK_EXECUTED);
     (void)post_tx_commit_resp_(OB_SUCCESS);
     set_exiting_();
   }
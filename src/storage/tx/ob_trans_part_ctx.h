@@ -24,6 +24,7 @@
 #include "logservice/palf/lsn.h"
 #include "ob_one_phase_committer.h"
 #include "ob_two_phase_committer.h"
+#include "ob_tx_commit_latency_stat.h"
 #include <cstdint>
 
 
@@ -549,6 +550,7 @@ private:
   int find_participant_id_(const share::ObLSID&participant,
                            uint64_t &participant_id);
   int post_tx_commit_resp_(const int status);
+  void finish_commit_stage_trace_(const int status);
   int post_msg_(const ObTwoPhaseCommitMsgType& msg_type,
                 const share::ObLSID&ls);
 
@@ -750,6 +752,8 @@ private:
   TransModulePageAllocator reserve_allocator_;
   // tmp scheduler addr is used to post response for the second phase of xa commit/rollback
   common::ObAddr tmp_scheduler_;
+  // stage timestamps of the commit, only filled if the commit is sampled
+  ObTxCommitStageTrace commit_stage_trace_;
   // ========================================================
 };
 
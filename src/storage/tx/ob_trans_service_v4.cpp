@@ -1442,6 +1442,7 @@ int ObTransService::acquire_global_snapshot__(const int64_t expire_ts,
   int ret = OB_SUCCESS;
   const MonotonicTs now0 = MonotonicTs::current_time();
   const MonotonicTs now = now0 - MonotonicTs(gts_ahead);
+  bool sched_waiting = false;
   do {
     int64_t n = ObClockGenerator::getClock();
     MonotonicTs rts(0);
@@ -1452,6 +1453,11 @@ int ObTransService::acquire_global_snapshot__(const int64_t expire_ts,
         if (interrupt_checker()) {
           ret = OB_ERR_INTERRUPTED;
         } else {
+          if (!sched_waiting) {
+            // notify omt that I'd begin to wait for gts
+            THIS_WORKER.sched_wait();
+            sched_waiting = true;
+          }
           ob_usleep(500);
         }
       } else {
@@ -1464,6 +1470,9 @@ int ObTransService::acquire_global_snapshot__(const int64_t expire_ts,
       uncertain_bound = rts.mts_ + gts_ahead;
     }
   } while (OB_EAGAIN == ret);
+  if (sched_waiting) {
+    THIS_WORKER.sched_run();
+  }
 
   if (OB_FAIL(ret)) {
     TRANS_LOG(WARN, "acquire global snapshot fail", K(ret),
@@ -2113,6 +2122,26 @@ int ObTransService::iterate_tx_ctx_mgr_stat(ObTxCtxMgrStatIterator &tx_ctx_mgr_s
   return ret;
 }
 
+int ObTransService::iterate_tx_commit_stage_stat(ObTxCommitStageStatIterator &commit_stage_stat_iter)
+{
+  int ret = OB_SUCCESS;
+
+  if (IS_NOT_INIT) {
+    TRANS_LOG(WARN, "ObTransService not inited");
+    ret = OB_NOT_INIT;
+  } else if (OB_UNLIKELY(!is_running_)) {
+    TRANS_LOG(WARN, "ObTransService is not running");
+    ret = OB_NOT_RUNNING;
+  } else if (OB_FAIL(tx_ctx_mgr_.iterate_tx_commit_stage_stat(self_, commit_stage_stat_iter))) {
+    TRANS_LOG(WARN, "iterate_tx_commit_stage_stat error", KR(ret), K_(self));
+  } else if (OB_FAIL(commit_stage_stat_iter.set_ready())) {
+    TRANS_LOG(WARN, "commit_stage_stat_iter set ready error", KR(ret));
+  } else {
+    // do nothing
+  }
+  return ret;
+}
+
 int ObTransService::iterate_tx_lock_stat(const share::ObLSID& ls_id,
     ObTxLockStatIterator &tx_lock_stat_iter)
 {
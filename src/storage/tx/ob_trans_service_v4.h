@@ -126,6 +126,8 @@ int iterate_ls_id(ObLSIDIterator &ls_id_iter);
 
 int iterate_tx_ctx_mgr_stat(ObTxCtxMgrStatIterator &tx_ctx_mgr_stat_iter);
 
+int iterate_tx_commit_stage_stat(ObTxCommitStageStatIterator &commit_stage_stat_iter);
+
 int iterate_tx_lock_stat(const share::ObLSID& ls_id,
     ObTxLockStatIterator &tx_lock_stat_iter);
 
@@ -223,6 +223,7 @@ int ObPartTransCtx::check_and_response_scheduler_(int result)
       }
     }
   } else {
+    commit_stage_trace_.record(ObTxCommitStage::CALLBACK_EXECUTED);
     if (OB_FAIL(post_tx_commit_resp_(result))) {
       TRANS_LOG(WARN, "post commit response failed", KR(ret), K(*this));
       ret = OB_SUCCESS;
@@ -875,9 +875,22 @@ int ObPartTransCtx::post_tx_commit_resp_(const int status)
   REC_TRANS_TRACE_EXT(tlog_, response_scheduler, OB_ID(ret), ret,
                       OB_ID(status), status,
                       OB_ID(commit_version), commit_version);
+  finish_commit_stage_trace_(OB_SUCC(ret) ? status : ret);
   return ret;
 }
 
+void ObPartTransCtx::finish_commit_stage_trace_(const int status)
+{
+  if (OB_UNLIKELY(commit_stage_trace_.is_sampled())) {
+    // only the successful commits are counted, otherwise the latency is dominated by timeouts
+    if (OB_SUCCESS == status) {
+      commit_stage_trace_.record(ObTxCommitStage::RESPONSE_SENT);
+      ls_tx_ctx_mgr_->get_commit_latency_stat().add_trace(commit_stage_trace_);
+    }
+    commit_stage_trace_.reset();
+  }
+}
+
 int ObPartTransCtx::post_tx_sub_prepare_resp_(const int status)
 {
   int ret = OB_SUCCESS;
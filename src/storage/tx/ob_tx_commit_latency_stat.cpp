@@ -0,0 +1,186 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_tx_commit_latency_stat.h"
+#include "ob_trans_event.h"
+#include "share/rc/ob_tenant_base.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+
+namespace transaction
+{
+
+const char *ObTxCommitStage::to_str(const Type stage)
+{
+  const char *str = "UNKNOWN";
+  switch (stage) {
+    case START_COMMIT: { str = "START_COMMIT"; break; }
+    case REDO_FLUSHED: { str = "REDO_FLUSHED"; break; }
+    case COMMIT_LOG_SUBMITTED: { str = "COMMIT_LOG_SUBMITTED"; break; }
+    case COMMIT_LOG_SYNCED: { str = "COMMIT_LOG_SYNCED"; break; }
+    case CALLBACK_EXECUTED: { str = "CALLBACK_EXECUTED"; break; }
+    case RESPONSE_SENT: { str = "RESPONSE_SENT"; break; }
+    case MAX_STAGE: { str = "TOTAL"; break; }
+    default: { break; }
+  }
+  return str;
+}
+
+void ObTxCommitStageTrace::reset()
+{
+  tx_id_.reset();
+  for (int64_t i = 0; i < ObTxCommitStage::MAX_STAGE; i++) {
+    ts_[i] = 0;
+  }
+}
+
+void ObTxCommitStageTrace::start(const ObTransID &tx_id)
+{
+  reset();
+  tx_id_ = tx_id;
+  ts_[ObTxCommitStage::START_COMMIT] = ObTimeUtility::fast_current_time();
+}
+
+int64_t ObTxCommitStageTrace::get_stage_cost(const ObTxCommitStage::Type stage) const
+{
+  int64_t cost = -1;
+  if (is_sampled() && ObTxCommitStage::START_COMMIT < stage && ObTxCommitStage::MAX_STAGE > stage
+      && 0 != ts_[stage]) {
+    // the previous recorded stage, stages may be skipped, e.g. a read only commit
+    // has no log to flush
+    int64_t prev = stage - 1;
+    while (prev > ObTxCommitStage::START_COMMIT && 0 == ts_[prev]) {
+      prev--;
+    }
+    cost = MAX(0, ts_[stage] - ts_[prev]);
+  }
+  return cost;
+}
+
+int64_t ObTxCommitStageTrace::get_total_cost() const
+{
+  int64_t cost = -1;
+  if (is_sampled()) {
+    for (int64_t i = ObTxCommitStage::MAX_STAGE - 1; i > ObTxCommitStage::START_COMMIT; i--) {
+      if (0 != ts_[i]) {
+        cost = MAX(0, ts_[i] - ts_[ObTxCommitStage::START_COMMIT]);
+        break;
+      }
+    }
+  }
+  return cost;
+}
+
+int64_t ObTxCommitStageTrace::to_string(char *buf, const int64_t buf_len) const
+{
+  int64_t pos = 0;
+  J_OBJ_START();
+  J_KV(K_(tx_id), "start_ts", ts_[ObTxCommitStage::START_COMMIT]);
+  for (int64_t i = ObTxCommitStage::START_COMMIT + 1; i < ObTxCommitStage::MAX_STAGE; i++) {
+    J_COMMA();
+    J_KV(ObTxCommitStage::to_str(static_cast<ObTxCommitStage::Type>(i)),
+         get_stage_cost(static_cast<ObTxCommitStage::Type>(i)));
+  }
+  J_OBJ_END();
+  return pos;
+}
+
+void ObTxCommitStageStat::reset()
+{
+  addr_.reset();
+  ls_id_.reset();
+  stage_ = NULL;
+  sample_count_ = 0;
+  avg_latency_ = 0;
+  p50_latency_ = 0;
+  p90_latency_ = 0;
+  p99_latency_ = 0;
+}
+
+int ObTxCommitStageStat::init(const ObAddr &addr,
+                              const ObLSID &ls_id,
+                              const char *stage,
+                              const ObLog2Histogram &histogram)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!addr.is_valid() || !ls_id.is_valid() || OB_ISNULL(stage))) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", K(ret), K(addr), K(ls_id), KP(stage));
+  } else {
+    addr_ = addr;
+    ls_id_ = ls_id;
+    stage_ = stage;
+    sample_count_ = histogram.get_total_count();
+    avg_latency_ = histogram.get_avg_value();
+    p50_latency_ = histogram.get_percentile(50);
+    p90_latency_ = histogram.get_percentile(90);
+    p99_latency_ = histogram.get_percentile(99);
+  }
+  return ret;
+}
+
+void ObTxCommitLatencyStat::reset()
+{
+  sample_ratio_ = 0;
+  last_refresh_ts_ = 0;
+  for (int64_t i = 0; i < ObTxCommitStage::MAX_STAGE; i++) {
+    stage_histograms_[i].reset();
+  }
+  total_histogram_.reset();
+}
+
+int64_t ObTxCommitLatencyStat::get_sample_ratio_()
+{
+  const int64_t now = ObTimeUtility::fast_current_time();
+  if (now - ATOMIC_LOAD(&last_refresh_ts_) > REFRESH_SAMPLE_RATIO_INTERVAL) {
+    int64_t sample_ratio = 0;
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (tenant_config.is_valid()) {
+      sample_ratio = tenant_config->_tx_commit_stage_sample_ratio;
+    }
+    ATOMIC_STORE(&sample_ratio_, sample_ratio);
+    ATOMIC_STORE(&last_refresh_ts_, now);
+  }
+  return ATOMIC_LOAD(&sample_ratio_);
+}
+
+bool ObTxCommitLatencyStat::need_sample(const ObTransID &tx_id)
+{
+  const int64_t sample_ratio = get_sample_ratio_();
+  return sample_ratio > 0 && (tx_id.get_id() % 100) < sample_ratio;
+}
+
+void ObTxCommitLatencyStat::add_trace(const ObTxCommitStageTrace &trace)
+{
+  if (trace.is_sampled()) {
+    const uint64_t tenant_id = MTL_ID();
+    ObTransStatistic::get_instance().add_trans_commit_stage_sample_count(tenant_id, 1);
+    for (int64_t i = ObTxCommitStage::START_COMMIT + 1; i < ObTxCommitStage::MAX_STAGE; i++) {
+      const int64_t cost = trace.get_stage_cost(static_cast<ObTxCommitStage::Type>(i));
+      if (cost >= 0) {
+        stage_histograms_[i].add(cost);
+        ObTransStatistic::get_instance().add_trans_commit_stage_time(tenant_id, i, cost);
+      }
+    }
+    const int64_t total_cost = trace.get_total_cost();
+    if (total_cost >= 0) {
+      total_histogram_.add(total_cost);
+    }
+  }
+}
+
+} // transaction
+} // oceanbase
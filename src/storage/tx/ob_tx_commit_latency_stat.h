@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_TRANSACTION_OB_TX_COMMIT_LATENCY_STAT_
+#define OCEANBASE_TRANSACTION_OB_TX_COMMIT_LATENCY_STAT_
+
+#include "lib/metrics/ob_log2_histogram.h"
+#include "lib/net/ob_addr.h"
+#include "share/ob_ls_id.h"
+#include "storage/tx/ob_trans_define.h"
+
+namespace oceanbase
+{
+namespace transaction
+{
+
+// The stages a committing transaction goes through on its coordinator
+// (or the only participant of a single ls transaction).
+struct ObTxCommitStage
+{
+  enum Type : int64_t
+  {
+    START_COMMIT = 0,         // commit request arrives at the tx ctx
+    REDO_FLUSHED = 1,         // all redo is durable (commit info log synced)
+    COMMIT_LOG_SUBMITTED = 2, // prepare or commit log submitted to palf
+    COMMIT_LOG_SYNCED = 3,    // callback of the prepare or commit log is invoked
+    CALLBACK_EXECUTED = 4,    // the log callback has finished the commit
+    RESPONSE_SENT = 5,        // the commit result has been sent to the scheduler
+    MAX_STAGE
+  };
+  static const char *to_str(const Type stage);
+};
+
+// Stage timestamps of one sampled commit, owned by the tx ctx and protected by its lock.
+class ObTxCommitStageTrace
+{
+public:
+  ObTxCommitStageTrace() { reset(); }
+  void reset();
+  void start(const ObTransID &tx_id);
+  bool is_sampled() const { return ts_[ObTxCommitStage::START_COMMIT] > 0; }
+  // only the first arrival at a stage is recorded
+  void record(const ObTxCommitStage::Type stage)
+  {
+    if (OB_UNLIKELY(is_sampled()) && 0 == ts_[stage]) {
+      ts_[stage] = ObTimeUtility::fast_current_time();
+    }
+  }
+  const ObTransID &get_tx_id() const { return tx_id_; }
+  int64_t get_ts(const ObTxCommitStage::Type stage) const { return ts_[stage]; }
+  // time spent from the previous recorded stage to 'stage', -1 if 'stage' is not recorded
+  int64_t get_stage_cost(const ObTxCommitStage::Type stage) const;
+  int64_t get_total_cost() const;
+  int64_t to_string(char *buf, const int64_t buf_len) const;
+private:
+  ObTransID tx_id_;
+  int64_t ts_[ObTxCommitStage::MAX_STAGE];
+};
+
+// Snapshot of the latency of one stage of a ls, used by the virtual table
+class ObTxCommitStageStat
+{
+public:
+  ObTxCommitStageStat() { reset(); }
+  void reset();
+  int init(const common::ObAddr &addr,
+           const share::ObLSID &ls_id,
+           const char *stage,
+           const common::ObLog2Histogram &histogram);
+  const common::ObAddr &get_addr() const { return addr_; }
+  const share::ObLSID &get_ls_id() const { return ls_id_; }
+  const char *get_stage() const { return stage_; }
+  int64_t get_sample_count() const { return sample_count_; }
+  int64_t get_avg_latency() const { return avg_latency_; }
+  int64_t get_p50_latency() const { return p50_latency_; }
+  int64_t get_p90_latency() const { return p90_latency_; }
+  int64_t get_p99_latency() const { return p99_latency_; }
+  TO_STRING_KV(K_(addr), K_(ls_id), K_(stage), K_(sample_count), K_(avg_latency),
+               K_(p50_latency), K_(p90_latency), K_(p99_latency));
+private:
+  common::ObAddr addr_;
+  share::ObLSID ls_id_;
+  const char *stage_;
+  int64_t sample_count_;
+  int64_t avg_latency_;
+  int64_t p50_latency_;
+  int64_t p90_latency_;
+  int64_t p99_latency_;
+};
+
+// Per ls aggregation of sampled commit stage traces.
+//
+// A commit is sampled if its tx id hits the tenant config _tx_commit_stage_sample_ratio,
+// so an unsampled commit only costs a check of the cached ratio.
+// The cost of each stage is accumulated into a histogram.
+class ObTxCommitLatencyStat
+{
+public:
+  ObTxCommitLatencyStat() { reset(); }
+  ~ObTxCommitLatencyStat() {}
+  void reset();
+  bool need_sample(const ObTransID &tx_id);
+  void add_trace(const ObTxCommitStageTrace &trace);
+  const common::ObLog2Histogram &get_stage_histogram(const ObTxCommitStage::Type stage) const
+  {
+    return stage_histograms_[stage];
+  }
+  const common::ObLog2Histogram &get_total_histogram() const { return total_histogram_; }
+  TO_STRING_KV(K_(sample_ratio), K_(total_histogram));
+private:
+  static const int64_t REFRESH_SAMPLE_RATIO_INTERVAL = 1 * 1000 * 1000; // 1s
+  int64_t get_sample_ratio_();
+private:
+  int64_t sample_ratio_;
+  int64_t last_refresh_ts_;
+  // the cost of START_COMMIT is always 0, so its slot is unused
+  common::ObLog2Histogram stage_histograms_[ObTxCommitStage::MAX_STAGE];
+  common::ObLog2Histogram total_histogram_;
+};
+
+} // transaction
+} // oceanbase
+
+#endif // OCEANBASE_TRANSACTION_OB_TX_COMMIT_LATENCY_STAT_
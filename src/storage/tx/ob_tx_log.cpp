@@ -16,6 +16,8 @@
 #include "storage/memtable/ob_memtable_mutator.h"
 #include "storage/blocksstable/ob_row_reader.h"
 #include "common/cell/ob_cell_reader.h"
+#include "lib/compress/ob_compressor_pool.h"
+#include "share/ob_cluster_version.h"
 
 namespace oceanbase
 {
@@ -903,31 +905,55 @@ int ObTxAbortLog::init_tx_data_backup(const storage::ObTxData * const tx_data)
 
 // ============================== Tx Log Blcok =============================
 
-OB_TX_SERIALIZE_MEMBER(ObTxLogBlockHeader, compat_bytes_, org_cluster_id_, log_entry_no_, tx_id_);
+OB_TX_SERIALIZE_MEMBER(ObTxLogBlockHeader,
+                       compat_bytes_,
+                       org_cluster_id_,
+                       log_entry_no_,
+                       tx_id_,
+                       compressor_type_,
+                       org_body_size_);
 
 int ObTxLogBlockHeader::before_serialize()
 {
   int ret = OB_SUCCESS;
 
-  if (OB_FAIL(compat_bytes_.init(3))) {
+  // may be called again after the compress info is set
+  compat_bytes_.reset();
+  if (OB_FAIL(compat_bytes_.init(5))) {
     TRANS_LOG(WARN, "init compat_bytes_ failed", K(ret));
   } else {
-    // do nothing
+    // uncompressed log blocks keep the same format as before
+    TX_NO_NEED_SER(compressor_type_ == 0, 4, compat_bytes_);
+    TX_NO_NEED_SER(org_body_size_ == 0, 5, compat_bytes_);
   }
 
   return ret;
 }
 
+void ObTxLogBlockHeader::set_compress_info(const common::ObCompressorType compressor_type,
+                                           const int64_t org_body_size)
+{
+  compressor_type_ = static_cast<int64_t>(compressor_type);
+  org_body_size_ = org_body_size;
+  before_serialize();
+}
+
 const logservice::ObLogBaseType ObTxLogBlock::DEFAULT_LOG_BLOCK_TYPE =
     logservice::ObLogBaseType::TRANS_SERVICE_LOG_BASE_TYPE; // TRANS_LOG
 const int32_t ObTxLogBlock::DEFAULT_BIG_ROW_BLOCK_SIZE =
     62 * 1024 * 1024; // 62M redo log buf for big row
+const int64_t ObTxLogBlock::MIN_COMPRESS_BODY_SIZE = 4 * 1024;
+const uint64_t ObTxLogBlock::MIN_COMPRESS_CLUSTER_VERSION = CLUSTER_VERSION_4_1_0_0;
 
 void ObTxLogBlock::reset()
 {
   if (nullptr != fill_buf_) {
     ClogBufFactory::release(fill_buf_);
   }
+  if (nullptr != decompress_buf_) {
+    ob_free(decompress_buf_);
+  }
+  decompress_buf_ = nullptr;
   replay_buf_ = nullptr;
   fill_buf_ = nullptr;
   len_ = pos_ = 0;
@@ -946,7 +972,7 @@ void ObTxLogBlock::reuse(const int64_t replay_hint, const ObTxLogBlockHeader &bl
   }
 }
 
-ObTxLogBlock::ObTxLogBlock() : fill_buf_(nullptr), replay_buf_(nullptr)
+ObTxLogBlock::ObTxLogBlock() : fill_buf_(nullptr), replay_buf_(nullptr), decompress_buf_(nullptr)
 {
   reset();
 }
@@ -988,6 +1014,8 @@ int ObTxLogBlock::init_with_header(const char *buf,
     if (OB_FAIL(deserialize_log_block_header_(replay_hint, block_header))) {
       ret = OB_DESERIALIZE_ERROR;
       TRANS_LOG(WARN, "deserialize log block header error", K(ret), K(*this));
+    } else if (OB_FAIL(decompress_if_need_(block_header))) {
+      TRANS_LOG(WARN, "decompress log block error", K(ret), K(block_header), K(*this));
     }
   }
   return ret;
@@ -1007,6 +1035,8 @@ int ObTxLogBlock::init(const char *buf, const int64_t &size, int skip_pos, ObTxL
 
     if (OB_FAIL(block_header.deserialize(replay_buf_, len_, pos_))) {
       TRANS_LOG(WARN, "deserialize block header", K(ret));
+    } else if (OB_FAIL(decompress_if_need_(block_header))) {
+      TRANS_LOG(WARN, "decompress log block error", K(ret), K(block_header), K(*this));
     }
   }
   return ret;
@@ -1082,6 +1112,129 @@ int ObTxLogBlock::deserialize_log_block_header_(int64_t &replay_hint, ObTxLogBlo
   return ret;
 }
 
+int ObTxLogBlock::decompress_if_need_(const ObTxLogBlockHeader &block_header)
+{
+  int ret = OB_SUCCESS;
+  common::ObCompressor *compressor = nullptr;
+  const int64_t org_body_size = block_header.get_org_body_size();
+  int64_t decompress_size = 0;
+
+  if (!block_header.is_compressed()) {
+    // do nothing
+  } else if (OB_ISNULL(replay_buf_) || OB_NOT_NULL(decompress_buf_) || org_body_size <= 0
+             || pos_ > len_) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid compressed log block", K(ret), K(block_header), K(*this));
+  } else if (OB_FAIL(common::ObCompressorPool::get_instance().get_compressor(
+                 block_header.get_compressor_type(), compressor))) {
+    TRANS_LOG(WARN, "get compressor failed", K(ret), K(block_header));
+  } else if (OB_ISNULL(compressor)) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(WARN, "unexpected null compressor", K(ret), K(block_header));
+  } else if (OB_ISNULL(decompress_buf_ = static_cast<char *>(ob_malloc(org_body_size, "TxLogDecomp")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    TRANS_LOG(WARN, "alloc decompress buf failed", K(ret), K(org_body_size));
+  } else if (OB_FAIL(compressor->decompress(replay_buf_ + pos_, len_ - pos_, decompress_buf_,
+                                            org_body_size, decompress_size))) {
+    TRANS_LOG(WARN, "decompress log block failed", K(ret), K(block_header), K(*this));
+  } else if (OB_UNLIKELY(decompress_size != org_body_size)) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(WARN, "unexpected decompress size", K(ret), K(decompress_size), K(block_header));
+  } else {
+    // the tx logs are iterated from the decompressed buf afterwards
+    replay_buf_ = decompress_buf_;
+    len_ = org_body_size;
+    pos_ = 0;
+  }
+
+  if (OB_FAIL(ret) && OB_NOT_NULL(decompress_buf_)) {
+    ob_free(decompress_buf_);
+    decompress_buf_ = nullptr;
+  }
+  return ret;
+}
+
+bool ObTxLogBlock::need_compress(const uint64_t min_cluster_version,
+                                 const common::ObCompressorType compressor_type,
+                                 const int64_t size)
+{
+  // the followers or the observers which the ls will be migrated to may
+  // not decompress it during upgrading
+  return common::ObCompressorPool::need_common_compress(compressor_type)
+         && size >= MIN_COMPRESS_BODY_SIZE
+         && min_cluster_version >= MIN_COMPRESS_CLUSTER_VERSION;
+}
+
+int ObTxLogBlock::compress_log_block(const char *buf,
+                                     const int64_t size,
+                                     const common::ObCompressorType compressor_type,
+                                     char *&compressed_buf,
+                                     int64_t &compressed_size)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  logservice::ObLogBaseHeader base_header;
+  ObTxLogBlockHeader block_header;
+  common::ObCompressor *compressor = nullptr;
+  int64_t max_overflow_size = 0;
+  char *tmp_buf = nullptr;
+  int64_t tmp_buf_len = 0;
+  int64_t header_size = 0;
+  int64_t body_compressed_size = 0;
+
+  compressed_buf = nullptr;
+  compressed_size = 0;
+  if (OB_ISNULL(buf) || size <= 0 || !common::ObCompressorPool::need_common_compress(compressor_type)) {
+    ret = OB_INVALID_ARGUMENT;
+    TRANS_LOG(WARN, "invalid argument", K(ret), KP(buf), K(size), K(compressor_type));
+  } else if (OB_FAIL(base_header.deserialize(buf, size, pos))) {
+    TRANS_LOG(WARN, "deserialize log base header error", K(ret), K(size), K(pos));
+  } else if (OB_FAIL(block_header.deserialize(buf, size, pos))) {
+    TRANS_LOG(WARN, "deserialize block header error", K(ret), K(size), K(pos));
+  } else if (block_header.is_compressed() || size - pos < MIN_COMPRESS_BODY_SIZE) {
+    // not worth compressing
+  } else if (OB_FAIL(common::ObCompressorPool::get_instance().get_compressor(compressor_type,
+                                                                             compressor))) {
+    TRANS_LOG(WARN, "get compressor failed", K(ret), K(compressor_type));
+  } else if (OB_ISNULL(compressor)) {
+    ret = OB_ERR_UNEXPECTED;
+    TRANS_LOG(WARN, "unexpected null compressor", K(ret), K(compressor_type));
+  } else if (OB_FAIL(compressor->get_max_overflow_size(size - pos, max_overflow_size))) {
+    TRANS_LOG(WARN, "get max overflow size failed", K(ret), K(size), K(pos));
+  } else if (OB_FALSE_IT(block_header.set_compress_info(compressor_type, size - pos))) {
+  } else if (OB_FALSE_IT(header_size = base_header.get_serialize_size()
+                                       + block_header.get_serialize_size())) {
+  } else if (OB_FALSE_IT(tmp_buf_len = header_size + size - pos + max_overflow_size)) {
+  } else if (OB_ISNULL(tmp_buf = static_cast<char *>(ob_malloc(tmp_buf_len, "TxLogCompress")))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    TRANS_LOG(WARN, "alloc compress buf failed", K(ret), K(tmp_buf_len));
+  } else if (OB_FAIL(compressor->compress(buf + pos, size - pos, tmp_buf + header_size,
+                                          tmp_buf_len - header_size, body_compressed_size))) {
+    TRANS_LOG(WARN, "compress log block failed", K(ret), K(size), K(pos), K(compressor_type));
+  } else if (header_size + body_compressed_size >= size) {
+    // incompressible, submit the origin log block
+  } else {
+    int64_t tmp_pos = 0;
+    if (OB_FAIL(base_header.serialize(tmp_buf, header_size, tmp_pos))) {
+      TRANS_LOG(WARN, "serialize log base header error", K(ret), K(header_size));
+    } else if (OB_FAIL(block_header.serialize(tmp_buf, header_size, tmp_pos))) {
+      TRANS_LOG(WARN, "serialize block header error", K(ret), K(header_size));
+    } else if (OB_UNLIKELY(tmp_pos != header_size)) {
+      ret = OB_ERR_UNEXPECTED;
+      TRANS_LOG(WARN, "unexpected header size", K(ret), K(tmp_pos), K(header_size));
+    } else {
+      compressed_buf = tmp_buf;
+      compressed_size = header_size + body_compressed_size;
+    }
+  }
+
+  if (OB_NOT_NULL(tmp_buf) && tmp_buf != compressed_buf) {
+    ob_free(tmp_buf);
+    tmp_buf = nullptr;
+  }
+  return ret;
+}
+
 ObTxLogBlock::~ObTxLogBlock()
 {
   reset();
@@ -24,6 +24,7 @@
 #include "logservice/ob_log_base_type.h"
 #include "logservice/ob_log_base_header.h"
 #include "logservice/palf/lsn.h"
+#include "lib/compress/ob_compress_util.h"
 //#include <cstdint>
 
 namespace oceanbase
@@ -878,6 +879,8 @@ public:
     org_cluster_id_ = 0;
     log_entry_no_ = 0;
     tx_id_ = 0;
+    compressor_type_ = 0;
+    org_body_size_ = 0;
   }
   ObTxLogBlockHeader()
   {
@@ -887,7 +890,8 @@ public:
   ObTxLogBlockHeader(const uint64_t org_cluster_id,
                      const int64_t log_entry_no,
                      const ObTransID &tx_id)
-      : org_cluster_id_(org_cluster_id), log_entry_no_(log_entry_no), tx_id_(tx_id)
+      : org_cluster_id_(org_cluster_id), log_entry_no_(log_entry_no), tx_id_(tx_id),
+        compressor_type_(0), org_body_size_(0)
   {
     before_serialize();
   }
@@ -896,9 +900,21 @@ public:
   int64_t get_log_entry_no() const { return log_entry_no_; }
   const ObTransID &get_tx_id() const { return tx_id_; }
 
+  // the tx logs behind the block header are compressed with compressor_type_,
+  // org_body_size_ is their size before compression
+  void set_compress_info(const common::ObCompressorType compressor_type,
+                         const int64_t org_body_size);
+  bool is_compressed() const { return 0 != compressor_type_; }
+  common::ObCompressorType get_compressor_type() const
+  {
+    return static_cast<common::ObCompressorType>(compressor_type_);
+  }
+  int64_t get_org_body_size() const { return org_body_size_; }
+
   bool is_valid() const { return org_cluster_id_ >= 0; }
 
-  TO_STRING_KV(K_(org_cluster_id), K_(log_entry_no), K_(tx_id));
+  TO_STRING_KV(K_(org_cluster_id), K_(log_entry_no), K_(tx_id), K_(compressor_type),
+               K_(org_body_size));
 
 private:
   int before_serialize();
@@ -908,6 +924,8 @@ private:
   uint64_t org_cluster_id_;
   int64_t log_entry_no_;
   ObTransID tx_id_;
+  int64_t compressor_type_;
+  int64_t org_body_size_;
 };
 
 class ObTxLogBlock
@@ -916,6 +934,11 @@ public:
   // static const int MIN_LOG_BLOCK_HEADER_SIZE;
   static const logservice::ObLogBaseType DEFAULT_LOG_BLOCK_TYPE; // TRANS_LOG
   static const int32_t DEFAULT_BIG_ROW_BLOCK_SIZE;
+  // log blocks whose tx logs are smaller than it are never compressed
+  static const int64_t MIN_COMPRESS_BODY_SIZE;
+  // the observers before it can not decompress the log block, so it is
+  // never compressed until all observers have been upgraded
+  static const uint64_t MIN_COMPRESS_CLUSTER_VERSION;
 
   NEED_SERIALIZE_AND_DESERIALIZE;
   ObTxLogBlock();
@@ -948,12 +971,29 @@ public:
   int rewrite_barrier_log_block(int64_t replay_hint,
                                 const enum logservice::ObReplayBarrierType barrier_type);
 
+  // Compress the tx logs behind the block header of a filled log block.
+  // compressed_buf is allocated by ob_malloc and must be released with ob_free by the
+  // caller. It is set to NULL if the compressed block is not smaller than the origin one.
+  static int compress_log_block(const char *buf,
+                                const int64_t size,
+                                const common::ObCompressorType compressor_type,
+                                char *&compressed_buf,
+                                int64_t &compressed_size);
+  // whether the log block of size is compressed by compressor_type when the min cluster
+  // version is min_cluster_version
+  static bool need_compress(const uint64_t min_cluster_version,
+                            const common::ObCompressorType compressor_type,
+                            const int64_t size);
+  // whether the replay buf is decompressed from a compressed log block
+  bool is_decompressed() const { return OB_NOT_NULL(decompress_buf_); }
+
   TO_STRING_KV(KP(fill_buf_),
                KP(replay_buf_),
                K(len_),
                K(pos_),
                K(cur_log_type_),
-               K(cb_arg_array_));
+               K(cb_arg_array_),
+               KP(decompress_buf_));
 
 public:
   // get fill buf for submit log
@@ -962,6 +1002,7 @@ public:
 private:
   int serialize_log_block_header_(const int64_t replay_hint, const ObTxLogBlockHeader &block_header);
   int deserialize_log_block_header_(int64_t &replay_hint, ObTxLogBlockHeader &block_header);
+  int decompress_if_need_(const ObTxLogBlockHeader &block_header);
   int update_next_log_pos_(); // skip log body if  cur_log_type_ is UNKNOWN (depend on
                               // DESERIALIZE_HEADER in ob_unify_serialize.h)
   DISALLOW_COPY_AND_ASSIGN(ObTxLogBlock);
@@ -972,6 +1013,7 @@ private:
   int64_t pos_;
   ObTxLogType cur_log_type_;
   ObTxCbArgArray cb_arg_array_;
+  char *decompress_buf_;
 };
 
 template <typename T>
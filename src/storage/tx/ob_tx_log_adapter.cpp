@@ -13,6 +13,10 @@
 #include "storage/tx/ob_tx_log_adapter.h"
 #include "storage/tx_storage/ob_ls_service.h"
 #include "storage/tx_storage/ob_ls_handle.h"  //ObLSHandle
+#include "storage/tx/ob_tx_log.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
+#include "lib/compress/ob_compressor_pool.h"
+#include "share/ob_cluster_version.h"
 
 namespace oceanbase
 {
@@ -42,12 +46,20 @@ int ObLSTxLogAdapter::submit_log(const char *buf,
   int ret = OB_SUCCESS;
   palf::LSN lsn;
   int64_t ts = 0;
+  char *compressed_buf = NULL;
+  int64_t compressed_size = 0;
 
   if (OB_ISNULL(log_handler_) || !log_handler_->is_valid() || NULL == buf || 0 == size
       || base_ts > ObTimeUtility::current_time_ns() + 86400000000000L) {
     ret = OB_INVALID_ARGUMENT;
     TRANS_LOG(WARN, "invalid argument", K(ret), KP(log_handler_), KP(buf), K(size), K(base_ts));
-  } else if (OB_FAIL(log_handler_->append(buf, size, base_ts, need_nonblock, cb, lsn, ts))) {
+  } else if (OB_NOT_NULL(compressed_buf = compress_if_need_(buf, size, compressed_size))
+             && OB_FAIL(log_handler_->append(compressed_buf, compressed_size, base_ts,
+                                             need_nonblock, cb, lsn, ts))) {
+    TRANS_LOG(WARN, "append compressed log to palf failed", K(ret), KP(log_handler_), KP(buf),
+              K(size), K(compressed_size), K(base_ts), K(need_nonblock));
+  } else if (OB_ISNULL(compressed_buf)
+             && OB_FAIL(log_handler_->append(buf, size, base_ts, need_nonblock, cb, lsn, ts))) {
     TRANS_LOG(WARN, "append log to palf failed", K(ret), KP(log_handler_), KP(buf), K(size), K(base_ts),
               K(need_nonblock));
   } else {
@@ -57,11 +69,67 @@ int ObLSTxLogAdapter::submit_log(const char *buf,
     ObTransStatistic::get_instance().add_clog_submit_count(MTL_ID(), 1);
     ObTransStatistic::get_instance().add_trans_log_total_size(MTL_ID(), size);
   }
+  // palf has copied the log into its own buffer
+  if (OB_NOT_NULL(compressed_buf)) {
+    ob_free(compressed_buf);
+    compressed_buf = NULL;
+  }
   TRANS_LOG(DEBUG, "ObLSTxLogAdapter::submit_ls_log", KR(ret), KP(cb));
 
   return ret;
 }
 
+common::ObCompressorType ObLSTxLogAdapter::get_compressor_type_()
+{
+  const int64_t now = ObTimeUtility::current_time();
+  if (now - ATOMIC_LOAD(&last_refresh_compress_config_ts_) > REFRESH_COMPRESS_CONFIG_INTERVAL) {
+    int tmp_ret = OB_SUCCESS;
+    common::ObCompressorType compressor_type = common::NONE_COMPRESSOR;
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    if (tenant_config.is_valid() && tenant_config->enable_clog_persistence_compress) {
+      if (OB_TMP_FAIL(common::ObCompressorPool::get_instance().get_compressor_type(
+              tenant_config->clog_persistence_compress_func.str(), compressor_type))) {
+        TRANS_LOG(WARN, "get compressor type failed", K(tmp_ret),
+                  K(tenant_config->clog_persistence_compress_func.str()));
+        compressor_type = common::NONE_COMPRESSOR;
+      }
+    }
+    ATOMIC_STORE(&compressor_type_, compressor_type);
+    ATOMIC_STORE(&last_refresh_compress_config_ts_, now);
+  }
+  return ATOMIC_LOAD(&compressor_type_);
+}
+
+char *ObLSTxLogAdapter::compress_if_need_(const char *buf,
+                                          const int64_t size,
+                                          int64_t &compressed_size)
+{
+  int tmp_ret = OB_SUCCESS;
+  char *compressed_buf = NULL;
+  const common::ObCompressorType compressor_type = get_compressor_type_();
+
+  compressed_size = 0;
+  if (!ObTxLogBlock::need_compress(GET_MIN_CLUSTER_VERSION(), compressor_type, size)) {
+    // do nothing
+  } else {
+    const int64_t start_ts = ObTimeUtility::current_time();
+    if (OB_TMP_FAIL(ObTxLogBlock::compress_log_block(buf, size, compressor_type, compressed_buf,
+                                                     compressed_size))) {
+      // fall back to the origin log block
+      TRANS_LOG(WARN, "compress log block failed", K(tmp_ret), K(size), K(compressor_type));
+      compressed_buf = NULL;
+    } else if (OB_NOT_NULL(compressed_buf)) {
+      const uint64_t tenant_id = MTL_ID();
+      ObTransStatistic::get_instance().add_trans_log_compress_count(tenant_id, 1);
+      ObTransStatistic::get_instance().add_trans_log_compress_origin_size(tenant_id, size);
+      ObTransStatistic::get_instance().add_trans_log_compressed_size(tenant_id, compressed_size);
+      ObTransStatistic::get_instance().add_trans_log_compress_time(
+          tenant_id, ObTimeUtility::current_time() - start_ts);
+    }
+  }
+  return compressed_buf;
+}
+
 int ObLSTxLogAdapter::get_role(bool &is_leader, int64_t &epoch)
 {
   int ret = OB_SUCCESS;
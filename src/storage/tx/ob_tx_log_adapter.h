@@ -16,6 +16,7 @@
 #include "share/ob_define.h"
 #include "logservice/ob_log_handler.h"
 #include "ob_trans_submit_log_cb.h"
+#include "lib/compress/ob_compress_util.h"
 
 namespace oceanbase
 {
@@ -60,7 +61,11 @@ private:
 class ObLSTxLogAdapter : public ObITxLogAdapter
 {
 public:
-  ObLSTxLogAdapter() : log_handler_(nullptr) {}
+  ObLSTxLogAdapter()
+      : log_handler_(nullptr),
+        compressor_type_(common::NONE_COMPRESSOR),
+        last_refresh_compress_config_ts_(0)
+  {}
 
   int init(ObITxLogParam *param);
   int submit_log(const char *buf,
@@ -70,8 +75,18 @@ public:
                  const bool need_nonblock);
   int get_role(bool &is_leader, int64_t &epoch);
 
+private:
+  static const int64_t REFRESH_COMPRESS_CONFIG_INTERVAL = 1 * 1000 * 1000; // 1s
+  common::ObCompressorType get_compressor_type_();
+  // returns the compressed log block to submit, or NULL if the origin one should be submitted
+  char *compress_if_need_(const char *buf, const int64_t size, int64_t &compressed_size);
+
 private:
   logservice::ObLogHandler *log_handler_;
+  // cached from the tenant config enable_clog_persistence_compress and
+  // clog_persistence_compress_func
+  common::ObCompressorType compressor_type_;
+  int64_t last_refresh_compress_config_ts_;
 };
 
 } // namespace transaction
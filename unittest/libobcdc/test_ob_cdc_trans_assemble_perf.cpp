@@ -0,0 +1,243 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * This file defines test_ob_cdc_trans_assemble_perf.cpp
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include <iostream>
+#include <vector>
+
+#include "log_generator.h" // must at last of header list
+#include "share/ob_define.h"
+#include "logservice/libobcdc/src/ob_log_utils.h"
+#include "logservice/libobcdc/src/ob_log_ls_fetch_ctx.h"
+#include "logservice/libobcdc/src/ob_log_ls_fetch_mgr.h"
+#include "logservice/libobcdc/src/ob_log_entry_task_pool.h"
+#include "logservice/libobcdc/src/ob_log_part_progress_controller.h"
+#include "logservice/libobcdc/src/ob_log_part_trans_resolver_factory.h"
+#include "logservice/libobcdc/src/ob_log_sys_ls_task_handler.h"
+#include "logservice/libobcdc/src/ob_log_cluster_id_filter.h"
+#include "logservice/libobcdc/src/ob_log_committer.h"
+#include "logservice/libobcdc/src/ob_log_fetcher_dispatcher.h"
+#include "logservice/libobcdc/src/ob_log_instance.h"
+#include "logservice/libobcdc/src/ob_log_resource_collector.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+using namespace transaction;
+
+// Benchmark of the transaction assembly of libobcdc without a live cluster, the logs of large
+// transactions are generated by ObTxLogGenerator and read by LSFetchCtx, which resolves the redo
+// of every transaction into a PartTransTask and dispatches it when the commit log is read.
+// The throughput of the log entries and the redo logs is printed.
+//
+// usage: test_ob_cdc_trans_assemble_perf [-t trans_count] [-e log_entry_count] [-r redo_count] [-l log_level]
+//   -e: log entries of each transaction
+//   -r: redo logs of each log entry
+namespace oceanbase
+{
+namespace libobcdc
+{
+class PerfFetcherDispatcher : public ObLogFetcherDispatcher
+{
+public:
+  PerfFetcherDispatcher() : dispatched_trans_cnt_(0) {}
+  virtual int dispatch(PartTransTask &task, volatile bool &stop_flag) override
+  {
+    UNUSED(task);
+    UNUSED(stop_flag);
+    dispatched_trans_cnt_++;
+    return OB_SUCCESS;
+  }
+  int64_t dispatched_trans_cnt_;
+};
+class PerfResourceCollector : public ObLogResourceCollector
+{
+  virtual int revert(PartTransTask *task)
+  {
+    UNUSED(task);
+    return OB_SUCCESS;
+  }
+};
+}
+}
+
+namespace test
+{
+static int64_t TRANS_COUNT = 100;
+static int64_t TRANS_LOG_ENTRY_COUNT = 100;
+static int64_t LOG_ENTRY_REDO_COUNT = 10;
+
+static const int64_t PREALLOC_POOL_SIZE = 10 * 1024;
+static const int64_t TRANS_TASK_PAGE_SIZE = 1024;
+static const int64_t PREALLOC_PAGE_COUNT = 1024;
+
+struct TransLog
+{
+  palf::LogEntry log_entry_;
+  palf::LSN lsn_;
+};
+
+int gen_trans_logs(const uint64_t tenant_id,
+    const int64_t ls_id,
+    const uint64_t cluster_id,
+    std::vector<unittest::ObTxLogGenerator *> &generators,
+    std::vector<TransLog *> &logs,
+    int64_t &log_bytes)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < TRANS_COUNT; i++) {
+    unittest::ObTxLogGenerator *generator = new unittest::ObTxLogGenerator(tenant_id, ls_id,
+        100000 + i, cluster_id);
+    generators.push_back(generator);
+    for (int64_t j = 0; OB_SUCC(ret) && j < TRANS_LOG_ENTRY_COUNT; j++) {
+      TransLog *log = new TransLog();
+      logs.push_back(log);
+      for (int64_t k = 0; k < LOG_ENTRY_REDO_COUNT; k++) {
+        generator->gen_redo_log();
+      }
+      if (TRANS_LOG_ENTRY_COUNT - 1 == j) {
+        generator->gen_commit_info_log();
+        generator->gen_commit_log();
+      }
+      if (OB_FAIL(generator->gen_log_entry(log->log_entry_, log->lsn_))) {
+        LOG_ERROR("gen_log_entry failed", KR(ret), K(i), K(j));
+      } else {
+        log_bytes += log->log_entry_.get_serialize_size();
+      }
+    }
+  }
+  return ret;
+}
+
+void run()
+{
+  const uint64_t tenant_id = 1002;
+  const int64_t ls_id = 1001;
+  const uint64_t cluster_id = 1;
+  bool stop_flag = false;
+  TenantLSID tls_id(tenant_id, share::ObLSID(ls_id));
+  IObCDCPartTransResolver::MissingLogInfo missing_info;
+  TransStatInfo tsi;
+  palf::LSN start_lsn(0);
+
+  ObLogInstance *instance = ObLogInstance::get_instance();
+  ObConcurrentFIFOAllocator fifo_allocator;
+  PartProgressController progress_controller;
+  ObLogPartTransResolverFactory resolver_factory;
+  ObLogTransTaskPool<PartTransTask> task_pool;
+  ObLogEntryTaskPool log_entry_task_pool;
+  PerfFetcherDispatcher fetcher_dispatcher;
+  PerfResourceCollector resource_collector;
+  ObLogSysLsTaskHandler sys_ls_handler;
+  ObLogCommitter committer;
+  ObLogClusterIDFilter cluster_id_filter;
+  ObLogLSFetchMgr ls_fetch_mgr;
+  LSFetchCtx *ls_fetch_ctx = NULL;
+  std::vector<unittest::ObTxLogGenerator *> generators;
+  std::vector<TransLog *> logs;
+  int64_t log_bytes = 0;
+  int ret = OB_SUCCESS;
+  instance->resource_collector_ = &resource_collector;
+
+  if (OB_FAIL(progress_controller.init(10))) {
+    LOG_ERROR("init progress_controller failed", KR(ret));
+  } else if (OB_FAIL(fifo_allocator.init(16 * _G_, 16 * _M_, OB_MALLOC_NORMAL_BLOCK_SIZE))) {
+    LOG_ERROR("init fifo_allocator failed", KR(ret));
+  } else if (OB_FAIL(task_pool.init(&fifo_allocator, PREALLOC_POOL_SIZE, TRANS_TASK_PAGE_SIZE, true,
+      PREALLOC_PAGE_COUNT))) {
+    LOG_ERROR("init task_pool failed", KR(ret));
+  } else if (OB_FAIL(log_entry_task_pool.init(10/* fixed_log_entry_task_count */))) {
+    LOG_ERROR("init log_entry_task_pool failed", KR(ret));
+  } else if (OB_FAIL(fetcher_dispatcher.init(&sys_ls_handler, &committer, 0))) {
+    LOG_ERROR("init fetcher_dispatcher failed", KR(ret));
+  } else if (OB_FAIL(cluster_id_filter.init("2147473648", 2147473648, 2147483647))) {
+    LOG_ERROR("init cluster_id_filter failed", KR(ret));
+  } else if (OB_FAIL(resolver_factory.init(task_pool, log_entry_task_pool, fetcher_dispatcher,
+      cluster_id_filter))) {
+    LOG_ERROR("init resolver_factory failed", KR(ret));
+  } else if (OB_FAIL(ls_fetch_mgr.init(1, progress_controller, resolver_factory))) {
+    LOG_ERROR("init ls_fetch_mgr failed", KR(ret));
+  } else if (OB_FAIL(ls_fetch_mgr.add_ls(tls_id, 1/* start_ts_ns */, start_lsn))) {
+    LOG_ERROR("add_ls failed", KR(ret), K(tls_id));
+  } else if (OB_FAIL(ls_fetch_mgr.get_ls_fetch_ctx(tls_id, ls_fetch_ctx))) {
+    LOG_ERROR("get_ls_fetch_ctx failed", KR(ret), K(tls_id));
+  } else if (OB_FAIL(gen_trans_logs(tenant_id, ls_id, cluster_id, generators, logs, log_bytes))) {
+    LOG_ERROR("gen_trans_logs failed", KR(ret));
+  } else {
+    const int64_t begin_ts = ObTimeUtility::current_time();
+    for (int64_t i = 0; OB_SUCC(ret) && i < (int64_t)logs.size(); i++) {
+      if (OB_FAIL(ls_fetch_ctx->read_log(logs[i]->log_entry_, logs[i]->lsn_, missing_info, tsi,
+          stop_flag))) {
+        LOG_ERROR("read_log failed", KR(ret), K(i), K(logs[i]->lsn_));
+      }
+    }
+    const int64_t cost = MAX(1, ObTimeUtility::current_time() - begin_ts);
+    const int64_t redo_cnt = (int64_t)logs.size() * LOG_ENTRY_REDO_COUNT;
+    std::cout << "====" << "trans_cnt:" << TRANS_COUNT << ", log_entry_cnt:" << logs.size()
+              << ", redo_cnt:" << redo_cnt << ", log_bytes:" << log_bytes << std::endl;
+    std::cout << "====" << "ret:" << ret
+              << ", dispatched_trans_cnt:" << fetcher_dispatcher.dispatched_trans_cnt_
+              << ", cost(us):" << cost
+              << ", log_entry/s:" << (int64_t)logs.size() * 1000000L / cost
+              << ", redo/s:" << redo_cnt * 1000000L / cost
+              << ", MB/s:" << (double)log_bytes / (double)cost << std::endl;
+  }
+
+  if (OB_SUCCESS != ret) {
+    std::cout << "====" << "run failed, ret:" << ret << std::endl;
+  }
+  if (NULL != ls_fetch_ctx) {
+    (void)ls_fetch_mgr.remove_ls(tls_id);
+  }
+  for (int64_t i = 0; i < (int64_t)logs.size(); i++) {
+    delete logs[i];
+  }
+  for (int64_t i = 0; i < (int64_t)generators.size(); i++) {
+    delete generators[i];
+  }
+  instance->resource_collector_ = NULL;
+  ObLogInstance::destroy_instance();
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("WARN");
+  OB_LOGGER.set_file_name("test_ob_cdc_trans_assemble_perf.log", true);
+  int c = 0;
+  while(-1 != (c = getopt(argc, argv, "t:e:r:l:"))) {
+    switch(c) {
+      case 't':
+        test::TRANS_COUNT = atoll(optarg);
+        break;
+      case 'e':
+        test::TRANS_LOG_ENTRY_COUNT = atoll(optarg);
+        break;
+      case 'r':
+        test::LOG_ENTRY_REDO_COUNT = atoll(optarg);
+        break;
+      case 'l':
+        if (NULL != optarg) {
+          OB_LOGGER.set_log_level(optarg);
+        }
+        break;
+      default:
+        printf("usage: test_ob_cdc_trans_assemble_perf [-t trans_count] [-e log_entry_count] [-r redo_count] [-l log_level]\n");
+        break;
+    }
+  }
+  test::run();
+  return 0;
+}
@@ -0,0 +1,205 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * This file defines test_ob_log_formatter_batch.cpp
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include <gtest/gtest.h>
+#include <vector>
+#define private public
+#include "logservice/libobcdc/src/ob_log_formatter.h"
+#undef private
+#include "logservice/libobcdc/src/ob_log_part_trans_task.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+// Formats a stmt the way the formatter fills the row values: the memory of the values is
+// allocated from the ObLogEntryTask of the stmt, which is shared by the formatter threads when
+// the stmts of the ObLogEntryTask are formatted in batches.
+class BatchFormatter : public ObLogFormatter
+{
+public:
+  static const int64_t THREAD_NUM = 8;
+  static const int64_t ALLOC_CNT = 64;
+  static const int64_t MAX_STMT_CNT = 1024;
+
+  BatchFormatter() : done_(false)
+  {
+    MEMSET(thread_idx_, 0, sizeof(thread_idx_));
+    MEMSET(bufs_, 0, sizeof(bufs_));
+  }
+  virtual ~BatchFormatter() {}
+
+  int init(const int64_t batch_stmt_count)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_FAIL(FormatterThread::init(THREAD_NUM, 10000))) {
+      LOG_ERROR("init formatter thread fail", KR(ret));
+    } else {
+      batch_stmt_count_ = batch_stmt_count;
+      inited_ = true;
+    }
+    return ret;
+  }
+
+  virtual int handle(void *data, const int64_t thread_index, volatile bool &stop_flag) override
+  {
+    UNUSED(stop_flag);
+    int ret = OB_SUCCESS;
+    DmlStmtTask *stmt_task = static_cast<DmlStmtTask *>(data);
+    ObLogEntryTask &log_entry_task = stmt_task->get_redo_log_entry_task();
+    const int64_t stmt_idx = stmt_task->get_row_index();
+    thread_idx_[stmt_idx] = thread_index;
+    for (int64_t i = 0; OB_SUCC(ret) && i < ALLOC_CNT; i++) {
+      const int64_t size = get_size_(stmt_idx, i);
+      char *buf = static_cast<char *>(log_entry_task.get_allocator().alloc(size));
+      if (OB_ISNULL(buf)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+      } else {
+        MEMSET(buf, static_cast<char>(stmt_idx), size);
+        bufs_[stmt_idx][i] = buf;
+      }
+    }
+    if (log_entry_task.inc_formatted_stmt_num() == log_entry_task.get_stmt_num()) {
+      ATOMIC_STORE(&done_, true);
+    }
+    return ret;
+  }
+
+  // every buffer keeps the bytes written by the stmt which allocated it
+  bool check_bufs(const int64_t stmt_cnt) const
+  {
+    bool bret = true;
+    for (int64_t stmt_idx = 0; bret && stmt_idx < stmt_cnt; stmt_idx++) {
+      for (int64_t i = 0; bret && i < ALLOC_CNT; i++) {
+        const char *buf = bufs_[stmt_idx][i];
+        for (int64_t j = 0; bret && j < get_size_(stmt_idx, i); j++) {
+          bret = (NULL != buf && static_cast<char>(stmt_idx) == buf[j]);
+        }
+      }
+    }
+    return bret;
+  }
+
+  int64_t get_used_thread_cnt(const int64_t stmt_cnt) const
+  {
+    bool used[THREAD_NUM] = {false};
+    int64_t cnt = 0;
+    for (int64_t stmt_idx = 0; stmt_idx < stmt_cnt; stmt_idx++) {
+      if (!used[thread_idx_[stmt_idx]]) {
+        used[thread_idx_[stmt_idx]] = true;
+        cnt++;
+      }
+    }
+    return cnt;
+  }
+
+  void wait_done()
+  {
+    while (!ATOMIC_LOAD(&done_)) {
+      ob_usleep(1000);
+    }
+  }
+
+private:
+  static int64_t get_size_(const int64_t stmt_idx, const int64_t i) { return 8 + (stmt_idx + i) % 57; }
+
+public:
+  bool done_;
+  int64_t thread_idx_[MAX_STMT_CNT];
+  char *bufs_[MAX_STMT_CNT][ALLOC_CNT];
+};
+const int64_t BatchFormatter::THREAD_NUM;
+
+class TestObLogFormatterBatch : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    for (int64_t i = 0; i < STMT_CNT; i++) {
+      MutatorRow *row = new MutatorRow(log_entry_task_.get_allocator());
+      DmlStmtTask *stmt_task = new DmlStmtTask(host_, log_entry_task_, *row);
+      ASSERT_EQ(OB_SUCCESS, log_entry_task_.add_stmt(i, stmt_task));
+      rows_.push_back(row);
+      stmt_tasks_.push_back(stmt_task);
+    }
+  }
+  virtual void TearDown()
+  {
+    for (int64_t i = 0; i < STMT_CNT; i++) {
+      delete stmt_tasks_[i];
+      delete rows_[i];
+    }
+  }
+  // push all the stmts of the ObLogEntryTask and wait until they are formatted
+  void format(BatchFormatter &formatter)
+  {
+    volatile bool stop_flag = false;
+    ASSERT_EQ(OB_SUCCESS, formatter.start());
+    ASSERT_EQ(OB_SUCCESS, formatter.push(log_entry_task_.get_stmt_list().head_, stop_flag));
+    formatter.wait_done();
+    formatter.stop();
+    ASSERT_EQ(STMT_CNT, log_entry_task_.formatted_stmt_num_);
+  }
+protected:
+  static const int64_t STMT_CNT = 1000;
+  PartTransTask host_;
+  ObLogEntryTask log_entry_task_;
+  std::vector<MutatorRow *> rows_;
+  std::vector<DmlStmtTask *> stmt_tasks_;
+};
+const int64_t TestObLogFormatterBatch::STMT_CNT;
+
+TEST_F(TestObLogFormatterBatch, format_batches_in_parallel)
+{
+  BatchFormatter *formatter = new BatchFormatter();
+  ASSERT_EQ(OB_SUCCESS, formatter->init(16));
+  format(*formatter);
+  // the batches of one ObLogEntryTask are formatted by all the threads, and the allocations of
+  // the threads from the ObLogEntryTask do not overlap
+  ASSERT_EQ(BatchFormatter::THREAD_NUM, formatter->get_used_thread_cnt(STMT_CNT));
+  ASSERT_TRUE(formatter->check_bufs(STMT_CNT));
+  delete formatter;
+}
+
+TEST_F(TestObLogFormatterBatch, format_in_one_thread)
+{
+  // batch_stmt_count 0 and ObLogEntryTask with fewer stmts than batch_stmt_count
+  const int64_t batch_stmt_counts[] = {0, STMT_CNT};
+  for (int64_t i = 0; i < 2; i++) {
+    log_entry_task_.formatted_stmt_num_ = 0;
+    BatchFormatter *formatter = new BatchFormatter();
+    ASSERT_EQ(OB_SUCCESS, formatter->init(batch_stmt_counts[i]));
+    format(*formatter);
+    ASSERT_EQ(1, formatter->get_used_thread_cnt(STMT_CNT));
+    ASSERT_TRUE(formatter->check_bufs(STMT_CNT));
+    delete formatter;
+  }
+}
+
+} // namespace libobcdc
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_ob_log_formatter_batch.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ *
+ * This file defines test_ob_obj2str_helper.cpp
+ */
+
+#define USING_LOG_PREFIX OBLOG
+
+#include <gtest/gtest.h>
+#define private public
+#include "logservice/libobcdc/src/ob_obj2str_helper.h"
+#undef private
+#include "logservice/libobcdc/src/ob_log_hbase_mode.h"
+#include "logservice/libobcdc/src/ob_log_tenant_mgr.h"
+#include "logservice/libobcdc/src/ob_log_timezone_info_getter.h"
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace libobcdc
+{
+class TestObObj2strHelper : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    // the binary values are output without the tenant and the timezone
+    helper_.enable_output_binary_value_ = true;
+  }
+protected:
+  // obj2str outputs the value of obj in value_len bytes, pointing to obj itself or deep copied
+  void check_binary_value(const ObObj &obj, const void *value, const int64_t value_len)
+  {
+    ObString str;
+    ObArray<ObString> extended_type_info;
+    ObAccuracy accuracy;
+    ASSERT_EQ(OB_SUCCESS, helper_.obj2str(OB_SYS_TENANT_ID, 1, 16, obj, str, allocator_, false,
+        extended_type_info, accuracy, CS_TYPE_BINARY));
+    ASSERT_EQ(value_len, str.length());
+    ASSERT_EQ(0, MEMCMP(value, str.ptr(), value_len));
+    ASSERT_EQ(obj.get_data_ptr(), static_cast<const void *>(str.ptr()));
+
+    // default values are deep copied, they do not point to the schema
+    ASSERT_EQ(OB_SUCCESS, helper_.obj2str(OB_SYS_TENANT_ID, 1, 16, obj, str, allocator_, true,
+        extended_type_info, accuracy, CS_TYPE_BINARY));
+    ASSERT_EQ(value_len, str.length());
+    ASSERT_EQ(0, MEMCMP(value, str.ptr(), value_len));
+    ASSERT_NE(obj.get_data_ptr(), static_cast<const void *>(str.ptr()));
+  }
+protected:
+  ObObj2strHelper helper_;
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestObObj2strHelper, int_tc)
+{
+  ObObj obj;
+  const int64_t int_value = -1234567890123L;
+  obj.set_int(int_value);
+  check_binary_value(obj, &int_value, sizeof(int64_t));
+  // all int types are kept in int64_t
+  const int64_t tinyint_value = -12;
+  obj.set_tinyint(static_cast<int8_t>(tinyint_value));
+  check_binary_value(obj, &tinyint_value, sizeof(int64_t));
+}
+
+TEST_F(TestObObj2strHelper, uint_tc)
+{
+  ObObj obj;
+  const uint64_t uint_value = UINT64_MAX - 1;
+  obj.set_uint64(uint_value);
+  check_binary_value(obj, &uint_value, sizeof(uint64_t));
+  const uint64_t utinyint_value = 200;
+  obj.set_utinyint(static_cast<uint8_t>(utinyint_value));
+  check_binary_value(obj, &utinyint_value, sizeof(uint64_t));
+}
+
+TEST_F(TestObObj2strHelper, float_tc)
+{
+  ObObj obj;
+  const float float_value = -3.25f;
+  obj.set_float(float_value);
+  check_binary_value(obj, &float_value, sizeof(float));
+}
+
+TEST_F(TestObObj2strHelper, double_tc)
+{
+  ObObj obj;
+  const double double_value = 1.0 / 3;
+  obj.set_double(double_value);
+  check_binary_value(obj, &double_value, sizeof(double));
+}
+
+TEST_F(TestObObj2strHelper, datetime_tc)
+{
+  ObObj obj;
+  const int64_t datetime_value = 1700000000123456L;
+  obj.set_datetime(datetime_value);
+  check_binary_value(obj, &datetime_value, sizeof(int64_t));
+  obj.set_timestamp(datetime_value);
+  check_binary_value(obj, &datetime_value, sizeof(int64_t));
+}
+
+TEST_F(TestObObj2strHelper, date_tc)
+{
+  ObObj obj;
+  const int32_t date_value = 19675;
+  obj.set_date(date_value);
+  check_binary_value(obj, &date_value, sizeof(int32_t));
+}
+
+TEST_F(TestObObj2strHelper, time_tc)
+{
+  ObObj obj;
+  const int64_t time_value = -3723000000L;
+  obj.set_time(time_value);
+  check_binary_value(obj, &time_value, sizeof(int64_t));
+}
+
+TEST_F(TestObObj2strHelper, year_tc)
+{
+  ObObj obj;
+  const uint8_t year_value = 124;
+  obj.set_year(year_value);
+  check_binary_value(obj, &year_value, sizeof(uint8_t));
+}
+
+TEST_F(TestObObj2strHelper, binary_value_with_hbase_mode)
+{
+  ObObj2strHelper helper;
+  ObLogTimeZoneInfoGetter timezone_info_getter;
+  ObLogHbaseUtil hbase_util;
+  ObLogTenantMgr tenant_mgr;
+  // the T column of hbase table is converted by its string
+  ASSERT_EQ(OB_NOT_SUPPORTED, helper.init(timezone_info_getter, hbase_util, true, false, false, true,
+      tenant_mgr));
+  ASSERT_FALSE(helper.inited_);
+  // T column is not converted in backup mode
+  ASSERT_EQ(OB_SUCCESS, helper.init(timezone_info_getter, hbase_util, true, false, true, true,
+      tenant_mgr));
+  ASSERT_TRUE(helper.enable_output_binary_value_);
+}
+
+} // namespace libobcdc
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_ob_obj2str_helper.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,122 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "logservice/palf/log_define.h"
+#include "logservice/palf/log_group_commit_controller.h"
+#include <gtest/gtest.h>
+
+namespace oceanbase
+{
+using namespace common;
+using namespace palf;
+
+namespace unittest
+{
+
+TEST(TestLogGroupCommitController, test_fast_device)
+{
+  LogGroupCommitController controller;
+  EXPECT_EQ(OB_SUCCESS, controller.init(2 * 1000));
+  EXPECT_EQ(OB_INIT_TWICE, controller.init(2 * 1000));
+  int64_t ts = 1000;
+  // write is cheaper than MIN_IO_COST_TO_WAIT_US, never wait
+  for (int64_t i = 0; i < 100; i++) {
+    controller.on_task_arrival(ts);
+    controller.on_task_arrival(ts + 5);
+    controller.on_batch_flushed(2, 0, 20);
+    ts += 10;
+  }
+  EXPECT_EQ(0, controller.get_batch_window_us());
+  EXPECT_EQ(100, controller.get_batch_size_histogram().get_total_count());
+  EXPECT_EQ(2, controller.get_batch_size_histogram().get_avg_value());
+}
+
+TEST(TestLogGroupCommitController, test_slow_device)
+{
+  LogGroupCommitController controller;
+  EXPECT_EQ(OB_SUCCESS, controller.init(2 * 1000));
+  int64_t ts = 1000;
+  // tasks arrive every 50us, a write costs 800us
+  for (int64_t i = 0; i < 100; i++) {
+    controller.on_task_arrival(ts);
+    controller.on_batch_flushed(1, 0, 800);
+    ts += 50;
+  }
+  EXPECT_EQ(400, controller.get_batch_window_us());
+  EXPECT_LE(controller.get_batch_window_us(), LogGroupCommitController::MAX_BATCH_WINDOW_US);
+
+  // tasks arrive slower than one write, waiting is useless
+  for (int64_t i = 0; i < 100; i++) {
+    controller.on_task_arrival(ts);
+    controller.on_batch_flushed(1, 0, 800);
+    ts += 5000;
+  }
+  EXPECT_EQ(0, controller.get_batch_window_us());
+}
+
+TEST(TestLogGroupCommitController, test_target_latency)
+{
+  LogGroupCommitController controller;
+  EXPECT_EQ(OB_SUCCESS, controller.init(1000));
+  int64_t ts = 1000;
+  // window is bounded by target latency minus write latency
+  for (int64_t i = 0; i < 100; i++) {
+    controller.on_task_arrival(ts);
+    controller.on_batch_flushed(1, 0, 800);
+    ts += 50;
+  }
+  EXPECT_EQ(200, controller.get_batch_window_us());
+
+  LogGroupCommitController disabled;
+  EXPECT_EQ(OB_SUCCESS, disabled.init(0));
+  for (int64_t i = 0; i < 100; i++) {
+    disabled.on_task_arrival(ts);
+    disabled.on_batch_flushed(1, 0, 800);
+    ts += 50;
+  }
+  EXPECT_EQ(0, disabled.get_batch_window_us());
+}
+
+TEST(TestLogGroupCommitController, test_update_target_latency)
+{
+  LogGroupCommitController controller;
+  EXPECT_EQ(OB_SUCCESS, controller.init(2 * 1000));
+  int64_t ts = 1000;
+  for (int64_t i = 0; i < 100; i++) {
+    controller.on_task_arrival(ts);
+    controller.on_batch_flushed(1, 0, 800);
+    ts += 50;
+  }
+  EXPECT_EQ(400, controller.get_batch_window_us());
+  // the target latency is updated by tenant config
+  controller.set_target_commit_latency_us(0);
+  EXPECT_EQ(0, controller.get_target_commit_latency_us());
+  controller.on_task_arrival(ts);
+  controller.on_batch_flushed(1, 0, 800);
+  EXPECT_EQ(0, controller.get_batch_window_us());
+  controller.set_target_commit_latency_us(1000);
+  controller.on_task_arrival(ts + 50);
+  controller.on_batch_flushed(1, 0, 800);
+  EXPECT_EQ(200, controller.get_batch_window_us());
+}
+
+} // end of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_log_group_commit_controller.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_group_commit_controller");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "logservice/palf/log_define.h"
+#include "logservice/palf/log_hot_cache.h"
+#include "logservice/palf/log_writer_utils.h"
+#include "share/rc/ob_tenant_base.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+using namespace palf;
+
+namespace unittest
+{
+
+class TestLogHotCache : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    // init MTL
+    ObTenantBase tbase(1001);
+    ObTenantEnv::set_tenant(&tbase);
+  }
+protected:
+  static constexpr int64_t CACHE_SIZE = 1024;
+  void fill_data(char *buf, const int64_t len, const char c)
+  {
+    memset(buf, c, len);
+  }
+};
+
+TEST_F(TestLogHotCache, test_fill_and_read)
+{
+  LogHotCache cache;
+  char data[CACHE_SIZE];
+  char read_buf[CACHE_SIZE];
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(0), 10, read_buf));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, cache.init(INVALID_PALF_ID, CACHE_SIZE));
+  EXPECT_EQ(OB_SUCCESS, cache.init(1, CACHE_SIZE));
+  EXPECT_EQ(OB_INIT_TWICE, cache.init(1, CACHE_SIZE));
+
+  // fill [100, 400)
+  LogWriteBuf write_buf;
+  fill_data(data, 300, 'a');
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(data, 300));
+  EXPECT_EQ(OB_SUCCESS, cache.fill(LSN(100), write_buf));
+  EXPECT_EQ(OB_SUCCESS, cache.read(LSN(100), 300, read_buf));
+  EXPECT_EQ(0, memcmp(data, read_buf, 300));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(50), 100, read_buf));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(300), 101, read_buf));
+
+  // fill [400, 1200), the cache wraps and [100, 176) is overwritten
+  write_buf.reset();
+  fill_data(data, 400, 'b');
+  fill_data(data + 400, 400, 'c');
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(data, 400));
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(data + 400, 400));
+  EXPECT_EQ(OB_SUCCESS, cache.fill(LSN(400), write_buf));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(100), 100, read_buf));
+  EXPECT_EQ(OB_SUCCESS, cache.read(LSN(176), CACHE_SIZE, read_buf));
+  EXPECT_EQ('a', read_buf[0]);
+  EXPECT_EQ('b', read_buf[400 - 176]);
+  EXPECT_EQ('c', read_buf[800 - 176]);
+  EXPECT_EQ('c', read_buf[CACHE_SIZE - 1]);
+  EXPECT_EQ(2, cache.get_hit_count());
+  EXPECT_EQ(3, cache.get_miss_count());
+  EXPECT_EQ(40, cache.get_hit_ratio());
+}
+
+TEST_F(TestLogHotCache, test_truncate)
+{
+  LogHotCache cache;
+  char data[CACHE_SIZE];
+  char read_buf[CACHE_SIZE];
+  EXPECT_EQ(OB_SUCCESS, cache.init(1, CACHE_SIZE));
+  LogWriteBuf write_buf;
+  fill_data(data, 500, 'a');
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(data, 500));
+  EXPECT_EQ(OB_SUCCESS, cache.fill(LSN(0), write_buf));
+
+  // truncate suffix, the log before 'lsn' is still cached, and new log
+  // overwrites the truncated part
+  cache.truncate(LSN(200));
+  EXPECT_EQ(OB_SUCCESS, cache.read(LSN(0), 200, read_buf));
+  EXPECT_EQ('a', read_buf[199]);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(100), 101, read_buf));
+  write_buf.reset();
+  fill_data(data, 100, 'b');
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(data, 100));
+  EXPECT_EQ(OB_SUCCESS, cache.fill(LSN(200), write_buf));
+  EXPECT_EQ(OB_SUCCESS, cache.read(LSN(150), 100, read_buf));
+  EXPECT_EQ('a', read_buf[0]);
+  EXPECT_EQ('b', read_buf[50]);
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(250), 100, read_buf));
+
+  // truncate prefix, 'begin_lsn_' never moves backward
+  cache.truncate_prefix(LSN(250));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(200), 10, read_buf));
+  EXPECT_EQ(OB_SUCCESS, cache.read(LSN(250), 50, read_buf));
+  cache.truncate_prefix(LSN(100));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(200), 10, read_buf));
+  EXPECT_EQ(OB_SUCCESS, cache.read(LSN(250), 50, read_buf));
+  cache.truncate_prefix(LSN(1000));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(250), 50, read_buf));
+
+  // not continuous with the cached log
+  write_buf.reset();
+  EXPECT_EQ(OB_SUCCESS, write_buf.push_back(data, 100));
+  EXPECT_EQ(OB_SUCCESS, cache.fill(LSN(2000), write_buf));
+  EXPECT_EQ(OB_SUCCESS, cache.read(LSN(2000), 100, read_buf));
+
+  // truncate before the cached range, all cached log is invalid
+  cache.truncate(LSN(1500));
+  EXPECT_EQ(OB_ENTRY_NOT_EXIST, cache.read(LSN(2000), 100, read_buf));
+  EXPECT_EQ(OB_SUCCESS, cache.fill(LSN(1500), write_buf));
+  EXPECT_EQ(OB_SUCCESS, cache.read(LSN(1500), 100, read_buf));
+}
+
+} // end of unittest
+} // end of oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_log_hot_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  PALF_LOG(INFO, "begin unittest::test_log_hot_cache");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,257 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SERVER
+
+#include <gtest/gtest.h>
+#include "lib/utility/ob_test_util.h"
+#include "lib/allocator/page_arena.h"
+#include "observer/mysql/obsm_row.h"
+#include "sql/engine/expr/ob_expr.h"
+#include "sql/engine/ob_exec_context.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace obmysql;
+using namespace sql;
+
+namespace unittest
+{
+
+class TestObSMRow : public ::testing::Test
+{
+public:
+  TestObSMRow()
+    : alloc_(ObModIds::TEST),
+      exec_ctx_(alloc_),
+      eval_ctx_(exec_ctx_),
+      dtc_params_()
+  {}
+  virtual void SetUp() override
+  {
+    init_exprs();
+    fill_batch();
+  }
+protected:
+  static const int64_t BATCH_SIZE = 4;
+  // reserved for the value of each datum, enough for a number
+  static const int64_t DATUM_RES_SIZE = 64;
+  enum Column { INT_COL = 0, UINT_COL, NUMBER_COL, VARCHAR_COL, DOUBLE_COL, CONST_COL, COLS };
+
+  void add_expr(const ObObjType type, const bool batch_result, int64_t &pos)
+  {
+    ObExpr *expr = new (alloc_.alloc(sizeof(ObExpr))) ObExpr();
+    ASSERT_EQ(OB_SUCCESS, exprs_.push_back(expr));
+    expr->frame_idx_ = 0;
+    expr->datum_off_ = pos;
+    pos += sizeof(ObDatum) * BATCH_SIZE;
+    expr->eval_info_off_ = pos;
+    pos += sizeof(ObEvalInfo);
+    expr->batch_result_ = batch_result;
+    expr->datum_meta_.type_ = type;
+    expr->datum_meta_.cs_type_ = ob_is_string_type(type) ? CS_TYPE_UTF8MB4_GENERAL_CI : CS_TYPE_BINARY;
+    expr->obj_meta_.set_type(type);
+    expr->obj_meta_.set_collation_type(expr->datum_meta_.cs_type_);
+    expr->obj_datum_map_ = ObDatum::get_obj_datum_map_type(type);
+    ObDatum *datums = expr->locate_batch_datums(eval_ctx_);
+    for (int64_t j = 0; j < BATCH_SIZE; j++) {
+      datums[j].ptr_ = eval_ctx_.frames_[0] + pos;
+      pos += DATUM_RES_SIZE;
+    }
+
+    ObField field;
+    field.type_.set_type(type);
+    field.accuracy_.set_scale(NUMBER_COL == exprs_.count() - 1 ? 2 : -1);
+    ASSERT_EQ(OB_SUCCESS, fields_.push_back(field));
+  }
+
+  void init_exprs()
+  {
+    int64_t pos = 0;
+    const int64_t frame_size = (sizeof(ObDatum) + sizeof(ObEvalInfo) + DATUM_RES_SIZE) * COLS * BATCH_SIZE;
+    eval_ctx_.frames_ = static_cast<char **>(alloc_.alloc(sizeof(char *)));
+    ASSERT_TRUE(NULL != eval_ctx_.frames_);
+    eval_ctx_.frames_[0] = static_cast<char *>(alloc_.alloc(frame_size));
+    ASSERT_TRUE(NULL != eval_ctx_.frames_[0]);
+    memset(eval_ctx_.frames_[0], 0, frame_size);
+    eval_ctx_.set_max_batch_size(BATCH_SIZE);
+    add_expr(ObIntType, true, pos);
+    add_expr(ObUInt64Type, true, pos);
+    add_expr(ObNumberType, true, pos);
+    add_expr(ObVarcharType, true, pos);
+    add_expr(ObDoubleType, true, pos);
+    // not batch result, all rows share the first datum
+    add_expr(ObIntType, false, pos);
+  }
+
+  void fill_batch()
+  {
+    const char *strs[BATCH_SIZE] = {"abc", "", "oceanbase", NULL};
+    const char *nmbs[BATCH_SIZE] = {"3.14", "-100", NULL, "0.5"};
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      ObDatum &int_datum = exprs_.at(INT_COL)->locate_batch_datums(eval_ctx_)[i];
+      ObDatum &uint_datum = exprs_.at(UINT_COL)->locate_batch_datums(eval_ctx_)[i];
+      ObDatum &nmb_datum = exprs_.at(NUMBER_COL)->locate_batch_datums(eval_ctx_)[i];
+      ObDatum &str_datum = exprs_.at(VARCHAR_COL)->locate_batch_datums(eval_ctx_)[i];
+      ObDatum &double_datum = exprs_.at(DOUBLE_COL)->locate_batch_datums(eval_ctx_)[i];
+      if (1 == i) {
+        int_datum.set_null();
+      } else {
+        int_datum.set_int(i * 1000 - 2000);
+      }
+      uint_datum.set_uint(UINT64_MAX - i);
+      if (NULL == nmbs[i]) {
+        nmb_datum.set_null();
+      } else {
+        number::ObNumber nmb;
+        ASSERT_EQ(OB_SUCCESS, nmb.from(nmbs[i], alloc_));
+        nmb_datum.set_number(nmb);
+      }
+      if (NULL == strs[i]) {
+        str_datum.set_null();
+      } else {
+        str_datum.set_string(strs[i], static_cast<int32_t>(strlen(strs[i])));
+      }
+      double_datum.set_double(1.5 * static_cast<double>(i));
+    }
+    exprs_.at(CONST_COL)->locate_batch_datums(eval_ctx_)[0].set_int(42);
+  }
+
+  // convert the row of the batch to ObObj cells, as ObBatchRowIter does
+  void to_new_row(const int64_t row_idx, ObObj *cells, ObNewRow &row)
+  {
+    for (int64_t i = 0; i < COLS; i++) {
+      const ObExpr *expr = exprs_.at(i);
+      const ObDatum &datum = expr->locate_batch_datums(eval_ctx_)[expr->is_batch_result() ? row_idx : 0];
+      ASSERT_EQ(OB_SUCCESS, datum.to_obj(cells[i], expr->obj_meta_, expr->obj_datum_map_));
+    }
+    row.cells_ = cells;
+    row.count_ = COLS;
+  }
+
+  void check_equal(const MYSQL_PROTOCOL_TYPE type)
+  {
+    ObSMDatumRow datum_row(type, exprs_, eval_ctx_, dtc_params_, &fields_);
+    ASSERT_EQ(OB_SUCCESS, datum_row.prepare_batch());
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      ObObj cells[COLS];
+      ObNewRow new_row;
+      to_new_row(i, cells, new_row);
+      ObSMRow sm_row(type, new_row, dtc_params_, &fields_);
+      char datum_buf[BUF_SIZE];
+      char obj_buf[BUF_SIZE];
+      int64_t datum_pos = 0;
+      int64_t obj_pos = 0;
+      datum_row.set_row_idx(i);
+      ASSERT_EQ(OB_SUCCESS, datum_row.serialize(datum_buf, BUF_SIZE, datum_pos));
+      ASSERT_EQ(OB_SUCCESS, sm_row.serialize(obj_buf, BUF_SIZE, obj_pos));
+      ASSERT_EQ(obj_pos, datum_pos);
+      ASSERT_EQ(0, MEMCMP(obj_buf, datum_buf, datum_pos));
+    }
+  }
+protected:
+  static const int64_t BUF_SIZE = 1024;
+  ObArenaAllocator alloc_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObDataTypeCastParams dtc_params_;
+  ObSEArray<ObExpr *, COLS> exprs_;
+  ObSEArray<ObField, COLS> fields_;
+};
+
+TEST_F(TestObSMRow, text_round_trip)
+{
+  const char *expect[BATCH_SIZE][COLS] = {
+    {"-2000", "18446744073709551615", "3.14", "abc", "0", "42"},
+    {NULL, "18446744073709551614", "-100.00", "", "1.5", "42"},
+    {"0", "18446744073709551613", NULL, "oceanbase", "3", "42"},
+    {"1000", "18446744073709551612", "0.50", NULL, "4.5", "42"},
+  };
+  ObSMDatumRow datum_row(TEXT, exprs_, eval_ctx_, dtc_params_, &fields_);
+  ASSERT_EQ(OB_SUCCESS, datum_row.prepare_batch());
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    char buf[BUF_SIZE];
+    int64_t pos = 0;
+    datum_row.set_row_idx(i);
+    ASSERT_EQ(OB_SUCCESS, datum_row.serialize(buf, BUF_SIZE, pos));
+    // decode the length encoded strings
+    const char *ptr = buf;
+    for (int64_t j = 0; j < COLS; j++) {
+      uint64_t length = 0;
+      ASSERT_EQ(OB_SUCCESS, ObMySQLUtil::get_length(ptr, length));
+      if (NULL == expect[i][j]) {
+        ASSERT_EQ(ObMySQLUtil::NULL_, length);
+      } else {
+        ASSERT_EQ(strlen(expect[i][j]), length) << "row " << i << " col " << j;
+        ASSERT_EQ(0, MEMCMP(expect[i][j], ptr, length)) << "row " << i << " col " << j;
+        ptr += length;
+      }
+    }
+    ASSERT_EQ(pos, ptr - buf);
+  }
+
+  // the buffer is not enough
+  char small_buf[8];
+  int64_t pos = 0;
+  datum_row.set_row_idx(0);
+  ASSERT_EQ(OB_SIZE_OVERFLOW, datum_row.serialize(small_buf, sizeof(small_buf), pos));
+  ASSERT_EQ(0, pos);
+}
+
+TEST_F(TestObSMRow, same_as_obj_row)
+{
+  check_equal(TEXT);
+  check_equal(BINARY);
+}
+
+TEST_F(TestObSMRow, check_supported)
+{
+  bool supported = false;
+  ASSERT_EQ(OB_SUCCESS, ObSMDatumRow::check_supported(TEXT, exprs_, fields_, CHARSET_UTF8MB4, supported));
+  ASSERT_TRUE(supported);
+  ASSERT_EQ(OB_SUCCESS, ObSMDatumRow::check_supported(BINARY, exprs_, fields_, CHARSET_UTF8MB4, supported));
+  ASSERT_TRUE(supported);
+
+  // the strings are converted to the charset of the results
+  ASSERT_EQ(OB_SUCCESS, ObSMDatumRow::check_supported(TEXT, exprs_, fields_, CHARSET_GBK, supported));
+  ASSERT_FALSE(supported);
+  ASSERT_EQ(OB_SUCCESS, ObSMDatumRow::check_supported(TEXT, exprs_, fields_, CHARSET_BINARY, supported));
+  ASSERT_TRUE(supported);
+
+  // ps protocol casts the cell to the field type
+  fields_.at(INT_COL).type_.set_type(ObVarcharType);
+  ASSERT_EQ(OB_SUCCESS, ObSMDatumRow::check_supported(BINARY, exprs_, fields_, CHARSET_UTF8MB4, supported));
+  ASSERT_FALSE(supported);
+  ASSERT_EQ(OB_SUCCESS, ObSMDatumRow::check_supported(TEXT, exprs_, fields_, CHARSET_UTF8MB4, supported));
+  ASSERT_TRUE(supported);
+
+  // lob is always sent through ObObj
+  exprs_.at(VARCHAR_COL)->datum_meta_.type_ = ObLongTextType;
+  ASSERT_EQ(OB_SUCCESS, ObSMDatumRow::check_supported(TEXT, exprs_, fields_, CHARSET_UTF8MB4, supported));
+  ASSERT_FALSE(supported);
+
+  fields_.pop_back();
+  ASSERT_EQ(OB_SUCCESS, ObSMDatumRow::check_supported(TEXT, exprs_, fields_, CHARSET_UTF8MB4, supported));
+  ASSERT_FALSE(supported);
+}
+
+} // end of namespace unittest
+} // end of namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_obsm_row.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "observer/omt/ob_tenant.h"
+#undef private
+#undef protected
+
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+using namespace oceanbase::omt;
+
+class TestResourceGroupSteal
+    : public ::testing::Test
+{
+public:
+  TestResourceGroupSteal()
+      : group_(OBCG_CLOG, nullptr, nullptr, &cgroup_ctrl_)
+  {}
+
+  virtual void SetUp()
+  {
+    // init() needs a tenant for the token counts, set them directly
+    group_.inited_ = true;
+    group_.set_min_token_cnt(1);
+    group_.set_token_cnt(1);
+    group_.set_max_token_cnt(2);
+    group_.set_ass_token_cnt(1);
+  }
+
+  virtual void TearDown()
+  {
+    ObLink *task = nullptr;
+    while (OB_SUCCESS == group_.req_queue_.pop(task, 0L) && nullptr != task) {
+      task = nullptr;
+    }
+  }
+
+protected:
+  ObCgroupCtrl cgroup_ctrl_;
+  ObResourceGroup group_;
+  ObLink tasks_[4];
+};
+
+TEST_F(TestResourceGroupSteal, idle_group)
+{
+  ASSERT_FALSE(group_.try_acquire_steal_token());
+  ASSERT_EQ(0, group_.stealing_cnt_);
+  group_.inited_ = false;
+  ASSERT_EQ(OB_SUCCESS, group_.req_queue_.push(&tasks_[0], 0));
+  ASSERT_FALSE(group_.try_acquire_steal_token());
+  ASSERT_EQ(0, group_.stealing_cnt_);
+}
+
+TEST_F(TestResourceGroupSteal, token_count)
+{
+  for (int64_t i = 0; i < 4; i++) {
+    ASSERT_EQ(OB_SUCCESS, group_.req_queue_.push(&tasks_[i], 0));
+  }
+  // one group worker and one stealing worker reach max_token_cnt_
+  ASSERT_TRUE(group_.try_acquire_steal_token());
+  ASSERT_EQ(1, group_.stealing_cnt_);
+  ASSERT_FALSE(group_.try_acquire_steal_token());
+  ASSERT_EQ(1, group_.stealing_cnt_);
+
+  // the stolen request is finished
+  group_.release_steal_token();
+  ASSERT_EQ(0, group_.stealing_cnt_);
+  ASSERT_TRUE(group_.try_acquire_steal_token());
+  group_.release_steal_token();
+
+  // the group workers use all the tokens
+  group_.set_ass_token_cnt(2);
+  ASSERT_FALSE(group_.try_acquire_steal_token());
+  ASSERT_EQ(0, group_.stealing_cnt_);
+
+  // more tokens after calibration
+  group_.set_max_token_cnt(4);
+  ASSERT_TRUE(group_.try_acquire_steal_token());
+  ASSERT_TRUE(group_.try_acquire_steal_token());
+  ASSERT_FALSE(group_.try_acquire_steal_token());
+  ASSERT_EQ(2, group_.stealing_cnt_);
+  group_.release_steal_token();
+  group_.release_steal_token();
+  ASSERT_EQ(0, group_.stealing_cnt_);
+}
+
+TEST_F(TestResourceGroupSteal, own_cgroup)
+{
+  ASSERT_EQ(OB_SUCCESS, group_.req_queue_.push(&tasks_[0], 0));
+  // the group runs in its own cgroup, its requests keep its cpu shares
+  cgroup_ctrl_.valid_ = true;
+  ASSERT_FALSE(group_.try_acquire_steal_token());
+  ASSERT_EQ(0, group_.stealing_cnt_);
+  cgroup_ctrl_.valid_ = false;
+  ASSERT_TRUE(group_.try_acquire_steal_token());
+  group_.release_steal_token();
+}
+
+int main(int argc, char *argv[])
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "observer/table/ob_table_api_row_iterator.h"
+#include "observer/table/ob_table_service.h"
+#undef private
+#undef protected
+
+using namespace oceanbase::common;
+using namespace oceanbase::table;
+using namespace oceanbase::observer;
+using namespace oceanbase::share::schema;
+
+class TestTableMultiPut : public ::testing::Test
+{
+public:
+  static const int64_t OP_CNT = 4;
+
+  virtual void SetUp()
+  {
+    // table t(K int primary key, V varchar(128))
+    ObColumnSchemaV2 column;
+    table_schema_.set_tenant_id(OB_SYS_TENANT_ID);
+    table_schema_.set_table_id(500001);
+    column.set_table_id(500001);
+    column.set_column_id(16);
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name("K"));
+    column.set_data_type(ObIntType);
+    column.set_rowkey_position(1);
+    ASSERT_EQ(OB_SUCCESS, table_schema_.add_column(column));
+    column.reset();
+    column.set_table_id(500001);
+    column.set_column_id(17);
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name("V"));
+    column.set_data_type(ObVarcharType);
+    column.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+    column.set_data_length(128);
+    ASSERT_EQ(OB_SUCCESS, table_schema_.add_column(column));
+
+    // the key 1 is put twice in the batch
+    const int64_t keys[OP_CNT] = {1, 2, 1, 3};
+    for (int64_t i = 0; i < OP_CNT; ++i) {
+      ObObj key;
+      ObObj value;
+      key.set_int(keys[i]);
+      value.set_varchar(values_[i]);
+      value.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+      ASSERT_EQ(OB_SUCCESS, entities_[i].add_rowkey_value(key));
+      ASSERT_EQ(OB_SUCCESS, entities_[i].set_property("V", value));
+      ASSERT_EQ(OB_SUCCESS, batch_operation_.insert_or_update(entities_[i]));
+    }
+  }
+protected:
+  void open_iter(ObTableApiMultiInsertRowIterator &iter)
+  {
+    iter.table_schema_ = &table_schema_;
+    iter.is_inited_ = true;
+    ASSERT_EQ(OB_SUCCESS, iter.open(batch_operation_));
+  }
+  // counts the rows as put_rows does, every row got from the iterator is written
+  void put_rows(ObTableApiMultiInsertRowIterator &iter, int64_t &affected_rows)
+  {
+    ObNewRow *row = NULL;
+    int ret = OB_SUCCESS;
+    affected_rows = 0;
+    while (OB_SUCC(iter.get_next_row(row))) {
+      ASSERT_EQ(2, row->get_count());
+      ASSERT_EQ(entities_[affected_rows].rowkey_.at(0).get_int(), row->get_cell(0).get_int());
+      ASSERT_EQ(ObString::make_string(values_[affected_rows]), row->get_cell(1).get_varchar());
+      ++affected_rows;
+    }
+    ASSERT_EQ(OB_ITER_END, ret);
+  }
+protected:
+  const char *values_[OP_CNT] = {"v1", "v2", "v1'", "v3"};
+  ObTableSchema table_schema_;
+  ObTableEntity entities_[OP_CNT];
+  ObTableBatchOperation batch_operation_;
+  ObTableEntityFactory<ObTableEntity> entity_factory_;
+};
+const int64_t TestTableMultiPut::OP_CNT;
+
+TEST_F(TestTableMultiPut, put_all_rows_in_one_pass)
+{
+  ObTableApiMultiInsertRowIterator iter;
+  iter.set_iter_all_rows(true);
+  open_iter(iter);
+  ASSERT_EQ(2, iter.get_column_ids().count());
+  // all the rows, with the repeated key, are put in request order by one put_rows
+  int64_t affected_rows = 0;
+  put_rows(iter, affected_rows);
+  ASSERT_EQ(OP_CNT, affected_rows);
+
+  ObTableBatchOperationResult result;
+  result.set_entity_factory(&entity_factory_);
+  ASSERT_EQ(OB_SUCCESS, ObTableService::add_multi_put_results(OP_CNT, affected_rows, result));
+  ASSERT_EQ(OP_CNT, result.count());
+  for (int64_t i = 0; i < OP_CNT; ++i) {
+    ASSERT_EQ(ObTableOperationType::INSERT_OR_UPDATE, result.at(i).type());
+    ASSERT_EQ(OB_SUCCESS, result.at(i).get_errno());
+    ASSERT_EQ(1, result.at(i).get_affected_rows());
+  }
+}
+
+TEST_F(TestTableMultiPut, pause_after_each_row)
+{
+  ObTableApiMultiInsertRowIterator iter;
+  open_iter(iter);
+  ObNewRow *row = NULL;
+  for (int64_t i = 0; i < OP_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, iter.get_next_row(row));
+    ASSERT_EQ(entities_[i].rowkey_.at(0).get_int(), row->get_cell(0).get_int());
+    ASSERT_EQ(OB_ITER_END, iter.get_next_row(row));
+    iter.continue_iter();
+  }
+  ASSERT_EQ(OB_ITER_END, iter.get_next_row(row));
+}
+
+TEST_F(TestTableMultiPut, unexpected_affected_rows)
+{
+  ObTableBatchOperationResult result;
+  result.set_entity_factory(&entity_factory_);
+  // a row of the batch is not put, no result is returned
+  ASSERT_EQ(OB_ERR_UNEXPECTED, ObTableService::add_multi_put_results(OP_CNT, OP_CNT - 1, result));
+  ASSERT_EQ(0, result.count());
+  ASSERT_EQ(OB_ERR_UNEXPECTED, ObTableService::add_multi_put_results(OP_CNT, OP_CNT + 1, result));
+  ASSERT_EQ(0, result.count());
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_table_multi_put.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
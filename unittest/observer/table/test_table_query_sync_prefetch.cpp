@@ -0,0 +1,286 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#define private public
+#include "observer/table/ob_table_query_sync_processor.h"
+#undef private
+#include "share/config/ob_server_config.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::table;
+using namespace oceanbase::observer;
+
+// returns row_cnt rows of (int, varchar), or err once at the err_idx-th row
+class MockRowIterator : public ObNewRowIterator
+{
+public:
+  MockRowIterator(const int64_t row_cnt, const int64_t err_idx = -1, const int err = OB_SUCCESS)
+    : row_cnt_(row_cnt), err_idx_(err_idx), err_(err), idx_(0)
+  {}
+  virtual ~MockRowIterator() {}
+  virtual int get_next_row(ObNewRow *&row)
+  {
+    int ret = OB_SUCCESS;
+    if (idx_ == err_idx_) {
+      ret = err_;
+      err_idx_ = -1;
+    } else if (idx_ >= row_cnt_) {
+      ret = OB_ITER_END;
+    } else {
+      cells_[0].set_int(idx_);
+      cells_[1].set_varchar("value");
+      row_.cells_ = cells_;
+      row_.count_ = 2;
+      row = &row_;
+      idx_++;
+    }
+    return ret;
+  }
+  virtual void reset() { idx_ = 0; }
+private:
+  int64_t row_cnt_;
+  int64_t err_idx_;
+  int err_;
+  int64_t idx_;
+  ObObj cells_[2];
+  ObNewRow row_;
+};
+
+class TestTableQuerySyncPrefetch : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, query_.add_select_column("K"));
+    ASSERT_EQ(OB_SUCCESS, query_.add_select_column("V"));
+    ASSERT_EQ(OB_SUCCESS, query_.set_batch(2));
+  }
+protected:
+  // the first row of result is the idx-th row of the scan
+  void check_first_row(const ObTableQueryResult &result, const int64_t idx)
+  {
+    ObObj cells[2];
+    ObNewRow row(cells, 2);
+    ASSERT_EQ(OB_SUCCESS, result.get_first_row(row));
+    ASSERT_EQ(idx, cells[0].get_int());
+  }
+  // query_start: scan the first result and keep the iterator in the session
+  void query_start(ObTableQuerySyncSession &session,
+                   ObNormalTableQueryResultIterator &iter,
+                   ObTableQueryResult &first_result)
+  {
+    ObTableQueryResult *one_result = nullptr;
+    iter.set_query_sync();
+    ASSERT_EQ(OB_SUCCESS, iter.get_next_result(one_result));
+    ASSERT_EQ(2, one_result->get_row_count());
+    check_first_row(first_result, 0);
+    ASSERT_TRUE(iter.has_more_result());
+    ASSERT_EQ(OB_SUCCESS, session.deep_copy_select_columns(query_));
+    session.set_result_iterator(&iter);
+  }
+  // query_next without prefetch result: scan the result with the iterator of the session
+  void query_next(ObTableQuerySyncSession &session, ObTableQuerySyncResult &result)
+  {
+    ObTableQueryResult *one_result = nullptr;
+    ASSERT_FALSE(session.has_prefetch_result());
+    session.get_result_iterator()->set_one_result(&result);
+    ASSERT_EQ(OB_SUCCESS, session.get_result_iterator()->get_next_result(one_result));
+    result.is_end_ = !session.get_result_iterator()->has_more_result();
+  }
+protected:
+  ObTableQuery query_;
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestTableQuerySyncPrefetch, prefetch_hand_off)
+{
+  MockRowIterator scan_result(5);
+  ObTableQueryResult first_result;
+  ObNormalTableQueryResultIterator iter(query_, first_result);
+  iter.set_scan_result(&scan_result);
+  ObTableQuerySyncSession session;
+  query_start(session, iter, first_result);
+
+  // the second result is prefetched after the first one is responded
+  const int64_t timeout_ts = ObTimeUtility::current_time() + 10 * 1000 * 1000L;
+  ASSERT_FALSE(session.has_prefetch_result());
+  ASSERT_EQ(OB_SUCCESS, session.prefetch_result(timeout_ts));
+  ASSERT_TRUE(session.has_prefetch_result());
+  ObTableQuerySyncResult result;
+  ASSERT_EQ(OB_SUCCESS, session.fetch_prefetch_result(allocator_, result));
+  ASSERT_FALSE(session.has_prefetch_result());
+  ASSERT_EQ(2, result.get_property_count());
+  ASSERT_EQ(2, result.get_row_count());
+  ASSERT_FALSE(result.is_end_);
+  check_first_row(result, 2);
+
+  // the last result ends the query
+  ASSERT_EQ(OB_SUCCESS, session.prefetch_result(timeout_ts));
+  ObTableQuerySyncResult last_result;
+  ASSERT_EQ(OB_SUCCESS, session.fetch_prefetch_result(allocator_, last_result));
+  ASSERT_EQ(1, last_result.get_row_count());
+  ASSERT_TRUE(last_result.is_end_);
+  check_first_row(last_result, 4);
+}
+
+TEST_F(TestTableQuerySyncPrefetch, prefetch_error)
+{
+  MockRowIterator scan_result(6, 2, OB_TIMEOUT);
+  ObTableQueryResult first_result;
+  ObNormalTableQueryResultIterator iter(query_, first_result);
+  iter.set_scan_result(&scan_result);
+  ObTableQuerySyncSession session;
+  query_start(session, iter, first_result);
+
+  // the timeout of the previous request has passed before the prefetch
+  ASSERT_EQ(OB_TRANS_TIMEOUT, session.prefetch_result(ObTimeUtility::current_time() - 1));
+  ASSERT_FALSE(session.has_prefetch_result());
+  // the scan fails before any row, the failed prefetch is discarded
+  ASSERT_EQ(OB_TIMEOUT, session.prefetch_result(ObTimeUtility::current_time() + 10 * 1000 * 1000L));
+  ASSERT_FALSE(session.has_prefetch_result());
+  // and the next query_next scans by itself
+  ObTableQuerySyncResult result;
+  query_next(session, result);
+  ASSERT_EQ(2, result.get_row_count());
+  ASSERT_FALSE(result.is_end_);
+  check_first_row(result, 2);
+}
+
+TEST_F(TestTableQuerySyncPrefetch, prefetch_partial_error)
+{
+  MockRowIterator scan_result(4, 3, OB_TIMEOUT);
+  ObTableQueryResult first_result;
+  ObNormalTableQueryResultIterator iter(query_, first_result);
+  iter.set_scan_result(&scan_result);
+  ObTableQuerySyncSession session;
+  query_start(session, iter, first_result);
+
+  // the row scanned before the error is kept for the next query_next
+  ASSERT_EQ(OB_TIMEOUT, session.prefetch_result(ObTimeUtility::current_time() + 10 * 1000 * 1000L));
+  ASSERT_TRUE(session.has_prefetch_result());
+  ObTableQuerySyncResult result;
+  ASSERT_EQ(OB_SUCCESS, session.fetch_prefetch_result(allocator_, result));
+  ASSERT_EQ(1, result.get_row_count());
+  ASSERT_FALSE(result.is_end_);
+  check_first_row(result, 2);
+  // the following rows are scanned by the query_next after it
+  ObTableQuerySyncResult next_result;
+  query_next(session, next_result);
+  ASSERT_EQ(1, next_result.get_row_count());
+  ASSERT_TRUE(next_result.is_end_);
+  check_first_row(next_result, 3);
+}
+
+TEST_F(TestTableQuerySyncPrefetch, wait_for_prefetch)
+{
+  ObQuerySyncMgr &mgr = ObQuerySyncMgr::get_instance();
+  const uint64_t sessid = mgr.generate_query_sessid();
+  ObTableQuerySyncSession session;
+  ObTableQuerySyncSession *query_session = nullptr;
+  ASSERT_EQ(OB_SUCCESS, mgr.set_query_session(sessid, &session));
+
+  // query_next arrives while the previous request is prefetching
+  session.set_in_use(true);
+  session.set_prefetching(true);
+  bool got_session = false;
+  int ret = OB_ERROR;
+  std::thread th([&]() {
+    ret = mgr.get_query_session(sessid, ObTimeUtility::current_time() + 10 * 1000 * 1000L,
+                                query_session);
+    ATOMIC_STORE(&got_session, true);
+  });
+  ::usleep(100 * 1000);
+  ASSERT_FALSE(ATOMIC_LOAD(&got_session));
+  mgr.finish_prefetch(sessid, session);
+  th.join();
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(&session, query_session);
+  ASSERT_TRUE(session.is_in_use());
+
+  // the prefetch does not finish in time
+  session.set_prefetching(true);
+  const int64_t begin_ts = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_TIMEOUT, mgr.get_query_session(sessid, begin_ts + 50 * 1000L, query_session));
+  ASSERT_LE(begin_ts + 50 * 1000L, ObTimeUtility::current_time());
+
+  // the session is held by another query_next
+  session.set_prefetching(false);
+  ASSERT_EQ(OB_ERR_UNEXPECTED, mgr.get_query_session(sessid, begin_ts + 10 * 1000 * 1000L,
+                                                     query_session));
+  ASSERT_FALSE(session.has_prefetch_waiter());
+  ASSERT_EQ(OB_SUCCESS, mgr.query_session_map_.erase_refactored(sessid));
+}
+
+TEST_F(TestTableQuerySyncPrefetch, wait_for_prefetch_of_own_session)
+{
+  ObQuerySyncMgr &mgr = ObQuerySyncMgr::get_instance();
+  const uint64_t sessid = mgr.generate_query_sessid();
+  const uint64_t other_sessid = mgr.generate_query_sessid();
+  ObTableQuerySyncSession session;
+  ObTableQuerySyncSession other_session;
+  ObTableQuerySyncSession *query_session = nullptr;
+  ASSERT_EQ(OB_SUCCESS, mgr.set_query_session(sessid, &session));
+  ASSERT_EQ(OB_SUCCESS, mgr.set_query_session(other_sessid, &other_session));
+  session.set_in_use(true);
+  session.set_prefetching(true);
+  other_session.set_in_use(true);
+  other_session.set_prefetching(true);
+  bool got_session = false;
+  int ret = OB_ERROR;
+  std::thread th([&]() {
+    ret = mgr.get_query_session(sessid, ObTimeUtility::current_time() + 10 * 1000 * 1000L,
+                                query_session);
+    ATOMIC_STORE(&got_session, true);
+  });
+  ::usleep(100 * 1000);
+  ASSERT_TRUE(session.has_prefetch_waiter());
+  // the prefetch of another session does not wake up the waiter
+  const uint32_t seq = session.prefetch_cond_.get_seq();
+  mgr.finish_prefetch(other_sessid, other_session);
+  ASSERT_EQ(seq, session.prefetch_cond_.get_seq());
+  ::usleep(100 * 1000);
+  ASSERT_FALSE(ATOMIC_LOAD(&got_session));
+  mgr.finish_prefetch(sessid, session);
+  th.join();
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(&session, query_session);
+  ASSERT_FALSE(session.has_prefetch_waiter());
+  ASSERT_EQ(OB_SUCCESS, mgr.query_session_map_.erase_refactored(sessid));
+  ASSERT_EQ(OB_SUCCESS, mgr.query_session_map_.erase_refactored(other_sessid));
+}
+
+TEST_F(TestTableQuerySyncPrefetch, htable_compressor_type)
+{
+  ObTableQuerySyncSession session;
+  ASSERT_TRUE(GCONF.tableapi_transport_compress_func.set_value("lz4_1.0"));
+  session.init_compressor_type(query_);
+  ASSERT_EQ(INVALID_COMPRESSOR, session.get_compressor_type());
+
+  // the results of hbase model queries are compressed
+  query_.htable_filter().set_valid(true);
+  session.init_compressor_type(query_);
+  ASSERT_EQ(LZ4_COMPRESSOR, session.get_compressor_type());
+
+  ASSERT_TRUE(GCONF.tableapi_transport_compress_func.set_value("none"));
+  session.init_compressor_type(query_);
+  ASSERT_EQ(INVALID_COMPRESSOR, session.get_compressor_type());
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_table_query_sync_prefetch.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -10,14 +10,19 @@
  * See the Mulan PubL v2 for more details.
  */
 
+#define private public
+#define protected public
 #include "observer/table/ob_htable_filter_parser.h"
 #include "observer/table/ob_htable_filters.h"
+#include "observer/table/ob_htable_filter_operator.h"
+#include "observer/table/ob_table_service.h"
 #include <gtest/gtest.h>
 #include "lib/utility/ob_test_util.h"
 #include "lib/json/ob_json_print_utils.h"  // for SJ
 #include <fstream>
 using namespace oceanbase::common;
 using namespace oceanbase::table;
+using namespace oceanbase::observer;
 
 class TestHFilterParser: public ::testing::Test
 {
@@ -136,6 +141,153 @@ TEST_F(TestHFilterParser, basic_test)
   is_equal_content(tmp_file, result_file);
 }
 
+TEST_F(TestHFilterParser, row_key_prefix)
+{
+  struct {
+    const char *filter_;
+    bool has_prefix_;
+    const char *prefix_;
+    bool is_empty_;
+  } cases[] = {
+    {"RowFilter(=, 'binaryprefix:abc')", true, "abc", false},
+    {"RowFilter(=, 'binary:abc')", true, "abc", false},
+    {"PrefixFilter('abc')", true, "abc", false},
+    {"RowFilter(<=, 'binaryprefix:abc')", false, "", false},
+    {"RowFilter(=, 'substring:abc')", false, "", false},
+    {"ValueFilter(=, 'binaryprefix:abc')", false, "", false},
+    {"RowFilter(=, 'binaryprefix:ab') AND RowFilter(=, 'binaryprefix:abcd') AND ValueFilter(=, 'substring:x')", true, "abcd", false},
+    {"PrefixFilter('abcd') AND RowFilter(=, 'binaryprefix:ab')", true, "abcd", false},
+    // no row key starts with both of the prefixes
+    {"RowFilter(=, 'binaryprefix:abc') AND RowFilter(=, 'binaryprefix:abd')", true, "", true},
+    {"PrefixFilter('abc') AND (RowFilter(=, 'binaryprefix:ab') AND PrefixFilter('b'))", true, "", true},
+    {"RowFilter(=, 'binaryprefix:abc') OR RowFilter(=, 'binaryprefix:abd')", false, "", false},
+    {"while ((RowFilter(=, 'binaryprefix:abc')))", false, "", false},
+  };
+  for (int64_t i = 0; i < ARRAYSIZEOF(cases); ++i) {
+    ObArenaAllocator allocator;
+    ObHTableFilterParser parser;
+    ASSERT_EQ(OB_SUCCESS, parser.init(&allocator));
+    hfilter::Filter *filter = NULL;
+    ASSERT_EQ(OB_SUCCESS, parser.parse_filter(ObString::make_string(cases[i].filter_), filter));
+    ASSERT_TRUE(NULL != filter);
+    ObString prefix;
+    bool is_empty = false;
+    ASSERT_EQ(cases[i].has_prefix_, filter->get_row_key_prefix(prefix, is_empty)) << cases[i].filter_;
+    if (cases[i].has_prefix_) {
+      ASSERT_EQ(cases[i].is_empty_, is_empty) << cases[i].filter_;
+    }
+    if (cases[i].has_prefix_ && !cases[i].is_empty_) {
+      ASSERT_EQ(ObString::make_string(cases[i].prefix_), prefix) << cases[i].filter_;
+    }
+    parser.destroy();
+  }
+}
+
+TEST_F(TestHFilterParser, narrow_scan_ranges)
+{
+  ObArenaAllocator allocator;
+  ObTableServiceCtx ctx;
+  ctx.init_param(0, NULL, &allocator, false, ObTableEntityType::ET_HKV, ObBinlogRowImageType::FULL);
+  // K, Q and T of the htable, only the collation of K matters
+  oceanbase::sql::ObExprResType column_type;
+  column_type.set_type(ObVarcharType);
+  column_type.set_collation_type(CS_TYPE_BINARY);
+  for (int64_t i = 0; i < 3; ++i) {
+    ASSERT_EQ(OB_SUCCESS, ctx.columns_type_.push_back(column_type));
+  }
+  ObNewRange whole_range;
+  whole_range.set_whole_range();
+
+  // [(ab, MIN, MIN), (ac, MIN, MIN))
+  oceanbase::storage::ObTableScanParam scan_param;
+  ASSERT_EQ(OB_SUCCESS, scan_param.key_ranges_.push_back(whole_range));
+  ASSERT_EQ(OB_SUCCESS, ObTableService::narrow_htable_scan_ranges(ctx, ObString::make_string("ab"),
+                                                                  false, scan_param));
+  const ObNewRange &range = scan_param.key_ranges_.at(0);
+  ASSERT_EQ(ObString::make_string("ab"), range.start_key_.get_obj_ptr()[0].get_varbinary());
+  ASSERT_TRUE(range.start_key_.get_obj_ptr()[1].is_min_value());
+  ASSERT_TRUE(range.border_flag_.inclusive_start());
+  ASSERT_EQ(ObString::make_string("ac"), range.end_key_.get_obj_ptr()[0].get_varbinary());
+  ASSERT_TRUE(range.end_key_.get_obj_ptr()[1].is_min_value());
+  ASSERT_FALSE(range.border_flag_.inclusive_end());
+
+  // the conflicting prefixes of an AND list leave only false ranges
+  ObHTableFilterParser parser;
+  ASSERT_EQ(OB_SUCCESS, parser.init(&allocator));
+  hfilter::Filter *filter = NULL;
+  ASSERT_EQ(OB_SUCCESS, parser.parse_filter(ObString::make_string(
+      "RowFilter(=, 'binaryprefix:abc') AND PrefixFilter('abd')"), filter));
+  ObString prefix;
+  bool is_empty = false;
+  ASSERT_TRUE(filter->get_row_key_prefix(prefix, is_empty));
+  ASSERT_TRUE(is_empty);
+  scan_param.key_ranges_.reset();
+  ASSERT_EQ(OB_SUCCESS, scan_param.key_ranges_.push_back(whole_range));
+  ASSERT_EQ(OB_SUCCESS, scan_param.key_ranges_.push_back(whole_range));
+  ASSERT_EQ(OB_SUCCESS, ObTableService::narrow_htable_scan_ranges(ctx, prefix, is_empty, scan_param));
+  for (int64_t i = 0; i < scan_param.key_ranges_.count(); ++i) {
+    const ObNewRange &false_range = scan_param.key_ranges_.at(i);
+    ASSERT_TRUE(false_range.start_key_.is_max_row());
+    ASSERT_TRUE(false_range.end_key_.is_min_row());
+  }
+  parser.destroy();
+}
+
+// returns the cells of the htable, one (K, Q, T, V) row for each of them
+class MockCellIterator : public ObNewRowIterator
+{
+public:
+  MockCellIterator(const char *const *rowkeys, const int64_t cell_cnt)
+    : rowkeys_(rowkeys), cell_cnt_(cell_cnt), idx_(0)
+  {}
+  virtual ~MockCellIterator() {}
+  virtual int get_next_row(ObNewRow *&row)
+  {
+    int ret = OB_SUCCESS;
+    if (idx_ >= cell_cnt_) {
+      ret = OB_ITER_END;
+    } else {
+      cells_[ObHTableConstants::COL_IDX_K].set_varbinary(ObString::make_string(rowkeys_[idx_]));
+      cells_[ObHTableConstants::COL_IDX_Q].set_varbinary(ObString::make_string("q"));
+      cells_[ObHTableConstants::COL_IDX_T].set_int(-idx_);
+      cells_[ObHTableConstants::COL_IDX_V].set_varbinary(ObString::make_string("v"));
+      row_.cells_ = cells_;
+      row_.count_ = 4;
+      row = &row_;
+      idx_++;
+    }
+    return ret;
+  }
+  virtual void reset() { idx_ = 0; }
+private:
+  const char *const *rowkeys_;
+  int64_t cell_cnt_;
+  int64_t idx_;
+  ObObj cells_[4];
+  ObNewRow row_;
+};
+
+TEST_F(TestHFilterParser, skip_to_next_row)
+{
+  const char *rowkeys[] = {"r1", "r1", "r1", "r10", "r10", "r2"};
+  MockCellIterator cell_iter(rowkeys, ARRAYSIZEOF(rowkeys));
+  ObTableQuery query;
+  ObHTableRowIterator row_iter(query);
+  row_iter.set_scan_result(&cell_iter);
+  row_iter.matcher_ = &row_iter.matcher_impl_;
+  ASSERT_EQ(OB_SUCCESS, row_iter.next_cell());
+  ASSERT_EQ(ObString::make_string("r1"), row_iter.curr_cell_.get_rowkey());
+  // the remaining cells of the row are skipped, and the row key with it as a prefix is not
+  ASSERT_EQ(OB_SUCCESS, row_iter.seek_or_skip_to_next_row(row_iter.curr_cell_));
+  ASSERT_EQ(ObString::make_string("r10"), row_iter.curr_cell_.get_rowkey());
+  ASSERT_EQ(OB_SUCCESS, row_iter.seek_or_skip_to_next_row(row_iter.curr_cell_));
+  ASSERT_EQ(ObString::make_string("r2"), row_iter.curr_cell_.get_rowkey());
+  ASSERT_EQ(-5, row_iter.curr_cell_.get_timestamp());
+  // the last row
+  ASSERT_EQ(OB_ITER_END, row_iter.seek_or_skip_to_next_row(row_iter.curr_cell_));
+  ASSERT_FALSE(row_iter.has_more_result());
+}
+
 int main(int argc, char **argv)
 {
   OB_LOGGER.set_log_level("INFO");
@@ -0,0 +1,182 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+#include <gtest/gtest.h>
+#define private public
+#include "sql/engine/px/ob_px_row_store.h"
+#include "sql/dtl/ob_dtl_basic_channel.h"
+#undef private
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+using namespace oceanbase::sql::dtl;
+
+class TestReceiveRowReader : public ::testing::Test
+{
+public:
+  static const int64_t BUF_SIZE = 64 * 1024;
+  static const int64_t ROW_CNT = 100;
+
+  TestReceiveRowReader() = default;
+  virtual ~TestReceiveRowReader() = default;
+  virtual void SetUp()
+  {
+    MEMSET(send_buf_, 0, sizeof(send_buf_));
+    MEMSET(recv_buf_, 0, sizeof(recv_buf_));
+  }
+  virtual void TearDown() {};
+
+protected:
+  // writes ROW_CNT rows of (i, "row_i") the way a PX_CHUNK_ROW channel does, and copies the
+  // buffer to another address, as the rpc channels do
+  void send_rows(ObDtlLinkedBuffer &recv_buffer)
+  {
+    ObDtlLinkedBuffer send_buffer(send_buf_, BUF_SIZE);
+    ObDtlRowMsgWriter writer;
+    ASSERT_EQ(OB_SUCCESS, writer.init(&send_buffer, OB_SYS_TENANT_ID));
+    ObObj cells[2];
+    ObNewRow row;
+    row.cells_ = cells;
+    row.count_ = 2;
+    char str[32];
+    for (int64_t i = 0; i < ROW_CNT; ++i) {
+      const int64_t len = snprintf(str, sizeof(str), "row_%ld", i);
+      cells[0].set_int(i);
+      cells[1].set_varchar(str, static_cast<int32_t>(len));
+      ObPxNewRow px_row(row);
+      ASSERT_EQ(OB_SUCCESS, writer.write(px_row, NULL, false));
+    }
+    ObPxNewRow eof_row;
+    ASSERT_EQ(OB_SUCCESS, writer.write(eof_row, NULL, true));
+    ASSERT_EQ(ROW_CNT, writer.rows());
+    MEMCPY(recv_buf_, send_buf_, BUF_SIZE);
+    recv_buffer.buf_ = recv_buf_;
+    recv_buffer.size_ = BUF_SIZE;
+    recv_buffer.pos_ = send_buffer.pos_;
+    recv_buffer.set_data_msg(true);
+    recv_buffer.msg_type() = ObDtlMsgType::PX_CHUNK_ROW;
+    writer.reset();
+  }
+  // the i-th row of the buffer, as it is before read
+  const ObChunkRowStore::StoredRow *stored_row(const int64_t idx)
+  {
+    const ObChunkRowStore::StoredRow *srow = NULL;
+    int64_t pos = 0;
+    ObChunkRowStore::Block *block = reinterpret_cast<ObChunkRowStore::Block *>(recv_buf_);
+    for (int64_t i = 0; i <= idx; ++i) {
+      EXPECT_EQ(OB_SUCCESS, block->get_store_row(pos, srow));
+    }
+    return srow;
+  }
+  void check_row(const ObNewRow &row, const int64_t i)
+  {
+    char str[32];
+    const int64_t len = snprintf(str, sizeof(str), "row_%ld", i);
+    ASSERT_EQ(i, row.cells_[0].get_int());
+    ASSERT_EQ(ObString(len, str), row.cells_[1].get_varchar());
+    // the string is read in place from the received buffer
+    ASSERT_TRUE(row.cells_[1].get_string_ptr() >= recv_buf_
+                && row.cells_[1].get_string_ptr() < recv_buf_ + BUF_SIZE);
+  }
+  // the buffers are not allocated from the dtl memory manager, do not free them
+  void detach_buffers(ObReceiveRowReader &reader)
+  {
+    reader.recv_head_ = NULL;
+    reader.recv_tail_ = NULL;
+    reader.iterated_buffers_ = NULL;
+    reader.reset();
+  }
+
+protected:
+  char send_buf_[BUF_SIZE];
+  char recv_buf_[BUF_SIZE];
+};
+const int64_t TestReceiveRowReader::BUF_SIZE;
+const int64_t TestReceiveRowReader::ROW_CNT;
+
+TEST_F(TestReceiveRowReader, read_rows_in_place)
+{
+  ObDtlLinkedBuffer buffer;
+  send_rows(buffer);
+  ObReceiveRowReader reader;
+  bool transferred = false;
+  ASSERT_EQ(OB_SUCCESS, reader.add_buffer(buffer, transferred));
+  ASSERT_TRUE(transferred);
+  ASSERT_EQ(ROW_CNT, reader.left_rows());
+
+  ObObj cells[2];
+  ObNewRow row;
+  row.cells_ = cells;
+  row.count_ = 2;
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_TRUE(reader.has_more());
+    ASSERT_EQ(OB_SUCCESS, reader.get_next_row(row));
+    check_row(row, i);
+  }
+  ASSERT_EQ(0, reader.left_rows());
+  ASSERT_EQ(OB_ITER_END, reader.get_next_row(row));
+  detach_buffers(reader);
+}
+
+TEST_F(TestReceiveRowReader, rows_not_read_are_not_swizzled)
+{
+  ObDtlLinkedBuffer buffer;
+  send_rows(buffer);
+  // the string of a row received is still an offset in the row
+  const ObChunkRowStore::StoredRow *last_row = stored_row(ROW_CNT - 1);
+  const char *unswizzled_ptr = last_row->cells()[1].get_string_ptr();
+  ASSERT_TRUE(reinterpret_cast<uint64_t>(unswizzled_ptr) < static_cast<uint64_t>(last_row->row_size_));
+
+  ObReceiveRowReader reader;
+  bool transferred = false;
+  ASSERT_EQ(OB_SUCCESS, reader.add_buffer(buffer, transferred));
+  ObObj cells[2];
+  ObNewRow row;
+  row.cells_ = cells;
+  row.count_ = 2;
+  const int64_t read_cnt = 10;
+  for (int64_t i = 0; i < read_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, reader.get_next_row(row));
+    check_row(row, i);
+  }
+  ASSERT_EQ(ROW_CNT - read_cnt, reader.left_rows());
+  // adding the buffer and reading the first rows leaves the last row untouched
+  ASSERT_EQ(unswizzled_ptr, last_row->cells()[1].get_string_ptr());
+  detach_buffers(reader);
+}
+
+TEST_F(TestReceiveRowReader, empty_buffer)
+{
+  ObDtlLinkedBuffer send_buffer(send_buf_, BUF_SIZE);
+  ObDtlRowMsgWriter writer;
+  ASSERT_EQ(OB_SUCCESS, writer.init(&send_buffer, OB_SYS_TENANT_ID));
+  ObPxNewRow eof_row;
+  ASSERT_EQ(OB_SUCCESS, writer.write(eof_row, NULL, true));
+  send_buffer.set_data_msg(true);
+  send_buffer.msg_type() = ObDtlMsgType::PX_CHUNK_ROW;
+  ObReceiveRowReader reader;
+  bool transferred = true;
+  ASSERT_EQ(OB_ITER_END, reader.add_buffer(send_buffer, transferred));
+  ASSERT_FALSE(transferred);
+  ASSERT_FALSE(reader.has_more());
+  writer.reset();
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_receive_row_reader.log", true);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
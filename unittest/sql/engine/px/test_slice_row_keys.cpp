@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_EXE
+#include <gtest/gtest.h>
+#define private public
+#include "sql/engine/px/exchange/ob_px_transmit_op.h"
+#undef private
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+class TestSliceRowKeys : public ::testing::Test
+{
+public:
+  static const int64_t BATCH_SIZE = 256;
+
+  TestSliceRowKeys() : skip_(NULL) {}
+  virtual ~TestSliceRowKeys() = default;
+  virtual void SetUp()
+  {
+    skip_ = to_bit_vector(skip_buf_);
+    skip_->init(BATCH_SIZE);
+  }
+  virtual void TearDown() {};
+
+protected:
+  // the keys are grouped by slice, and the rows of a slice keep their order in the batch
+  void check_keys(const int64_t ch_cnt, const uint64_t *keys, const int64_t key_cnt)
+  {
+    int64_t expect_cnt = 0;
+    int64_t k = 0;
+    for (int64_t s = 0; s < ch_cnt; s++) {
+      for (int64_t i = 0; i < BATCH_SIZE; i++) {
+        if (!skip_->at(i) && s == indexes_[i]) {
+          ASSERT_LT(k, key_cnt);
+          ASSERT_EQ(s, static_cast<int64_t>(keys[k] >> 32));
+          ASSERT_EQ(i, static_cast<int64_t>(keys[k] & UINT32_MAX));
+          k++;
+          expect_cnt++;
+        }
+      }
+    }
+    ASSERT_EQ(expect_cnt, key_cnt);
+  }
+  // builds the keys by both the counting sort and the sort of the keys
+  void build_and_check(const int64_t ch_cnt)
+  {
+    int64_t key_cnt = 0;
+    int64_t *cnts = new int64_t[ch_cnt + 1];
+    ASSERT_EQ(OB_SUCCESS, ObPxTransmitOp::build_slice_row_keys(indexes_, *skip_, BATCH_SIZE,
+        ch_cnt, cnts, keys_, key_cnt));
+    check_keys(ch_cnt, keys_, key_cnt);
+    delete [] cnts;
+    ASSERT_EQ(OB_SUCCESS, ObPxTransmitOp::build_slice_row_keys(indexes_, *skip_, BATCH_SIZE,
+        ch_cnt, NULL, keys_, key_cnt));
+    check_keys(ch_cnt, keys_, key_cnt);
+  }
+
+protected:
+  char skip_buf_[BATCH_SIZE / 8 + 8];
+  ObBitVector *skip_;
+  int64_t indexes_[BATCH_SIZE];
+  uint64_t keys_[BATCH_SIZE];
+};
+const int64_t TestSliceRowKeys::BATCH_SIZE;
+
+TEST_F(TestSliceRowKeys, group_by_slice)
+{
+  const int64_t ch_cnts[] = {1, 3, 16, BATCH_SIZE, 4 * BATCH_SIZE};
+  srand(1);
+  for (int64_t c = 0; c < ARRAYSIZEOF(ch_cnts); c++) {
+    const int64_t ch_cnt = ch_cnts[c];
+    skip_->init(BATCH_SIZE);
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      indexes_[i] = rand() % ch_cnt;
+    }
+    build_and_check(ch_cnt);
+  }
+}
+
+TEST_F(TestSliceRowKeys, skip_and_drop_rows)
+{
+  const int64_t ch_cnt = 8;
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    indexes_[i] = (BATCH_SIZE - i) % ch_cnt;
+    if (0 == i % 5) {
+      skip_->set(i);
+    } else if (0 == i % 7) {
+      // the rows to drop are sent apart
+      indexes_[i] = ObSliceIdxCalc::DEFAULT_CHANNEL_IDX_TO_DROP_ROW;
+    }
+  }
+  build_and_check(ch_cnt);
+
+  // no row to group
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    indexes_[i] = -1;
+  }
+  int64_t key_cnt = -1;
+  ASSERT_EQ(OB_SUCCESS, ObPxTransmitOp::build_slice_row_keys(indexes_, *skip_, BATCH_SIZE,
+      ch_cnt, NULL, keys_, key_cnt));
+  ASSERT_EQ(0, key_cnt);
+}
+
+TEST_F(TestSliceRowKeys, invalid_slice_index)
+{
+  const int64_t ch_cnt = 4;
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    indexes_[i] = i % ch_cnt;
+  }
+  indexes_[BATCH_SIZE - 1] = ch_cnt;
+  int64_t key_cnt = 0;
+  int64_t cnts[ch_cnt + 1];
+  ASSERT_EQ(OB_ERR_UNEXPECTED, ObPxTransmitOp::build_slice_row_keys(indexes_, *skip_, BATCH_SIZE,
+      ch_cnt, cnts, keys_, key_cnt));
+  // a skipped row is not checked
+  skip_->set(BATCH_SIZE - 1);
+  ASSERT_EQ(OB_SUCCESS, ObPxTransmitOp::build_slice_row_keys(indexes_, *skip_, BATCH_SIZE,
+      ch_cnt, cnts, keys_, key_cnt));
+  check_keys(ch_cnt, keys_, key_cnt);
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  OB_LOGGER.set_file_name("test_slice_row_keys.log", true);
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
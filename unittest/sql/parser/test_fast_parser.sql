@@ -261,4 +261,13 @@ select interval '123123 23:23:23.123123' day (9) to second (9) R from dual;
 select interval '123123 23:23:23.123123' day(9)to second(9) R from dual;
 select interval '12 23:23:23.123123' day to second(6) R from dual;
 select interval '12 23:23:23.123123' day to second R from dual;
-select '\103hh\100hh' 'ueuoiuo';
\ No newline at end of file
+select '\103hh\100hh' 'ueuoiuo';
+select 'a string literal which is longer than thirty two bytes, so it is scanned by blocks' from dual;
+select 'a string literal with an escaped \' quote crossing the 32 bytes block boundary \\ and a tail' from dual;
+select "a double quoted string literal which is longer than thirty two bytes" from dual;
+select 'unterminated string literal which is longer than thirty two bytes;
+select 1234567890123456789012345678901234567890, 12345678901234567890123456789012345.678901234567890123456789 from dual;
+select 12345678901234567890123456789012345678901234567890e10, 0.12345678901234567890123456789012345678901234567890 from dual;
+select /* a long comment * with some stars ** inside, which is longer than thirty two bytes */ 1 from dual;
+select /* unterminated long comment which is longer than thirty two bytes * 1 from dual;
+insert into t1 values (1, 'abcdefghijklmnopqrstuvwxyz0123456789'), (2, 'abcdefghijklmnopqrstuvwxyz0123456789'), (3, 'abcdefghijklmnopqrstuvwxyz0123456789');
@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "sql/parser/ob_fast_parser.h"
+#include "sql/parser/ob_fast_parser_simd.h"
+#include "lib/worker.h"
+#include "lib/allocator/page_arena.h"
+#include <fstream>
+#include <vector>
+#include <string>
+#include <iostream>
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+// Benchmark of ObFastParser over a statement corpus (one statement per line),
+// the corpus is parsed with the simd scanning enabled and disabled, and the
+// parameterized results of the two runs must be the same.
+//
+// usage: test_fast_parser_perf [-q corpus] [-n loop_count] [-o] [-l log_level]
+//   -o: parse in oracle mode
+namespace test
+{
+static const char *parse_file = "./test_fast_parser.sql";
+static int LOOP_COUNT = 1000;
+
+struct FpResult
+{
+  int ret_;
+  std::string no_param_sql_;
+  std::vector<std::string> params_;
+  bool operator==(const FpResult &other) const
+  {
+    return ret_ == other.ret_ && no_param_sql_ == other.no_param_sql_ && params_ == other.params_;
+  }
+};
+
+class TestFastParserPerf
+{
+public:
+  TestFastParserPerf() : allocator_(ObModIds::TEST) {}
+  virtual ~TestFastParserPerf() {}
+  int load_sql(const char *file_path, std::vector<std::string> &sql_array);
+  void parse(const std::string &sql, FpResult &result);
+  int64_t run_loops(const std::vector<std::string> &sql_array);
+private:
+  DISALLOW_COPY_AND_ASSIGN(TestFastParserPerf);
+public:
+  ObArenaAllocator allocator_;
+};
+
+int TestFastParserPerf::load_sql(const char *file_path, std::vector<std::string> &sql_array)
+{
+  int ret = OB_SUCCESS;
+  std::ifstream in(file_path);
+  if (!in.is_open()) {
+    ret = OB_ERROR;
+    SQL_PC_LOG(ERROR, "failed to open file", K(file_path));
+  }
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.size() <= 0) continue;
+    std::size_t begin = line.find_first_not_of('\t');
+    if (begin == std::string::npos || line.at(begin) == '#') continue;
+    std::size_t end = line.find_last_not_of('\t');
+    sql_array.push_back(line.substr(begin, end - begin + 1));
+  }
+  in.close();
+  return ret;
+}
+
+void TestFastParserPerf::parse(const std::string &sql, FpResult &result)
+{
+  int64_t param_num = 0;
+  char *no_param_sql_ptr = NULL;
+  int64_t no_param_sql_len = 0;
+  ParamList *p_list = NULL;
+  result.ret_ = ObFastParser::parse(ObString::make_string(sql.c_str()), false, no_param_sql_ptr,
+                                    no_param_sql_len, p_list, param_num,
+                                    CS_TYPE_UTF8MB4_GENERAL_CI, allocator_);
+  result.no_param_sql_.clear();
+  result.params_.clear();
+  if (OB_SUCCESS == result.ret_) {
+    result.no_param_sql_.assign(no_param_sql_ptr, no_param_sql_len);
+    for (ParamList *p = p_list; NULL != p && NULL != p->node_; p = p->next_) {
+      const ParseNode *node = p->node_;
+      std::string param = std::to_string(node->type_) + ":";
+      param.append(node->raw_text_, node->text_len_);
+      param += ":";
+      param.append(node->str_value_, node->str_len_);
+      result.params_.push_back(param);
+    }
+  }
+  allocator_.reset();
+}
+
+int64_t TestFastParserPerf::run_loops(const std::vector<std::string> &sql_array)
+{
+  int64_t param_num = 0;
+  char *no_param_sql_ptr = NULL;
+  int64_t no_param_sql_len = 0;
+  ParamList *p_list = NULL;
+  const int64_t begin_ts = ObTimeUtility::current_time();
+  for (int i = 0; i < LOOP_COUNT; i++) {
+    for (int j = 0; j < (int)sql_array.size(); j++) {
+      (void)ObFastParser::parse(ObString::make_string(sql_array.at(j).c_str()), false,
+                                no_param_sql_ptr, no_param_sql_len, p_list, param_num,
+                                CS_TYPE_UTF8MB4_GENERAL_CI, allocator_);
+      allocator_.reset();
+    }
+  }
+  return ObTimeUtility::current_time() - begin_ts;
+}
+
+TEST(TestFastParserPerf, simd_same_result)
+{
+  std::vector<std::string> sql_array;
+  TestFastParserPerf pp;
+  ASSERT_EQ(OB_SUCCESS, pp.load_sql(parse_file, sql_array));
+  ASSERT_LT(0, sql_array.size());
+  int64_t total_bytes = 0;
+  int64_t diff_cnt = 0;
+  for (int j = 0; j < (int)sql_array.size(); j++) {
+    FpResult simd_result;
+    FpResult normal_result;
+    ObFastParserSimd::set_simd_enabled(true);
+    pp.parse(sql_array.at(j), simd_result);
+    ObFastParserSimd::set_simd_enabled(false);
+    pp.parse(sql_array.at(j), normal_result);
+    if (!(simd_result == normal_result)) {
+      diff_cnt++;
+      std::cout << "====" << "result diff:" << sql_array.at(j) << std::endl;
+    }
+    total_bytes += sql_array.at(j).length();
+  }
+  ObFastParserSimd::set_simd_enabled(false);
+  const int64_t normal_t = pp.run_loops(sql_array);
+  ObFastParserSimd::set_simd_enabled(true);
+  const bool simd_supported = ObFastParserSimd::is_simd_enabled();
+  const int64_t simd_t = pp.run_loops(sql_array);
+  const double total_cnt = (double)sql_array.size() * LOOP_COUNT;
+  std::cout << "====" << "stmt_cnt:" << sql_array.size() << ", stmt_bytes:" << total_bytes
+            << ", loop_cnt:" << LOOP_COUNT << std::endl;
+  std::cout << "====" << "diff_cnt:" << diff_cnt << std::endl;
+  std::cout << "====" << "simd_supported:" << simd_supported << std::endl;
+  std::cout << "====" << "normal avg_time(us):" << (double)normal_t / total_cnt
+            << ", MB/s:" << (double)total_bytes * LOOP_COUNT / (double)MAX(normal_t, 1) << std::endl;
+  std::cout << "====" << "simd avg_time(us):" << (double)simd_t / total_cnt
+            << ", MB/s:" << (double)total_bytes * LOOP_COUNT / (double)MAX(simd_t, 1) << std::endl;
+  ASSERT_EQ(0, diff_cnt);
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("ERROR");
+  OB_LOGGER.set_file_name("test_fast_parser_perf.log", true);
+  set_compat_mode(lib::Worker::CompatMode::MYSQL);
+  ::testing::InitGoogleTest(&argc, argv);
+  int c = 0;
+  while(-1 != (c = getopt(argc, argv, "q:n:ol:"))) {
+    switch(c) {
+      case 'q':
+        test::parse_file = optarg;
+        break;
+      case 'n':
+        test::LOOP_COUNT = atoi(optarg);
+        break;
+      case 'o':
+        set_compat_mode(lib::Worker::CompatMode::ORACLE);
+        break;
+      case 'l':
+        if (NULL != optarg) {
+          OB_LOGGER.set_log_level(optarg);
+        }
+        break;
+      default:
+        printf("usage: test_fast_parser_perf [-q corpus] [-n loop_count] [-o] [-l log_level]\n");
+        break;
+    }
+  }
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL_PC
+#include <gtest/gtest.h>
+#include <sched.h>
+#include "lib/container/ob_se_array.h"
+#include "sql/plan_cache/ob_lib_cache_node_hot_cache.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace sql;
+
+namespace unittest
+{
+
+struct MockLCKey : public ObILibCacheKey
+{
+  explicit MockLCKey(const uint64_t id) : ObILibCacheKey(NS_CRSR), id_(id) {}
+  virtual int deep_copy(ObIAllocator &allocator, const ObILibCacheKey &other)
+  {
+    UNUSED(allocator);
+    id_ = static_cast<const MockLCKey &>(other).id_;
+    return OB_SUCCESS;
+  }
+  virtual uint64_t hash() const { return id_; }
+  virtual bool is_equal(const ObILibCacheKey &other) const
+  {
+    return id_ == static_cast<const MockLCKey &>(other).id_;
+  }
+  uint64_t id_;
+};
+
+class MockLCNode : public ObILibCacheNode
+{
+public:
+  MockLCNode(lib::MemoryContext &mem_context, const uint64_t id)
+    : ObILibCacheNode(NULL, mem_context), key_(id)
+  {
+    set_cache_key(&key_);
+  }
+protected:
+  virtual int inner_get_cache_obj(ObILibCacheCtx &ctx,
+                                  ObILibCacheKey *key,
+                                  ObILibCacheObject *&cache_obj)
+  {
+    UNUSEDx(ctx, key, cache_obj);
+    return OB_NOT_SUPPORTED;
+  }
+  virtual int inner_add_cache_obj(ObILibCacheCtx &ctx,
+                                  ObILibCacheKey *key,
+                                  ObILibCacheObject *cache_obj)
+  {
+    UNUSEDx(ctx, key, cache_obj);
+    return OB_NOT_SUPPORTED;
+  }
+private:
+  MockLCKey key_;
+};
+
+class TestLCNodeHotCache : public ::testing::Test
+{
+public:
+  virtual void SetUp()
+  {
+    // the slots are per cpu, keep the test on one cpu
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(0, &cpu_set);
+    sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+    ASSERT_EQ(OB_SUCCESS, ROOT_CONTEXT->CREATE_CONTEXT(mem_context_, lib::ContextParam()));
+    ASSERT_EQ(OB_SUCCESS, hot_cache_.init(OB_SYS_TENANT_ID));
+  }
+  virtual void TearDown()
+  {
+    hot_cache_.destroy();
+    DESTROY_CONTEXT(mem_context_);
+  }
+protected:
+  lib::MemoryContext mem_context_;
+  ObLCNodeHotCache hot_cache_;
+};
+
+TEST_F(TestLCNodeHotCache, hit)
+{
+  MockLCNode node1(mem_context_, 1);
+  MockLCNode node2(mem_context_, 2);
+  MockLCKey key1(1);
+  MockLCKey key2(2);
+  // another key in the same slot of key1
+  MockLCKey key17(1 + ObLCNodeHotCache::SLOT_CNT_PER_CPU);
+  CriticalGuard(hot_cache_.get_qsync());
+
+  ASSERT_EQ(NULL, hot_cache_.get(key1, key1.hash()));
+  hot_cache_.put(key1.hash(), &node1);
+  hot_cache_.put(key2.hash(), &node2);
+  ASSERT_EQ(&node1, hot_cache_.get(key1, key1.hash()));
+  ASSERT_EQ(&node2, hot_cache_.get(key2, key2.hash()));
+  ASSERT_EQ(NULL, hot_cache_.get(key17, key17.hash()));
+}
+
+TEST_F(TestLCNodeHotCache, purge_and_reuse)
+{
+  MockLCNode node1(mem_context_, 1);
+  MockLCNode node2(mem_context_, 2);
+  MockLCNode node3(mem_context_, 3);
+  MockLCNode node17(mem_context_, 1 + ObLCNodeHotCache::SLOT_CNT_PER_CPU);
+  MockLCKey key1(1);
+  MockLCKey key2(2);
+  MockLCKey key3(3);
+  MockLCKey key17(1 + ObLCNodeHotCache::SLOT_CNT_PER_CPU);
+  {
+    CriticalGuard(hot_cache_.get_qsync());
+    hot_cache_.put(key1.hash(), &node1);
+    hot_cache_.put(key2.hash(), &node2);
+    hot_cache_.put(key3.hash(), &node3);
+  }
+
+  // purge must be called out of the critical section
+  hot_cache_.purge(&node1);
+  {
+    CriticalGuard(hot_cache_.get_qsync());
+    ASSERT_EQ(NULL, hot_cache_.get(key1, key1.hash()));
+    ASSERT_EQ(&node2, hot_cache_.get(key2, key2.hash()));
+  }
+
+  // the nodes erased together are purged by one call
+  ObSEArray<ObILibCacheNode *, 4> nodes;
+  ASSERT_EQ(OB_SUCCESS, nodes.push_back(&node3));
+  ASSERT_EQ(OB_SUCCESS, nodes.push_back(&node1));
+  ASSERT_EQ(OB_SUCCESS, nodes.push_back(&node2));
+  hot_cache_.purge(nodes);
+  {
+    CriticalGuard(hot_cache_.get_qsync());
+    ASSERT_EQ(NULL, hot_cache_.get(key2, key2.hash()));
+    ASSERT_EQ(NULL, hot_cache_.get(key3, key3.hash()));
+    // the slot is reused by another node
+    hot_cache_.put(key17.hash(), &node17);
+    ASSERT_EQ(&node17, hot_cache_.get(key17, key17.hash()));
+    ASSERT_EQ(NULL, hot_cache_.get(key1, key1.hash()));
+    hot_cache_.put(key1.hash(), &node1);
+    ASSERT_EQ(&node1, hot_cache_.get(key1, key1.hash()));
+    ASSERT_EQ(NULL, hot_cache_.get(key17, key17.hash()));
+  }
+
+  // purging a node not in the slots changes nothing
+  nodes.reset();
+  ASSERT_EQ(OB_SUCCESS, nodes.push_back(&node17));
+  hot_cache_.purge(nodes);
+  nodes.reset();
+  hot_cache_.purge(nodes);
+  {
+    CriticalGuard(hot_cache_.get_qsync());
+    ASSERT_EQ(&node1, hot_cache_.get(key1, key1.hash()));
+  }
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_lib_cache_node_hot_cache.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
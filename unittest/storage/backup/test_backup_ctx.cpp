@@ -229,7 +229,7 @@ int TestBackupCtx::do_backup_ctx_(const int64_t macro_count, const int64_t meta_
     const common::ObLogicMacroBlockId &logic_id = macro_list.at(i);
     ret = make_random_buffer(allocator, buffer_reader);
     EXPECT_EQ(OB_SUCCESS, ret);
-    ret = backup_data_ctx.write_macro_block_data(buffer_reader, logic_id, macro_index);
+    ret = backup_data_ctx.write_macro_block_data(buffer_reader, logic_id, 0/*data_checksum*/, macro_index);
     EXPECT_EQ(OB_SUCCESS, ret);
     ret = macro_index_list.push_back(macro_index);
     EXPECT_EQ(OB_SUCCESS, ret);
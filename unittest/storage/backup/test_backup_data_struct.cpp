@@ -139,6 +139,89 @@ TEST(TestBackupDataStruct, BackupMetaKeyCompare)
   ASSERT_FALSE(lhs_key != rhs_key);
 }
 
+// ObBackupMacroBlockIndex written by the older version, without data checksum
+struct OldBackupMacroBlockIndex {
+  OB_UNIS_VERSION(1);
+
+public:
+  common::ObLogicMacroBlockId logic_id_;
+  int64_t backup_set_id_;
+  share::ObLSID ls_id_;
+  int64_t turn_id_;
+  int64_t retry_id_;
+  int64_t file_id_;
+  int64_t offset_;
+  int64_t length_;
+};
+
+OB_SERIALIZE_MEMBER(
+    OldBackupMacroBlockIndex, logic_id_, backup_set_id_, ls_id_, turn_id_, retry_id_, file_id_, offset_, length_);
+
+static void make_macro_block_index(ObBackupMacroBlockIndex &macro_index)
+{
+  macro_index.logic_id_.data_seq_ = 0;
+  macro_index.logic_id_.logic_version_ = 1657251061256045963;
+  macro_index.logic_id_.tablet_id_ = 549755814602;
+  macro_index.backup_set_id_ = 2;
+  macro_index.ls_id_ = ObLSID(1003);
+  macro_index.turn_id_ = 1;
+  macro_index.retry_id_ = 0;
+  macro_index.file_id_ = 3;
+  macro_index.offset_ = 2393243648LL;
+  macro_index.length_ = 2015232LL;
+}
+
+TEST(TestBackupDataStruct, BackupMacroBlockIndexSerialize)
+{
+  char buf[1024];
+  int64_t pos = 0;
+  ObBackupMacroBlockIndex write_index;
+  ObBackupMacroBlockIndex read_index;
+  make_macro_block_index(write_index);
+  write_index.data_checksum_ = 123456789;
+  ASSERT_EQ(OB_SUCCESS, write_index.serialize(buf, sizeof(buf), pos));
+  ASSERT_EQ(write_index.get_serialize_size(), pos);
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, read_index.deserialize(buf, sizeof(buf), pos));
+  ASSERT_EQ(write_index, read_index);
+
+  // the index of the older version is read with unknown data checksum
+  OldBackupMacroBlockIndex old_index;
+  old_index.logic_id_ = write_index.logic_id_;
+  old_index.backup_set_id_ = write_index.backup_set_id_;
+  old_index.ls_id_ = write_index.ls_id_;
+  old_index.turn_id_ = write_index.turn_id_;
+  old_index.retry_id_ = write_index.retry_id_;
+  old_index.file_id_ = write_index.file_id_;
+  old_index.offset_ = write_index.offset_;
+  old_index.length_ = write_index.length_;
+  pos = 0;
+  ASSERT_EQ(OB_SUCCESS, old_index.serialize(buf, sizeof(buf), pos));
+  const int64_t old_len = pos;
+  pos = 0;
+  read_index.reset();
+  ASSERT_EQ(OB_SUCCESS, read_index.deserialize(buf, old_len, pos));
+  ASSERT_EQ(old_len, pos);
+  ASSERT_EQ(0, read_index.data_checksum_);
+  write_index.data_checksum_ = 0;
+  ASSERT_EQ(write_index, read_index);
+}
+
+TEST(TestBackupDataStruct, BackupMacroBlockIndexCheckDataChecksum)
+{
+  ObBackupMacroBlockIndex macro_index;
+  make_macro_block_index(macro_index);
+  macro_index.data_checksum_ = 123456789;
+  ASSERT_EQ(OB_SUCCESS, macro_index.check_data_checksum(123456789));
+  // the macro block with the same logic id is changed
+  ASSERT_EQ(OB_CHECKSUM_ERROR, macro_index.check_data_checksum(987654321));
+  // unknown data checksum of the macro block
+  ASSERT_EQ(OB_SUCCESS, macro_index.check_data_checksum(0));
+  // unknown data checksum of the index written by the older version
+  macro_index.data_checksum_ = 0;
+  ASSERT_EQ(OB_SUCCESS, macro_index.check_data_checksum(987654321));
+}
+
 }  // namespace backup
 }  // namespace oceanbase
 
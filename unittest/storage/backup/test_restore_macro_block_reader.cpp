@@ -0,0 +1,186 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+
+#include "storage/high_availability/ob_storage_ha_reader.h"
+#include "storage/high_availability/ob_storage_restore_struct.h"
+#include "storage/backup/ob_backup_restore_util.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+using namespace oceanbase::backup;
+using namespace oceanbase::storage;
+
+namespace oceanbase {
+namespace storage {
+
+class TestRestoreMacroBlockReader : public ::testing::Test {
+public:
+  static const int64_t BLOCK_BUF_SIZE = OB_DEFAULT_MACRO_BLOCK_SIZE + DIO_READ_ALIGN_SIZE;
+
+  virtual void SetUp()
+  {
+    mgr_.is_inited_ = true;
+    reader_.copy_macro_range_info_ = &range_info_;
+    reader_.restore_macro_block_id_mgr_ = &mgr_;
+  }
+
+protected:
+  // the macro block of the range at offset of the file_id-th backup file
+  void add_macro_block(const int64_t file_id, const int64_t offset, const int64_t length)
+  {
+    ObBackupMacroBlockIndex macro_index;
+    ObRestoreMacroBlockId block_id;
+    macro_index.logic_id_.data_seq_ = mgr_.block_id_array_.count();
+    macro_index.logic_id_.logic_version_ = 1657251061256045963;
+    macro_index.logic_id_.tablet_id_ = 200001;
+    macro_index.backup_set_id_ = 1;
+    macro_index.ls_id_ = ObLSID(1001);
+    macro_index.turn_id_ = 1;
+    macro_index.retry_id_ = 0;
+    macro_index.file_id_ = file_id;
+    macro_index.offset_ = offset;
+    macro_index.length_ = length;
+    block_id.logic_block_id_ = macro_index.logic_id_;
+    ASSERT_EQ(OB_SUCCESS, macro_index.get_backup_physical_id(block_id.backup_physic_block_id_));
+    ASSERT_EQ(OB_SUCCESS, mgr_.block_id_array_.push_back(block_id));
+    range_info_.macro_block_count_ = mgr_.block_id_array_.count();
+  }
+  // the next prefetch reads block_count macro blocks from the file_id-th backup file
+  void check_prefetch(const int64_t block_count, const int64_t file_id, const int64_t prefetch_size)
+  {
+    int64_t size = 0;
+    ASSERT_EQ(OB_SUCCESS, reader_.get_prefetch_macro_block_indexes(size));
+    ASSERT_EQ(block_count, reader_.prefetch_index_list_.count());
+    ASSERT_EQ(prefetch_size, size);
+    for (int64_t i = 0; i < block_count; ++i) {
+      const ObBackupMacroBlockIndex &macro_index = reader_.prefetch_index_list_.at(i);
+      ASSERT_EQ(reader_.macro_block_index_ + i, macro_index.logic_id_.data_seq_);
+      ASSERT_EQ(file_id, macro_index.file_id_);
+    }
+    // the prefetched macro blocks are consumed
+    reader_.macro_block_index_ += block_count;
+    reader_.macro_block_count_ += block_count;
+  }
+
+protected:
+  ObCopyMacroRangeInfo range_info_;
+  ObRestoreMacroBlockIdMgr mgr_;
+  ObCopyMacroBlockRestoreReader reader_;
+};
+const int64_t TestRestoreMacroBlockReader::BLOCK_BUF_SIZE;
+
+TEST_F(TestRestoreMacroBlockReader, prefetch_buffer_size)
+{
+  // at least one macro block
+  ASSERT_EQ(OB_SUCCESS, reader_.alloc_buffers());
+  ASSERT_EQ(BLOCK_BUF_SIZE, reader_.prefetch_buf_size_);
+  // no more than the macro blocks of the range
+  for (int64_t i = 0; i < 3; ++i) {
+    add_macro_block(1, i * OB_DEFAULT_MACRO_BLOCK_SIZE, OB_DEFAULT_MACRO_BLOCK_SIZE);
+  }
+  ObCopyMacroBlockRestoreReader small_reader;
+  small_reader.copy_macro_range_info_ = &range_info_;
+  ASSERT_EQ(OB_SUCCESS, small_reader.alloc_buffers());
+  ASSERT_EQ(3 * BLOCK_BUF_SIZE, small_reader.prefetch_buf_size_);
+  // no more than MAX_PREFETCH_MACRO_BLOCK_COUNT macro blocks
+  range_info_.macro_block_count_ = 100;
+  ObCopyMacroBlockRestoreReader large_reader;
+  large_reader.copy_macro_range_info_ = &range_info_;
+  ASSERT_EQ(OB_SUCCESS, large_reader.alloc_buffers());
+  ASSERT_EQ(ObCopyMacroBlockRestoreReader::MAX_PREFETCH_MACRO_BLOCK_COUNT * BLOCK_BUF_SIZE,
+      large_reader.prefetch_buf_size_);
+}
+
+TEST_F(TestRestoreMacroBlockReader, adjacent_macro_blocks)
+{
+  const int64_t length = 16 * DIO_READ_ALIGN_SIZE;
+  for (int64_t i = 0; i < 4; ++i) {
+    add_macro_block(1, i * length, length);
+  }
+  ASSERT_EQ(OB_SUCCESS, reader_.alloc_buffers());
+  // one read of all the macro blocks of the range
+  check_prefetch(4, 1, 4 * length);
+}
+
+TEST_F(TestRestoreMacroBlockReader, non_adjacent_macro_blocks)
+{
+  const int64_t length = 16 * DIO_READ_ALIGN_SIZE;
+  add_macro_block(1, 0, length);
+  add_macro_block(1, length, length);
+  // a macro block of another range is between them
+  add_macro_block(1, 3 * length, length);
+  add_macro_block(1, 4 * length, length);
+  ASSERT_EQ(OB_SUCCESS, reader_.alloc_buffers());
+  check_prefetch(2, 1, 2 * length);
+  check_prefetch(2, 1, 2 * length);
+}
+
+TEST_F(TestRestoreMacroBlockReader, cross_file_macro_blocks)
+{
+  const int64_t length = 16 * DIO_READ_ALIGN_SIZE;
+  add_macro_block(1, 0, length);
+  add_macro_block(1, length, length);
+  // the offset follows the previous macro block, but in the next backup file
+  add_macro_block(2, 2 * length, length);
+  add_macro_block(2, 3 * length, length);
+  add_macro_block(3, 0, length);
+  ASSERT_EQ(OB_SUCCESS, reader_.alloc_buffers());
+  check_prefetch(2, 1, 2 * length);
+  check_prefetch(2, 2, 2 * length);
+  check_prefetch(1, 3, length);
+  ASSERT_EQ(range_info_.macro_block_count_, reader_.macro_block_count_);
+}
+
+TEST_F(TestRestoreMacroBlockReader, full_prefetch_buffer)
+{
+  const int64_t max_count = ObCopyMacroBlockRestoreReader::MAX_PREFETCH_MACRO_BLOCK_COUNT;
+  for (int64_t i = 0; i < max_count + 2; ++i) {
+    add_macro_block(1, i * OB_DEFAULT_MACRO_BLOCK_SIZE, OB_DEFAULT_MACRO_BLOCK_SIZE);
+  }
+  ASSERT_EQ(OB_SUCCESS, reader_.alloc_buffers());
+  check_prefetch(max_count, 1, max_count * OB_DEFAULT_MACRO_BLOCK_SIZE);
+  check_prefetch(2, 1, 2 * OB_DEFAULT_MACRO_BLOCK_SIZE);
+}
+
+TEST_F(TestRestoreMacroBlockReader, unaligned_macro_block)
+{
+  ObBackupMacroBlockIndex macro_index;
+  ObBufferReader data_buffer;
+  char buf[DIO_READ_ALIGN_SIZE];
+  macro_index.logic_id_.data_seq_ = 0;
+  macro_index.logic_id_.logic_version_ = 1657251061256045963;
+  macro_index.logic_id_.tablet_id_ = 200001;
+  macro_index.backup_set_id_ = 1;
+  macro_index.ls_id_ = ObLSID(1001);
+  macro_index.turn_id_ = 1;
+  macro_index.length_ = DIO_READ_ALIGN_SIZE + 1;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObLSBackupRestoreUtil::parse_macro_block_data("file:///backup/macro_block_1",
+      macro_index, buf, data_buffer));
+}
+
+}  // namespace storage
+}  // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_restore_macro_block_reader.log*");
+  OB_LOGGER.set_file_name("test_restore_macro_block_reader.log", true);
+  OB_LOGGER.set_log_level("info");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
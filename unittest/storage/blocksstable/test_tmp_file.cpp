@@ -1531,6 +1531,138 @@ TEST_F(TestTmpFile, test_handle_double_wait)
   ObTmpFileManager::get_instance().remove(fd);
 }
 
+TEST_F(TestTmpFile, test_big_file_extent_size)
+{
+  int ret = OB_SUCCESS;
+  int64_t dir = -1;
+  int64_t fd = -1;
+  const int64_t page_size = ObTmpMacroBlock::get_default_page_size();
+  // the first extent is of a small file, and the later ones double up to the max prealloc size
+  const int64_t extent_page_nums[] = {4, 8, 16, 32, 64, 64};
+  const int64_t extent_cnt = sizeof(extent_page_nums) / sizeof(extent_page_nums[0]);
+  int64_t write_size = 0;
+  for (int64_t i = 0; i < extent_cnt; ++i) {
+    write_size += extent_page_nums[i] * page_size;
+  }
+  ObTmpFileIOInfo io_info;
+  ObTmpFileIOHandle handle;
+  ret = ObTmpFileManager::get_instance().alloc_dir(dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = ObTmpFileManager::get_instance().open(fd, dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  char *write_buf = (char *)malloc(write_size);
+  for (int64_t i = 0; i < write_size; ++i) {
+    write_buf[i] = static_cast<char>(i % 256);
+  }
+  char *read_buf = (char *)malloc(write_size);
+  io_info.fd_ = fd;
+  io_info.tenant_id_ = 1;
+  io_info.io_desc_.set_category(ObIOCategory::USER_IO);
+  io_info.io_desc_.set_wait_event(2);
+  io_info.size_ = page_size;
+  const int64_t timeout_ms = 5000;
+  // sequential writes of one page each
+  for (int64_t offset = 0; offset < write_size; offset += page_size) {
+    io_info.buf_ = write_buf + offset;
+    ret = ObTmpFileManager::get_instance().write(io_info, timeout_ms);
+    ASSERT_EQ(OB_SUCCESS, ret);
+  }
+
+  ObTmpFileHandle file_handle;
+  ret = ObTmpFileManager::get_instance().get_tmp_file_handle(fd, file_handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ObIArray<ObTmpFileExtent *> &extents = file_handle.get_resource_ptr()->file_meta_.get_extents();
+  ASSERT_EQ(extent_cnt, extents.count());
+  for (int64_t i = 0; i < extent_cnt; ++i) {
+    ASSERT_EQ(extent_page_nums[i], extents.at(i)->get_page_nums());
+  }
+  file_handle.reset();
+
+  io_info.buf_ = read_buf;
+  io_info.size_ = write_size;
+  ret = ObTmpFileManager::get_instance().pread(io_info, 0, timeout_ms, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(write_size, handle.get_data_size());
+  int cmp = memcmp(handle.get_buffer(), write_buf, write_size);
+  ASSERT_EQ(0, cmp);
+
+  free(write_buf);
+  free(read_buf);
+  ObTmpFileManager::get_instance().remove(fd);
+}
+
+TEST_F(TestTmpFile, test_write_with_wash_in_flight)
+{
+  int ret = OB_SUCCESS;
+  int64_t dir = -1;
+  int64_t fd = -1;
+  const int64_t write_size = 64 * 1024;
+  ObTmpFileIOInfo io_info;
+  ObTmpFileIOHandle handle;
+  ret = ObTmpFileManager::get_instance().alloc_dir(dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = ObTmpFileManager::get_instance().open(fd, dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  char *write_buf = (char *)malloc(2 * write_size);
+  for (int64_t i = 0; i < 2 * write_size; ++i) {
+    write_buf[i] = static_cast<char>(i % 251);
+  }
+  char *read_buf = (char *)malloc(2 * write_size);
+  io_info.fd_ = fd;
+  io_info.tenant_id_ = 1;
+  io_info.io_desc_.set_category(ObIOCategory::USER_IO);
+  io_info.io_desc_.set_wait_event(2);
+  io_info.buf_ = write_buf;
+  io_info.size_ = write_size;
+  const int64_t timeout_ms = 5000;
+  ret = ObTmpFileManager::get_instance().write(io_info, timeout_ms);
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  // wash the block of the file, and leave its write io in flight
+  ObTmpFileHandle file_handle;
+  ret = ObTmpFileManager::get_instance().get_tmp_file_handle(fd, file_handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  const int64_t block_id = file_handle.get_resource_ptr()->file_meta_.get_last_extent()->get_block_id();
+  file_handle.reset();
+  ObTmpTenantFileStoreHandle store_handle;
+  ret = OB_TMP_FILE_STORE.get_store(1, store_handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ObTmpTenantFileStore *store = store_handle.get_tenant_store();
+  ObTmpTenantMemBlockManager &mem_block_manager = store->tmp_mem_block_manager_;
+  ObTmpMacroBlock *block = NULL;
+  ret = store->tmp_block_manager_.get_macro_block(block_id, block);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  bool is_empty = false;
+  ret = mem_block_manager.wash(1, block, is_empty);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_FALSE(is_empty);
+  ASSERT_EQ(1, mem_block_manager.write_handles_.count());
+  ASSERT_TRUE(mem_block_manager.check_need_wait_write(*block));
+
+  // the write goes to a new extent without waiting for the wash
+  io_info.buf_ = write_buf + write_size;
+  ret = ObTmpFileManager::get_instance().write(io_info, timeout_ms);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(1, mem_block_manager.write_handles_.count());
+
+  io_info.buf_ = read_buf;
+  io_info.size_ = 2 * write_size;
+  ret = ObTmpFileManager::get_instance().pread(io_info, 0, timeout_ms, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(2 * write_size, handle.get_data_size());
+  int cmp = memcmp(handle.get_buffer(), write_buf, 2 * write_size);
+  ASSERT_EQ(0, cmp);
+
+  ret = mem_block_manager.wait_write_io_finish();
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(0, mem_block_manager.write_handles_.count());
+  ASSERT_FALSE(mem_block_manager.check_need_wait_write(*block));
+
+  free(write_buf);
+  free(read_buf);
+  ObTmpFileManager::get_instance().remove(fd);
+}
+
 TEST_F(TestTmpFile, test_sql_workload)
 {
   int ret = OB_SUCCESS;
@@ -0,0 +1,262 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX COMMON
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "share/ob_local_device.h"
+#include "lib/allocator/ob_malloc.h"
+#include "lib/random/ob_random.h"
+#include "lib/time/ob_time_utility.h"
+
+using namespace oceanbase::common;
+using namespace oceanbase::share;
+
+// Benchmark of the async io interfaces of ObLocalDevice, random reads of the block file are
+// issued by libaio, io_uring and io_uring with sqpoll in turn, and the iops and latency are
+// printed for each of them.
+//
+// Every thread owns an io context like an io channel does, and keeps io_depth reads in flight.
+//
+// It is not run by ctest, build it by `make io_uring_perf`.
+//
+// usage: io_uring_perf [-d data_dir] [-t thread_count] [-q io_depth] [-s io_size] [-n seconds]
+namespace test
+{
+#define TEST_DATA_DIR "io_uring_test/data_dir"
+#define TEST_SSTABLE_DIR TEST_DATA_DIR "/sstable"
+static const char *data_dir = TEST_DATA_DIR;
+static const char *sstable_dir = TEST_SSTABLE_DIR;
+static int64_t THREAD_COUNT = 4;
+static int64_t IO_DEPTH = 32;
+static int64_t IO_SIZE = 4096;
+static int64_t RUN_SECONDS = 10;
+static const int64_t BLOCK_SIZE = 2L * 1024L * 1024L;
+static const int64_t DATA_FILE_SIZE = 1024L * 1024L * 1024L;
+
+struct PerfIO
+{
+  ObIOCB *iocb_;
+  char *buf_;
+  int64_t submit_ts_;
+};
+
+struct PerfResult
+{
+  PerfResult() : io_count_(0), fail_count_(0), latencies_() {}
+  int64_t io_count_;
+  int64_t fail_count_;
+  std::vector<int64_t> latencies_;
+};
+
+int init_device(const bool io_uring, const bool sqpoll, ObLocalDevice &device)
+{
+  int ret = OB_SUCCESS;
+  const int64_t IO_OPT_COUNT = 8;
+  ObIODOpt io_opts[IO_OPT_COUNT];
+  io_opts[0].set("data_dir", data_dir);
+  io_opts[1].set("sstable_dir", sstable_dir);
+  io_opts[2].set("block_size", BLOCK_SIZE);
+  io_opts[3].set("datafile_disk_percentage", 0L);
+  io_opts[4].set("datafile_size", DATA_FILE_SIZE);
+  io_opts[5].set("media_id", 0L);
+  io_opts[6].set("io_uring", io_uring);
+  io_opts[7].set("io_uring_sqpoll", sqpoll);
+  ObIODOpts init_opts;
+  init_opts.opts_ = io_opts;
+  init_opts.opt_cnt_ = IO_OPT_COUNT;
+  if (OB_FAIL(device.init(init_opts))) {
+    LOG_WARN("init device failed", K(ret));
+  } else {
+    ObIODOpts opts_start;
+    ObIODOpt opt_start;
+    opts_start.opts_ = &(opt_start);
+    opts_start.opt_cnt_ = 1;
+    opt_start.set("reserved size", 0L);
+    if (OB_FAIL(device.start(opts_start))) {
+      LOG_WARN("start device failed", K(ret));
+    }
+  }
+  return ret;
+}
+
+int submit_random_read(ObLocalDevice &device, ObIOContext *io_context, PerfIO &io)
+{
+  int ret = OB_SUCCESS;
+  const int64_t block_cnt = DATA_FILE_SIZE / BLOCK_SIZE;
+  ObIOFd fd(&device, 0, ObRandom::rand(ObLocalDevice::RESERVED_BLOCK_INDEX, block_cnt - 1));
+  const int64_t offset = ObRandom::rand(0, BLOCK_SIZE / IO_SIZE - 1) * IO_SIZE;
+  if (OB_FAIL(device.io_prepare_pread(fd, io.buf_, IO_SIZE, offset, io.iocb_, &io))) {
+    LOG_WARN("prepare pread failed", K(ret), K(fd), K(offset));
+  } else {
+    io.submit_ts_ = ObTimeUtility::current_time();
+    if (OB_FAIL(device.io_submit(io_context, io.iocb_))) {
+      LOG_WARN("submit failed", K(ret), K(fd), K(offset));
+    }
+  }
+  return ret;
+}
+
+void run_thread(ObLocalDevice &device, const int64_t stop_ts, PerfResult &result)
+{
+  int ret = OB_SUCCESS;
+  ObIOContext *io_context = nullptr;
+  ObIOEvents *io_events = nullptr;
+  std::vector<PerfIO> ios(IO_DEPTH);
+  int64_t inflight = 0;
+  struct timespec timeout;
+  timeout.tv_sec = 0;
+  timeout.tv_nsec = 100L * 1000L * 1000L;
+  if (OB_FAIL(device.io_setup(static_cast<uint32_t>(IO_DEPTH), io_context))) {
+    LOG_WARN("io setup failed", K(ret));
+  } else if (OB_ISNULL(io_events = device.alloc_io_events(static_cast<uint32_t>(IO_DEPTH)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc io events failed", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < IO_DEPTH; ++i) {
+    if (OB_ISNULL(ios[i].iocb_ = device.alloc_iocb())) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("alloc iocb failed", K(ret));
+    } else if (OB_ISNULL(ios[i].buf_ = static_cast<char *>(ob_malloc_align(DIO_READ_ALIGN_SIZE,
+        IO_SIZE, "IOUringPerf")))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("alloc io buffer failed", K(ret));
+    } else if (OB_FAIL(submit_random_read(device, io_context, ios[i]))) {
+      LOG_WARN("submit read failed", K(ret));
+    } else {
+      ++inflight;
+    }
+  }
+  while (OB_SUCC(ret) && inflight > 0) {
+    if (OB_FAIL(device.io_getevents(io_context, 1, io_events, &timeout))) {
+      LOG_WARN("get events failed", K(ret));
+    }
+    const int64_t now = ObTimeUtility::current_time();
+    for (int64_t i = 0; OB_SUCC(ret) && i < io_events->get_complete_cnt(); ++i) {
+      PerfIO *io = static_cast<PerfIO *>(io_events->get_ith_data(i));
+      --inflight;
+      if (0 != io_events->get_ith_ret_code(i) || IO_SIZE != io_events->get_ith_ret_bytes(i)) {
+        ++result.fail_count_;
+      } else {
+        ++result.io_count_;
+        result.latencies_.push_back(now - io->submit_ts_);
+      }
+      if (now < stop_ts) {
+        if (OB_FAIL(submit_random_read(device, io_context, *io))) {
+          LOG_WARN("submit read failed", K(ret));
+        } else {
+          ++inflight;
+        }
+      }
+    }
+  }
+  for (int64_t i = 0; i < IO_DEPTH; ++i) {
+    if (nullptr != ios[i].iocb_) {
+      device.free_iocb(ios[i].iocb_);
+    }
+    if (nullptr != ios[i].buf_) {
+      ob_free_align(ios[i].buf_);
+    }
+  }
+  if (nullptr != io_events) {
+    device.free_io_events(io_events);
+  }
+  if (nullptr != io_context) {
+    device.io_destroy(io_context);
+  }
+}
+
+void run(const char *name, const bool io_uring, const bool sqpoll)
+{
+  ObLocalDevice device;
+  if (OB_SUCCESS != init_device(io_uring, sqpoll, device)) {
+    std::cout << "====" << name << ": init device failed" << std::endl;
+  } else {
+    std::vector<PerfResult> results(THREAD_COUNT);
+    std::vector<std::thread> threads;
+    const int64_t begin_ts = ObTimeUtility::current_time();
+    const int64_t stop_ts = begin_ts + RUN_SECONDS * 1000L * 1000L;
+    for (int64_t i = 0; i < THREAD_COUNT; ++i) {
+      threads.push_back(std::thread(run_thread, std::ref(device), stop_ts, std::ref(results[i])));
+    }
+    for (int64_t i = 0; i < THREAD_COUNT; ++i) {
+      threads[i].join();
+    }
+    const int64_t elapsed = MAX(1, ObTimeUtility::current_time() - begin_ts);
+    int64_t io_count = 0;
+    int64_t fail_count = 0;
+    std::vector<int64_t> latencies;
+    for (int64_t i = 0; i < THREAD_COUNT; ++i) {
+      io_count += results[i].io_count_;
+      fail_count += results[i].fail_count_;
+      latencies.insert(latencies.end(), results[i].latencies_.begin(), results[i].latencies_.end());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    int64_t total_latency = 0;
+    for (int64_t i = 0; i < (int64_t)latencies.size(); ++i) {
+      total_latency += latencies[i];
+    }
+    const int64_t lat_cnt = MAX(1, (int64_t)latencies.size());
+    std::cout << "====" << name << " iops:" << io_count * 1000000L / elapsed
+              << ", fail_cnt:" << fail_count
+              << ", avg_latency(us):" << total_latency / lat_cnt
+              << ", p50(us):" << (latencies.empty() ? 0 : latencies[latencies.size() / 2])
+              << ", p99(us):" << (latencies.empty() ? 0 : latencies[latencies.size() * 99 / 100])
+              << std::endl;
+  }
+  device.destroy();
+}
+}
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("WARN");
+  OB_LOGGER.set_file_name("io_uring_perf.log", true);
+  int c = 0;
+  while(-1 != (c = getopt(argc, argv, "d:t:q:s:n:"))) {
+    switch(c) {
+      case 'd':
+        test::data_dir = optarg;
+        break;
+      case 't':
+        test::THREAD_COUNT = atoll(optarg);
+        break;
+      case 'q':
+        test::IO_DEPTH = atoll(optarg);
+        break;
+      case 's':
+        test::IO_SIZE = atoll(optarg);
+        break;
+      case 'n':
+        test::RUN_SECONDS = atoll(optarg);
+        break;
+      default:
+        printf("usage: io_uring_perf [-d data_dir] [-t thread_count] [-q io_depth] [-s io_size] [-n seconds]\n");
+        break;
+    }
+  }
+  std::string sstable_dir = std::string(test::data_dir) + "/sstable";
+  test::sstable_dir = sstable_dir.c_str();
+  if (0 != system(("mkdir -p " + sstable_dir).c_str())) {
+    std::cout << "====" << "fail to create " << sstable_dir << std::endl;
+    return 1;
+  }
+  std::cout << "====" << "thread_cnt:" << test::THREAD_COUNT << ", io_depth:" << test::IO_DEPTH
+            << ", io_size:" << test::IO_SIZE << ", seconds:" << test::RUN_SECONDS << std::endl;
+  test::run("libaio", false, false);
+  test::run("io_uring", true, false);
+  test::run("io_uring_sqpoll", true, true);
+  return 0;
+}
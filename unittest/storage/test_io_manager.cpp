@@ -793,6 +793,120 @@ TEST_F(TestIOManager, simple)
   ASSERT_SUCC(THE_IO_DEVICE->close(fd));
 }
 
+// the ios submitted by the senders for merged requests
+static int64_t get_merged_submit_count()
+{
+  int64_t count = 0;
+  ObIOScheduler &io_scheduler = ObIOManager::get_instance().io_scheduler_;
+  for (int64_t i = 0; i < io_scheduler.senders_.count(); ++i) {
+    count += io_scheduler.senders_.at(i)->get_merged_submit_count();
+  }
+  return count;
+}
+
+class TestIOMerge
+{
+public:
+  static const int64_t FILE_SIZE = 1024L * 1024L;
+  static const int64_t IO_TIMEOUT_MS = 1000L * 5L;
+  static const int64_t MAX_ROUND = 100;
+
+  TestIOMerge() : fd_(), buf_(nullptr), allocator_() {}
+  // write the file with different bytes in each block and turn on the io merge
+  void init(const char *file_path)
+  {
+    ASSERT_SUCC(THE_IO_DEVICE->open(file_path, O_CREAT | O_DIRECT | O_TRUNC | O_RDWR, 0644, fd_));
+    ASSERT_TRUE(fd_.is_valid());
+    ObIOManager &io_mgr = ObIOManager::get_instance();
+    ObIOConfig io_config = io_mgr.get_io_config();
+    io_config.enable_io_merge_ = true;
+    ASSERT_SUCC(io_mgr.set_io_config(io_config));
+    buf_ = static_cast<char *>(allocator_.alloc(FILE_SIZE));
+    ASSERT_NE(nullptr, buf_);
+    for (int64_t i = 0; i < FILE_SIZE; ++i) {
+      buf_[i] = static_cast<char>('a' + (i / DIO_READ_ALIGN_SIZE) % 26);
+    }
+    ObIOInfo io_info = get_io_info(0, FILE_SIZE);
+    io_info.flag_.set_write();
+    io_info.buf_ = buf_;
+    ASSERT_SUCC(io_mgr.write(io_info, IO_TIMEOUT_MS));
+  }
+  void destroy()
+  {
+    ObIOManager &io_mgr = ObIOManager::get_instance();
+    ObIOConfig io_config = io_mgr.get_io_config();
+    io_config.enable_io_merge_ = false;
+    ASSERT_SUCC(io_mgr.set_io_config(io_config));
+    ASSERT_SUCC(THE_IO_DEVICE->close(fd_));
+  }
+  // the reads are sent together, whether they are merged depends on the requests ready in the
+  // queue of the sender, so they are sent again until a merged io is submitted
+  template <int64_t READ_COUNT>
+  void read_until_merged(const int64_t (&offsets)[READ_COUNT], const int64_t (&sizes)[READ_COUNT],
+                         const int (&rets)[READ_COUNT], const int64_t (&data_sizes)[READ_COUNT])
+  {
+    const int64_t merged_submit_count = get_merged_submit_count();
+    for (int64_t round = 0; round < MAX_ROUND && merged_submit_count == get_merged_submit_count(); ++round) {
+      ObIOHandle io_handles[READ_COUNT];
+      for (int64_t i = 0; i < READ_COUNT; ++i) {
+        ObIOInfo io_info = get_io_info(offsets[i], sizes[i]);
+        io_info.flag_.set_read();
+        ASSERT_SUCC(ObIOManager::get_instance().aio_read(io_info, io_handles[i]));
+      }
+      for (int64_t i = 0; i < READ_COUNT; ++i) {
+        ASSERT_EQ(rets[i], io_handles[i].wait(IO_TIMEOUT_MS));
+        ASSERT_EQ(data_sizes[i], io_handles[i].get_data_size());
+        ASSERT_TRUE(0 == data_sizes[i] || 0 == memcmp(buf_ + offsets[i], io_handles[i].get_buffer(), data_sizes[i]));
+      }
+    }
+    ASSERT_LT(merged_submit_count, get_merged_submit_count());
+  }
+private:
+  ObIOInfo get_io_info(const int64_t offset, const int64_t size)
+  {
+    ObIOInfo io_info;
+    io_info.tenant_id_ = 500;
+    io_info.fd_ = fd_;
+    io_info.flag_.set_category(ObIOCategory::USER_IO);
+    io_info.flag_.set_wait_event(100);
+    io_info.offset_ = offset;
+    io_info.size_ = size;
+    return io_info;
+  }
+private:
+  ObIOFd fd_;
+  char *buf_;
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestIOManager, merge)
+{
+  TestIOMerge io_merge;
+  io_merge.init(TEST_ROOT_DIR "/test_io_merge_file");
+  // adjacent, overlapping and unaligned reads, and the last one reads the end of file
+  const int64_t FILE_SIZE = TestIOMerge::FILE_SIZE;
+  const int64_t offsets[] = { 0, 16384, 32768, 20000, 65536, 81920 + 100, FILE_SIZE - 4096, FILE_SIZE - 4096 };
+  const int64_t sizes[] = { 16384, 16384, 16384, 30000, 16384, 8000, 4096, 8192 };
+  const int rets[] = { OB_SUCCESS, OB_SUCCESS, OB_SUCCESS, OB_SUCCESS, OB_SUCCESS, OB_SUCCESS, OB_SUCCESS, OB_DATA_OUT_OF_RANGE };
+  const int64_t data_sizes[] = { 16384, 16384, 16384, 30000, 16384, 8000, 4096, 4096 };
+  io_merge.read_until_merged(offsets, sizes, rets, data_sizes);
+  io_merge.destroy();
+}
+
+TEST_F(TestIOManager, merge_short_read)
+{
+  TestIOMerge io_merge;
+  io_merge.init(TEST_ROOT_DIR "/test_io_merge_short_file");
+  // the merged read returns short at the aligned end of file, the request after it is not read
+  // by the merged read and returns the end of file by itself
+  const int64_t FILE_SIZE = TestIOMerge::FILE_SIZE;
+  const int64_t offsets[] = { FILE_SIZE - 8192, FILE_SIZE - 4096, FILE_SIZE };
+  const int64_t sizes[] = { 4096, 4096, 4096 };
+  const int rets[] = { OB_SUCCESS, OB_SUCCESS, OB_DATA_OUT_OF_RANGE };
+  const int64_t data_sizes[] = { 4096, 4096, 0 };
+  io_merge.read_until_merged(offsets, sizes, rets, data_sizes);
+  io_merge.destroy();
+}
 
 struct IOPerfDevice
 {
@@ -0,0 +1,204 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <fcntl.h>
+
+#define USING_LOG_PREFIX STORAGE
+
+#define protected public
+#define private public
+
+#include "lib/oblog/ob_log.h"
+#include "share/ob_local_io_uring.h"
+#include "share/ob_local_device.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace share;
+namespace unittest
+{
+
+class TestLocalIOUring : public ::testing::Test
+{
+public:
+  static const int64_t IO_SIZE = 4096;
+  static const int64_t IO_CNT = 8;
+
+  TestLocalIOUring() : fd_(-1) {}
+  virtual ~TestLocalIOUring() = default;
+  virtual void SetUp()
+  {
+    fd_ = ::open(TEST_FILE, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    ASSERT_GE(fd_, 0);
+    MEMSET(write_bufs_, 0, sizeof(write_bufs_));
+    MEMSET(read_bufs_, 0, sizeof(read_bufs_));
+    for (int64_t i = 0; i < IO_CNT; ++i) {
+      MEMSET(write_bufs_[i], static_cast<char>('a' + i), IO_SIZE);
+    }
+  }
+  virtual void TearDown()
+  {
+    ::close(fd_);
+    ::unlink(TEST_FILE);
+  }
+protected:
+  // the ring can not be set up if the kernel or the build does not support it
+  bool init_ring(ObLocalIOUring &ring, const uint32_t entries, const bool sqpoll)
+  {
+    const int ret = ring.init(entries, sqpoll);
+    if (OB_NOT_SUPPORTED == ret) {
+      LOG_WARN("io uring is not supported, skip the case", K(ret), K(entries), K(sqpoll));
+    } else {
+      EXPECT_EQ(OB_SUCCESS, ret);
+    }
+    return OB_SUCCESS == ret;
+  }
+  void submit(ObLocalIOUring &ring, const bool is_read, const int64_t i)
+  {
+    if (is_read) {
+      io_prep_pread(&iocbs_[i], fd_, read_bufs_[i], IO_SIZE, i * IO_SIZE);
+    } else {
+      io_prep_pwrite(&iocbs_[i], fd_, write_bufs_[i], IO_SIZE, i * IO_SIZE);
+    }
+    iocbs_[i].data = &iocbs_[i];
+    ASSERT_EQ(OB_SUCCESS, ring.submit(iocbs_[i]));
+  }
+  // every request of [0, io_cnt) completes with IO_SIZE bytes
+  void wait(ObLocalIOUring &ring, const int64_t io_cnt)
+  {
+    bool completed[IO_CNT] = {false};
+    struct io_event events[IO_CNT];
+    struct timespec timeout;
+    timeout.tv_sec = 1;
+    timeout.tv_nsec = 0;
+    int64_t cnt = 0;
+    for (int64_t retry = 0; cnt < io_cnt && retry < 10; ++retry) {
+      int64_t event_cnt = 0;
+      ASSERT_EQ(OB_SUCCESS, ring.get_events(1, io_cnt - cnt, events, &timeout, event_cnt));
+      for (int64_t i = 0; i < event_cnt; ++i) {
+        const int64_t idx = static_cast<struct iocb *>(events[i].data) - iocbs_;
+        ASSERT_TRUE(idx >= 0 && idx < io_cnt);
+        ASSERT_FALSE(completed[idx]);
+        ASSERT_EQ(IO_SIZE, static_cast<int64_t>(events[i].res));
+        completed[idx] = true;
+      }
+      cnt += event_cnt;
+    }
+    ASSERT_EQ(io_cnt, cnt);
+  }
+  void write_and_read(ObLocalIOUring &ring)
+  {
+    for (int64_t i = 0; i < IO_CNT; ++i) {
+      submit(ring, false, i);
+    }
+    wait(ring, IO_CNT);
+    for (int64_t i = 0; i < IO_CNT; ++i) {
+      submit(ring, true, i);
+    }
+    wait(ring, IO_CNT);
+    for (int64_t i = 0; i < IO_CNT; ++i) {
+      ASSERT_EQ(0, MEMCMP(write_bufs_[i], read_bufs_[i], IO_SIZE));
+    }
+  }
+protected:
+  static constexpr const char *TEST_FILE = "test_local_io_uring.data";
+  int fd_;
+  struct iocb iocbs_[IO_CNT];
+  char write_bufs_[IO_CNT][IO_SIZE];
+  char read_bufs_[IO_CNT][IO_SIZE];
+};
+const int64_t TestLocalIOUring::IO_SIZE;
+const int64_t TestLocalIOUring::IO_CNT;
+constexpr const char *TestLocalIOUring::TEST_FILE;
+
+TEST_F(TestLocalIOUring, read_write)
+{
+  ObLocalIOUring ring;
+  if (init_ring(ring, IO_CNT, false)) {
+    write_and_read(ring);
+  }
+}
+
+TEST_F(TestLocalIOUring, read_write_sqpoll)
+{
+  ObLocalIOUring ring;
+  if (init_ring(ring, IO_CNT, true)) {
+    ASSERT_TRUE(ring.is_sqpoll());
+    write_and_read(ring);
+  }
+}
+
+TEST_F(TestLocalIOUring, setup_failure)
+{
+  ObLocalIOUring ring;
+  ASSERT_NE(OB_SUCCESS, ring.init(0, false));
+  // more entries than IORING_MAX_ENTRIES
+  ASSERT_EQ(OB_NOT_SUPPORTED, ring.init(40000, false));
+  ASSERT_FALSE(ring.is_inited_);
+  ASSERT_LT(ring.ring_fd_, 0);
+  io_prep_pread(&iocbs_[0], fd_, read_bufs_[0], IO_SIZE, 0);
+  ASSERT_EQ(OB_NOT_INIT, ring.submit(iocbs_[0]));
+
+  // the io context of the device falls back to libaio
+  ObLocalDevice device;
+  ObIODOpts opts;
+  ObIOContext *io_context = nullptr;
+  ASSERT_EQ(OB_SUCCESS, device.init(opts));
+  device.use_io_uring_ = true;
+  ASSERT_EQ(OB_SUCCESS, device.io_setup(40000, io_context));
+  ASSERT_TRUE(nullptr != io_context);
+  ASSERT_TRUE(nullptr == static_cast<ObLocalIOContext *>(io_context)->io_uring_);
+  ASSERT_EQ(OB_SUCCESS, device.io_destroy(io_context));
+  device.destroy();
+}
+
+TEST_F(TestLocalIOUring, sq_full)
+{
+  ObLocalIOUring ring;
+  if (init_ring(ring, 4, false)) {
+    const int64_t sq_entries = ring.sq_entries_;
+    ASSERT_LE(sq_entries, IO_CNT);
+    // the sqes are only queued while another thread is in io_uring_enter
+    ASSERT_EQ(OB_SUCCESS, ring.enter_lock_.lock());
+    for (int64_t i = 0; i < sq_entries; ++i) {
+      submit(ring, false, i);
+    }
+    io_prep_pwrite(&iocbs_[sq_entries], fd_, write_bufs_[sq_entries], IO_SIZE, 0);
+    ASSERT_EQ(OB_EAGAIN, ring.submit(iocbs_[sq_entries]));
+    ASSERT_EQ(0, ring.enter_cnt_);
+    ASSERT_EQ(OB_SUCCESS, ring.enter_lock_.unlock());
+    // the queued sqes are submitted by one io_uring_enter
+    wait(ring, sq_entries);
+    ASSERT_EQ(1, ring.enter_cnt_);
+    for (int64_t i = 0; i < sq_entries; ++i) {
+      submit(ring, true, i);
+    }
+    wait(ring, sq_entries);
+    for (int64_t i = 0; i < sq_entries; ++i) {
+      ASSERT_EQ(0, MEMCMP(write_bufs_[i], read_bufs_[i], IO_SIZE));
+    }
+  }
+}
+
+} // namespace unittest
+} // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_local_io_uring.log*");
+  OB_LOGGER.set_file_name("test_local_io_uring.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
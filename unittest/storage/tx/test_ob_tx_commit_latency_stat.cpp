@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define private public
+#include "storage/tx/ob_tx_commit_latency_stat.h"
+#include <gtest/gtest.h>
+#include "share/ob_errno.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/container/ob_se_array.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace transaction;
+namespace unittest
+{
+
+class TestObTxCommitLatencyStat : public ::testing::Test
+{
+public :
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+
+  // build a trace whose stages are reached at the given timestamps, 0 means skipped
+  static void build_trace(const int64_t tx_id, const int64_t *ts, ObTxCommitStageTrace &trace)
+  {
+    trace.reset();
+    trace.tx_id_ = ObTransID(tx_id);
+    for (int64_t i = 0; i < ObTxCommitStage::MAX_STAGE; i++) {
+      trace.ts_[i] = ts[i];
+    }
+  }
+};
+
+TEST_F(TestObTxCommitLatencyStat, stage_trace)
+{
+  ObTxCommitStageTrace trace;
+  EXPECT_FALSE(trace.is_sampled());
+  // not sampled, nothing is recorded
+  trace.record(ObTxCommitStage::REDO_FLUSHED);
+  EXPECT_EQ(0, trace.get_ts(ObTxCommitStage::REDO_FLUSHED));
+  EXPECT_EQ(-1, trace.get_total_cost());
+
+  trace.start(ObTransID(1));
+  EXPECT_TRUE(trace.is_sampled());
+  trace.record(ObTxCommitStage::REDO_FLUSHED);
+  const int64_t redo_flushed_ts = trace.get_ts(ObTxCommitStage::REDO_FLUSHED);
+  EXPECT_GT(redo_flushed_ts, 0);
+  // only the first arrival is recorded
+  usleep(10);
+  trace.record(ObTxCommitStage::REDO_FLUSHED);
+  EXPECT_EQ(redo_flushed_ts, trace.get_ts(ObTxCommitStage::REDO_FLUSHED));
+
+  // the cost is counted from the previous recorded stage
+  const int64_t ts[ObTxCommitStage::MAX_STAGE] = {100, 0, 150, 400, 410, 500};
+  build_trace(2, ts, trace);
+  EXPECT_EQ(-1, trace.get_stage_cost(ObTxCommitStage::START_COMMIT));
+  EXPECT_EQ(-1, trace.get_stage_cost(ObTxCommitStage::REDO_FLUSHED));
+  EXPECT_EQ(50, trace.get_stage_cost(ObTxCommitStage::COMMIT_LOG_SUBMITTED));
+  EXPECT_EQ(250, trace.get_stage_cost(ObTxCommitStage::COMMIT_LOG_SYNCED));
+  EXPECT_EQ(10, trace.get_stage_cost(ObTxCommitStage::CALLBACK_EXECUTED));
+  EXPECT_EQ(90, trace.get_stage_cost(ObTxCommitStage::RESPONSE_SENT));
+  EXPECT_EQ(400, trace.get_total_cost());
+  TRANS_LOG(INFO, "commit stage trace", K(trace));
+}
+
+TEST_F(TestObTxCommitLatencyStat, latency_stat)
+{
+  ObTxCommitLatencyStat stat;
+  ObTxCommitStageTrace trace;
+
+  // unsampled traces are ignored
+  stat.add_trace(trace);
+  EXPECT_EQ(0, stat.get_total_histogram().get_total_count());
+
+  const int64_t trace_count = 100;
+  for (int64_t i = 0; i < trace_count; i++) {
+    const int64_t ts[ObTxCommitStage::MAX_STAGE] = {100, 200, 210, 1210, 1220, 1230};
+    build_trace(i + 1, ts, trace);
+    stat.add_trace(trace);
+  }
+  EXPECT_EQ(trace_count, stat.get_total_histogram().get_total_count());
+  EXPECT_EQ(1130, stat.get_total_histogram().get_avg_value());
+  EXPECT_EQ(trace_count, stat.get_stage_histogram(ObTxCommitStage::COMMIT_LOG_SYNCED).get_total_count());
+  EXPECT_EQ(1000, stat.get_stage_histogram(ObTxCommitStage::COMMIT_LOG_SYNCED).get_avg_value());
+  EXPECT_EQ(0, stat.get_stage_histogram(ObTxCommitStage::START_COMMIT).get_total_count());
+
+  ObTxCommitStageStat stage_stat;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, stage_stat.init(ObAddr(), share::ObLSID(1001),
+      ObTxCommitStage::to_str(ObTxCommitStage::COMMIT_LOG_SYNCED),
+      stat.get_stage_histogram(ObTxCommitStage::COMMIT_LOG_SYNCED)));
+  EXPECT_EQ(OB_SUCCESS, stage_stat.init(ObAddr(ObAddr::IPV4, "127.0.0.1", 8080), share::ObLSID(1001),
+      ObTxCommitStage::to_str(ObTxCommitStage::COMMIT_LOG_SYNCED),
+      stat.get_stage_histogram(ObTxCommitStage::COMMIT_LOG_SYNCED)));
+  EXPECT_EQ(trace_count, stage_stat.get_sample_count());
+  EXPECT_EQ(1000, stage_stat.get_avg_latency());
+  EXPECT_EQ(1024, stage_stat.get_p99_latency());
+
+  stat.reset();
+  EXPECT_EQ(0, stat.get_total_histogram().get_total_count());
+  EXPECT_EQ(0, stat.get_stage_histogram(ObTxCommitStage::COMMIT_LOG_SYNCED).get_total_count());
+}
+
+}//end of unittest
+}//end of oceanbase
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_tx_commit_latency_stat.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}
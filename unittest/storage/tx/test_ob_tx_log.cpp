@@ -14,6 +14,7 @@
 #define private public
 #include "storage/tx/ob_tx_log.h"
 #include "logservice/ob_log_base_header.h"
+#include "share/ob_cluster_version.h"
 
 namespace oceanbase
 {
@@ -403,6 +404,84 @@ TEST_F(TestObTxLog, tx_log_body_redo)
 
 }
 
+TEST_F(TestObTxLog, tx_log_block_compress)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+  ObTxLogBlock fill_block;
+  ObTxLogBlock replay_block;
+
+  ObTxLogBlockHeader fill_block_header(TEST_ORG_CLUSTER_ID, TEST_LOG_ENTRY_NO, ObTransID(TEST_TX_ID));
+  ASSERT_EQ(OB_SUCCESS, fill_block.init(TEST_TX_ID, fill_block_header));
+
+  const int64_t TEST_MUTATOR_SIZE = 16 * 1024;
+  int64_t mutator_pos = 0;
+  ObCLogEncryptInfo TEST_CLOG_ENCRYPT_INFO;
+  TEST_CLOG_ENCRYPT_INFO.init();
+  ObTxRedoLog fill_redo(TEST_CLOG_ENCRYPT_INFO, TEST_LOG_NO, TEST_CLUSTER_VERSION);
+  ASSERT_EQ(OB_SUCCESS, fill_block.prepare_mutator_buf(fill_redo));
+  for (int64_t i = 0; i < TEST_MUTATOR_SIZE; i++) {
+    fill_redo.get_mutator_buf()[i] = static_cast<char>('a' + i % 16);
+  }
+  mutator_pos = TEST_MUTATOR_SIZE;
+  ASSERT_EQ(OB_SUCCESS, fill_block.finish_mutator_buf(fill_redo, mutator_pos));
+
+  // uncompressed log block keeps the header format without compress info
+  int64_t pos = 0;
+  logservice::ObLogBaseHeader base_header;
+  ObTxLogBlockHeader raw_block_header;
+  ASSERT_EQ(OB_SUCCESS, base_header.deserialize(fill_block.get_buf(), fill_block.get_size(), pos));
+  ASSERT_EQ(OB_SUCCESS, raw_block_header.deserialize(fill_block.get_buf(), fill_block.get_size(), pos));
+  EXPECT_FALSE(raw_block_header.is_compressed());
+  EXPECT_EQ(pos, base_header.get_serialize_size() + fill_block_header.get_serialize_size());
+
+  char *compressed_buf = nullptr;
+  int64_t compressed_size = 0;
+  ASSERT_EQ(OB_SUCCESS, ObTxLogBlock::compress_log_block(fill_block.get_buf(),
+                                                         fill_block.get_size(),
+                                                         LZ4_COMPRESSOR,
+                                                         compressed_buf,
+                                                         compressed_size));
+  ASSERT_NE(nullptr, compressed_buf);
+  EXPECT_LT(compressed_size, fill_block.get_size());
+
+  pos = 0;
+  ObTxLogBlockHeader replay_block_header;
+  ASSERT_EQ(OB_SUCCESS, base_header.deserialize(compressed_buf, compressed_size, pos));
+  ASSERT_EQ(OB_SUCCESS, replay_block.init(compressed_buf, compressed_size, pos, replay_block_header));
+  EXPECT_TRUE(replay_block_header.is_compressed());
+  EXPECT_EQ(LZ4_COMPRESSOR, replay_block_header.get_compressor_type());
+  EXPECT_EQ(TEST_ORG_CLUSTER_ID, replay_block_header.get_org_cluster_id());
+  EXPECT_TRUE(replay_block.is_decompressed());
+
+  ObTxLogHeader log_header;
+  ObTxRedoLogTempRef redo_temp_ref;
+  ObTxRedoLog replay_redo(redo_temp_ref);
+  ASSERT_EQ(OB_SUCCESS, replay_block.get_next_log(log_header));
+  EXPECT_EQ(ObTxLogType::TX_REDO_LOG, log_header.get_tx_log_type());
+  ASSERT_EQ(OB_SUCCESS, replay_block.deserialize_log_body(replay_redo));
+  ASSERT_EQ(TEST_MUTATOR_SIZE, replay_redo.get_mutator_size());
+  EXPECT_EQ(0, MEMCMP(fill_redo.get_mutator_buf(), replay_redo.get_replay_mutator_buf(),
+                      TEST_MUTATOR_SIZE));
+  EXPECT_EQ(OB_ITER_END, replay_block.get_next_log(log_header));
+  ob_free(compressed_buf);
+}
+
+TEST_F(TestObTxLog, tx_log_block_compress_cluster_version)
+{
+  TRANS_LOG(INFO, "called", "func", test_info_->name());
+  const int64_t size = ObTxLogBlock::MIN_COMPRESS_BODY_SIZE;
+  // the observers of 4.0.0.0 can not replay the compressed log blocks
+  EXPECT_FALSE(ObTxLogBlock::need_compress(CLUSTER_VERSION_4_0_0_0, LZ4_COMPRESSOR, size));
+  EXPECT_FALSE(ObTxLogBlock::need_compress(CLUSTER_VERSION_4_0_0_0, ZSTD_1_3_8_COMPRESSOR, 4 * size));
+  EXPECT_TRUE(ObTxLogBlock::need_compress(CLUSTER_VERSION_4_1_0_0, LZ4_COMPRESSOR, size));
+  EXPECT_TRUE(ObTxLogBlock::need_compress(CLUSTER_VERSION_4_1_0_0, ZSTD_1_3_8_COMPRESSOR, 4 * size));
+  // small or uncompressed log blocks are never compressed
+  EXPECT_FALSE(ObTxLogBlock::need_compress(CLUSTER_VERSION_4_1_0_0, LZ4_COMPRESSOR, size - 1));
+  EXPECT_FALSE(ObTxLogBlock::need_compress(CLUSTER_VERSION_4_1_0_0, NONE_COMPRESSOR, 4 * size));
+  // the current cluster version is not upgraded yet
+  EXPECT_FALSE(ObTxLogBlock::need_compress(CLUSTER_CURRENT_VERSION, LZ4_COMPRESSOR, size));
+}
+
 TEST_F(TestObTxLog, test_compat_bytes)
 {
   ObLSArray TEST_LS_ARRAY;